@@ -33,6 +33,10 @@ macro(global_set_flags)
         add_definitions(-DZERO_COPY)
     endif()
 
+    if (ENABLE_V4L2_EPOLL_REACTOR)
+        add_definitions(-DV4L2_EPOLL_REACTOR)
+    endif()
+
     if (BUILD_EASYLOGGINGPP)
         add_definitions(-DBUILD_EASYLOGGINGPP)
     endif()
@@ -105,6 +109,14 @@ macro(global_target_config)
             PRIVATE ${USB_INCLUDE_DIRS}
     )
 
+    if (BUILD_WITH_LIBJPEG_TURBO)
+        include(CMake/libjpeg_turbo_config.cmake)
+        if (TARGET turbojpeg)
+            target_link_libraries(${LRS_TARGET} PRIVATE turbojpeg)
+            target_compile_definitions(${LRS_TARGET} PRIVATE RS2_USE_TURBOJPEG)
+        endif()
+    endif()
+
 
 
 endmacro()
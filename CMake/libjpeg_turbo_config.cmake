@@ -0,0 +1,12 @@
+if (NOT TARGET turbojpeg)
+    find_library(TURBOJPEG_LIB turbojpeg)
+    find_path(TURBOJPEG_INC turbojpeg.h)
+    include(FindPackageHandleStandardArgs)
+    find_package_handle_standard_args(turbojpeg "libjpeg-turbo not found; MJPEG is decoded with stb_image" TURBOJPEG_LIB TURBOJPEG_INC)
+    if (TURBOJPEG_FOUND)
+        add_library(turbojpeg INTERFACE)
+        target_include_directories(turbojpeg INTERFACE ${TURBOJPEG_INC})
+        target_link_libraries(turbojpeg INTERFACE ${TURBOJPEG_LIB})
+        install(TARGETS turbojpeg EXPORT realsense2Targets)
+    endif()
+endif()
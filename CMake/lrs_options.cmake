@@ -3,6 +3,7 @@ option(BUILD_WITH_CUDA "Enable CUDA" OFF)
 option(BUILD_GRAPHICAL_EXAMPLES "Build graphical examples and tools. Implies BUILD_GLSL_EXTENSIONS" ON)
 option(BUILD_GLSL_EXTENSIONS "Build GLSL extensions API" ON)
 option(BUILD_WITH_OPENMP "Use OpenMP" OFF)
+option(BUILD_WITH_LIBJPEG_TURBO "Decode MJPEG with libjpeg-turbo instead of stb_image, when the library is found" OFF)
 option(ENABLE_ZERO_COPY "Enable zero copy functionality" OFF)
 option(BUILD_WITH_TM2 "Build with support for Intel TM2 tracking device" ON)
 option(BUILD_EASYLOGGINGPP "Build EasyLogging++ as a part of the build" ON)
@@ -28,6 +29,7 @@ option(BUILD_OPENNI2_BINDINGS "Build OpenNI bindings" OFF)
 option(IMPORT_DEPTH_CAM_FW "Download the latest firmware for the depth cameras" ON)
 option(BUILD_CV_KINFU_EXAMPLE "Build OpenCV KinectFusion example" OFF)
 option(FORCE_RSUSB_BACKEND "Use RS USB backend, mandatory for Win7/MacOS/Android, optional for Linux" OFF)
+option(ENABLE_V4L2_EPOLL_REACTOR "Service all V4L2 video, metadata and HID nodes from a shared epoll thread pool instead of a thread per node (Linux only)" OFF)
 option(BUILD_NETWORK_DEVICE "Build Network Device support" OFF)
 option(FORCE_LIBUVC "Explicitly turn-on libuvc backend - deprecated, use FORCE_RSUSB_BACKEND instead" OFF)
 option(FORCE_WINUSB_UVC "Explicitly turn-on winusb_uvc (for win7) backend - deprecated, use FORCE_RSUSB_BACKEND instead" OFF)
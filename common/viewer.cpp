@@ -867,6 +867,9 @@ namespace rs2
         _hidden_options.emplace(RS2_OPTION_STREAM_FORMAT_FILTER);
         _hidden_options.emplace(RS2_OPTION_STREAM_INDEX_FILTER);
         _hidden_options.emplace(RS2_OPTION_FRAMES_QUEUE_SIZE);
+        _hidden_options.emplace(RS2_OPTION_FRAME_POOL_WATERMARK);
+        _hidden_options.emplace(RS2_OPTION_FRAME_POOL_HITS);
+        _hidden_options.emplace(RS2_OPTION_FRAME_POOL_MISSES);
         _hidden_options.emplace(RS2_OPTION_SENSOR_MODE);
         _hidden_options.emplace(RS2_OPTION_TRIGGER_CAMERA_ACCURACY_HEALTH);
         _hidden_options.emplace(RS2_OPTION_RESET_CAMERA_ACCURACY_HEALTH);
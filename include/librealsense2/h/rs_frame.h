@@ -70,6 +70,24 @@ typedef enum rs2_frame_metadata_value
 const char* rs2_frame_metadata_to_string(rs2_frame_metadata_value metadata);
 const char* rs2_frame_metadata_value_to_string(rs2_frame_metadata_value metadata);
 
+/** \brief Stages of the pipeline at which a frame is stamped with the system time, for latency analysis. */
+typedef enum rs2_frame_trace_stage
+{
+    RS2_FRAME_TRACE_STAGE_KERNEL_DEQUEUE      , /**< The driver handed the frame buffer to the backend. Same as RS2_FRAME_METADATA_BACKEND_TIMESTAMP */
+    RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK    , /**< The backend callback received the frame. Same as RS2_FRAME_METADATA_TIME_OF_ARRIVAL */
+    RS2_FRAME_TRACE_STAGE_UNPACK_DONE         , /**< The sensor converted the frame to the requested format */
+    RS2_FRAME_TRACE_STAGE_PROCESSING_IN       , /**< The last processing block the frame went through received it */
+    RS2_FRAME_TRACE_STAGE_PROCESSING_OUT      , /**< The last processing block the frame went through published it */
+    RS2_FRAME_TRACE_STAGE_SYNCER_OUT          , /**< The syncer matched the frame into a frameset */
+    RS2_FRAME_TRACE_STAGE_USER_CALLBACK_START , /**< The frame was last dispatched to a callback */
+    RS2_FRAME_TRACE_STAGE_USER_CALLBACK_END   , /**< The last reference to the frame was released */
+    RS2_FRAME_TRACE_STAGE_COUNT                 /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
+} rs2_frame_trace_stage;
+const char* rs2_frame_trace_stage_to_string(rs2_frame_trace_stage stage);
+
+#define RS2_LATENCY_HISTOGRAM_BINS       512  /**< Number of bins of a latency histogram */
+#define RS2_LATENCY_HISTOGRAM_BIN_WIDTH  0.25 /**< Width of a latency histogram bin, in milliseconds */
+
 /**
 * retrieve metadata from frame handle
 * \param[in] frame      handle returned from a callback
@@ -88,6 +106,37 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 */
 int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* retrieve the time at which the frame went through a stage of the pipeline
+* \param[in] frame      handle returned from a callback
+* \param[in] stage      the stage of interest
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               the system time of the stage in milliseconds, or 0 if the frame did not go through it
+*/
+rs2_time_t rs2_get_frame_trace(const rs2_frame* frame, rs2_frame_trace_stage stage, rs2_error** error);
+
+/**
+* retrieve the latency histogram of a stream for a stage of the pipeline. The frames of the stream, and of the
+* streams processed from it, are accounted for when they are released, if they were delivered by a sensor.
+* Histograms are kept once the histogram of any stream was retrieved or reset, until the process exits.
+* Bin i counts the frames that went through the stage between i and i+1 RS2_LATENCY_HISTOGRAM_BIN_WIDTH after
+* the earliest stage they were stamped at, and the last bin also counts the frames that went through it later
+* \param[in] profile    the stream profile of the frames, as requested from the sensor or returned by a processing block
+* \param[in] stage      the stage of interest
+* \param[out] bins      receives the counts of the first bins_count bins
+* \param[in] bins_count the size of bins, up to RS2_LATENCY_HISTOGRAM_BINS
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               the number of frames accounted for at this stage
+*/
+unsigned long long rs2_get_latency_histogram(const rs2_stream_profile* profile, rs2_frame_trace_stage stage, unsigned long long* bins, int bins_count, rs2_error** error);
+
+/**
+* clear the latency histograms of a stream, for all stages
+* \param[in] profile    the stream profile of the frames
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_reset_latency_histogram(const rs2_stream_profile* profile, rs2_error** error);
+
 /**
 * retrieve timestamp domain from frame handle. timestamps can only be comparable if they are in common domain
 * (for example, depth timestamp might come from system time while color timestamp might come from the device)
@@ -234,6 +283,15 @@ rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error**
 */
 int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error);
 
+/**
+* When called on Points frame type, this method returns a pointer to the index of the depth pixel of each vertex
+* Only pointclouds with RS2_OPTION_COMPACT_POINTS enabled emit indices, along with the vertices that have depth
+* \param[in] frame       Points frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Pointer to an array of indices, lifetime is managed by the frame, or null when there is a vertex per depth pixel
+*/
+const int* rs2_get_frame_points_indices(const rs2_frame* frame, rs2_error** error);
+
 /**
 * Returns the stream profile that was used to start the stream of this frame
 * \param[in] frame       frame reference, owned by the user
@@ -65,7 +65,10 @@ typedef struct rs2_pose_stream
     rs2_format fmt;
 } rs2_pose_stream;
 
-/** \brief All the parameters required to define a video frame. */
+/** \brief All the parameters required to define a video frame.
+ * The frame borrows the pixels rather than copying them, and so do the frames and framesets that hold it: the deleter
+ * is called exactly once, when the last of them is released, or right away when the frame is dropped (the sensor is
+ * not streaming, or its frames are not released). The same applies to the data of motion and pose frames. */
 typedef struct rs2_software_video_frame
 {
     void* pixels;
@@ -181,6 +184,16 @@ rs2_sensor* rs2_software_device_add_sensor(rs2_device* dev, const char* sensor_n
  */
 void rs2_software_sensor_on_video_frame(rs2_sensor* sensor, rs2_software_video_frame frame, rs2_error** error);
 
+/**
+ * Inject video frame to software sensor, letting processing blocks write over its pixels: those that keep the format
+ * of the frame (threshold) then process it in place and pass it on, instead of allocating a new frame. The content of
+ * the frame is only defined until it is processed, to the application and to the other consumers of the frame
+ * \param[in] sensor the software sensor
+ * \param[in] frame all the frame components
+ * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_software_sensor_on_writable_video_frame(rs2_sensor* sensor, rs2_software_video_frame frame, rs2_error** error);
+
 /**
 * Inject motion frame to software sonsor
 * \param[in] sensor the software sensor
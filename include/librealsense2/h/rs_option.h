@@ -107,6 +107,14 @@ extern "C" {
         RS2_OPTION_ALTERNATE_IR, /**< Turn on/off the alternate IR, When enabling alternate IR, the IR image is holding the amplitude of the depth correlation. */
         RS2_OPTION_NOISE_ESTIMATION,  /**< Noise estimation - indicates the noise on the IR image */
         RS2_OPTION_ENABLE_IR_REFLECTIVITY, /**< Enables data collection for calculating IR pixel reflectivity  */
+        RS2_OPTION_FRAME_POOL_WATERMARK, /**< Max number of released frame buffers kept for reuse per frame size, 0 disables recycling */
+        RS2_OPTION_FRAME_POOL_HITS, /**< Read-only: number of frame allocations served from recycled buffers */
+        RS2_OPTION_FRAME_POOL_MISSES, /**< Read-only: number of frame allocations that required new memory */
+        RS2_OPTION_ZERO_COPY_CAPTURE, /**< Publish raw frames directly from the capture buffers instead of copying them. Each held frame keeps a capture buffer from the driver */
+        RS2_OPTION_PROCESSING_THREADS, /**< Number of threads a processing block may use to process a frame, 1 processes it on the calling thread */
+        RS2_OPTION_COMPACT_POINTS, /**< Emit only the vertices with depth, with the index of their depth pixel (see rs2_get_frame_points_indices) */
+        RS2_OPTION_SYNC_TOLERANCE, /**< Max difference in milliseconds between the host-clock timestamps of the frames matched into a set by the multi-device syncer */
+        RS2_OPTION_SYNC_QUEUE_SIZE, /**< Max number of frames the multi-device syncer buffers per stream while waiting for the other streams */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
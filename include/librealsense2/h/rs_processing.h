@@ -126,6 +126,27 @@ void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_p
 */
 void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* queue, rs2_error** error);
 
+/**
+* Provide the memory for the frame buffers published by the processing block.
+* Every video, depth and disparity frame the block allocates from now on is placed in memory obtained from allocate.
+* The memory is handed back through deallocate once the last reference to the frame is released.
+* If allocate returns null, the frame falls back to internally allocated memory
+* \param[in] block       Processing block
+* \param[in] allocate    function pointer returning a buffer of at least the requested size. Pass null to restore the default allocator
+* \param[in] deallocate  function pointer called with a buffer previously returned by allocate, and its size
+* \param[in] user        auxiliary data the user wishes to receive together with every allocator call
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_processing_block_frame_allocator(rs2_processing_block* block, rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void* user, rs2_error** error);
+
+/**
+* Provide the memory for the frame buffers published by the processing block
+* \param[in] block       Processing block
+* \param[in] allocator   allocator object created from c++ application, or null to restore the default allocator. ownership over the allocator object is moved into the block
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_processing_block_frame_allocator_cpp(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error);
+
 /**
 * This method is used to pass frame into a processing block
 * \param[in] block          Processing block
@@ -265,6 +286,46 @@ rs2_processing_block* rs2_create_hdr_merge_processing_block(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sequence_id_filter(rs2_error** error);
 
+/**
+* Creates a depth post-processing block running the recommended sequence of filters - decimation, depth to disparity,
+* spatial, temporal and disparity to depth - on stereo depth frames in a single pass, with one output frame allocation.
+* The options of the individual filters are exposed by the block, and the output matches that of the separate blocks
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_depth_filter_chain_block(rs2_error** error);
+
+/**
+* Creates a multi-device syncer processing block. The block matches the frames of several devices into framesets,
+* by their timestamps once mapped onto the host clock: global time frames are, and hardware clock frames are mapped
+* by the time_diff_keeper of their device when it runs. The frames of a set are within RS2_OPTION_SYNC_TOLERANCE of
+* each other, and RS2_OPTION_SYNC_QUEUE_SIZE bounds the frames buffered per stream
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error);
+
+/** \brief Synchronization metrics of a device, as seen by the multi-device syncer */
+typedef struct rs2_sync_device_metrics
+{
+    char serial_number[32];             /**< Serial number of the device, empty when it does not report one */
+    int is_reference;                   /**< Non-zero for the device the offsets are relative to: the first one frames were received from */
+    int on_host_clock;                  /**< Non-zero when the last frame of the device was on the host clock. Otherwise it was matched by its arrival time */
+    double clock_drift_ppm;             /**< Drift of the host clock relative to the device clock, as estimated by the time_diff_keeper of the device. 0 when it does not run */
+    double offset_ms;                   /**< Smoothed difference between the timestamps of the frames of the device and those of the reference device in the emitted sets */
+    double offset_drift_ppm;            /**< Rate at which offset_ms changes, in microseconds per second, over the last emitted sets */
+    unsigned long long frames_matched;  /**< Number of frames of the device emitted in sets */
+    unsigned long long frames_dropped;  /**< Number of frames of the device dropped: unmatched, beyond the queue size or of streams that stopped */
+} rs2_sync_device_metrics;
+
+/**
+* Retrieve the synchronization metrics of the devices a multi-device syncer received frames from
+* \param[in] block     a multi-device syncer
+* \param[out] metrics  receives the metrics of the first count devices, in the order frames were first received from them
+* \param[in] count     the size of metrics
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return              the number of devices
+*/
+int rs2_get_multi_device_sync_metrics(rs2_processing_block* block, rs2_sync_device_metrics* metrics, int count, rs2_error** error);
+
 /**
 * Retrieve processing block specific information, like name.
 * \param[in]  block     The processing block
@@ -27,6 +27,26 @@ typedef enum rs2_playback_status
 
 const char* rs2_playback_status_to_string(rs2_playback_status status);
 
+/** \brief What a recording device does with a frame arriving while its write queue is full */
+typedef enum rs2_record_queue_policy
+{
+    RS2_RECORD_QUEUE_POLICY_DROP_NEWEST, /**< The frame is not recorded, and counted as dropped */
+    RS2_RECORD_QUEUE_POLICY_BLOCK,       /**< The sensor callback waits until the frame fits in the queue, holding back the frames that follow it */
+    RS2_RECORD_QUEUE_POLICY_COUNT
+} rs2_record_queue_policy;
+
+const char* rs2_record_queue_policy_to_string(rs2_record_queue_policy policy);
+
+/** \brief Counters of the write queue of a recording device */
+typedef struct rs2_record_statistics
+{
+    unsigned long long queued_bytes;   /**< Size of the frame data waiting to be written */
+    unsigned long long dropped_frames; /**< Number of frames dropped because the queue was full */
+    unsigned long long written_frames; /**< Number of frames written to the file */
+    float average_write_latency;       /**< Average time from the arrival of a frame to the end of its write, in milliseconds */
+    float max_write_latency;           /**< Longest time from the arrival of a frame to the end of its write, in milliseconds */
+} rs2_record_statistics;
+
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
 /**
@@ -48,6 +68,29 @@ rs2_device* rs2_create_record_device(const rs2_device* device, const char* file,
 */
 rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error);
 
+/**
+* Creates a recording device with a bounded write queue.
+* Frames are serialized by the given number of threads, and written to the file in the order they arrived
+* \param[in]  device                The device to record
+* \param[in]  file                  The desired path to which the recorder should save the data
+* \param[in]  compression_enabled   Indicates if compression is enabled, 0 means false, otherwise true
+* \param[in]  max_queued_bytes      Budget for the frame data waiting to be written, 0 for no limit
+* \param[in]  policy                What to do with a frame that does not fit in the budget
+* \param[in]  serialization_threads Number of threads serializing frames ahead of the writing thread, 0 to serialize on the writing thread
+* \param[out] error                 If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return A pointer to a device that records its data to file, or null in case of failure
+*/
+rs2_device* rs2_create_record_device_with_queue(const rs2_device* device, const char* file, int compression_enabled,
+    unsigned long long max_queued_bytes, rs2_record_queue_policy policy, int serialization_threads, rs2_error** error);
+
+/**
+* Gets the counters of the write queue of the recording device
+* \param[in]  device      A recording device
+* \param[out] statistics  The queued bytes, dropped and written frames, and write latency of the recording
+* \param[out] error       If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* statistics, rs2_error** error);
+
 /**
 * Pause the recording device without stopping the actual device from streaming.
 * Pausing will cause the device to stop writing new data to the file, in particular, frames and changes to extensions
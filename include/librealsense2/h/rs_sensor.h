@@ -246,6 +246,27 @@ void rs2_start(const rs2_sensor* sensor, rs2_frame_callback_ptr on_frame, void*
 */
 void rs2_start_cpp(const rs2_sensor* sensor, rs2_frame_callback* callback, rs2_error** error);
 
+/**
+* Provide the memory for the frame buffers published by the sensor.
+* Every video, depth and disparity frame the sensor allocates from now on is placed in memory obtained from allocate.
+* The memory is handed back through deallocate once the last reference to the frame is released.
+* If allocate returns null, the frame falls back to internally allocated memory
+* \param[in] sensor      RealSense sensor
+* \param[in] allocate    function pointer returning a buffer of at least the requested size. Pass null to restore the default allocator
+* \param[in] deallocate  function pointer called with a buffer previously returned by allocate, and its size
+* \param[in] user        auxiliary data the user wishes to receive together with every allocator call
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void* user, rs2_error** error);
+
+/**
+* Provide the memory for the frame buffers published by the sensor
+* \param[in] sensor      RealSense sensor
+* \param[in] allocator   allocator object created from c++ application, or null to restore the default allocator. ownership over the allocator object is moved into the sensor
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error);
+
 /**
 * start streaming from specified configured sensor of specific stream to frame queue
 * \param[in] sensor  RealSense Sensor
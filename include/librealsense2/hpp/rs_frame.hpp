@@ -166,6 +166,32 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Retrieve the latency histogram of the frames of this stream for a stage of the pipeline.
+        * Bin i counts the frames that went through the stage between i and i+1 RS2_LATENCY_HISTOGRAM_BIN_WIDTH
+        * milliseconds after the earliest stage they were stamped at.
+        * \param[in] stage - the stage of interest.
+        * \return std::vector<unsigned long long> - the RS2_LATENCY_HISTOGRAM_BINS counts.
+        */
+        std::vector<unsigned long long> get_latency_histogram(rs2_frame_trace_stage stage) const
+        {
+            rs2_error* e = nullptr;
+            std::vector<unsigned long long> bins(RS2_LATENCY_HISTOGRAM_BINS);
+            rs2_get_latency_histogram(get(), stage, bins.data(), static_cast<int>(bins.size()), &e);
+            error::handle(e);
+            return bins;
+        }
+
+        /**
+        * Clear the latency histograms of this stream.
+        */
+        void reset_latency_histogram() const
+        {
+            rs2_error* e = nullptr;
+            rs2_reset_latency_histogram(get(), &e);
+            error::handle(e);
+        }
+
         bool is_cloned() { return bool(_clone); }
         explicit stream_profile(const rs2_stream_profile* profile) : _profile(profile)
         {
@@ -495,6 +521,19 @@ namespace rs2
             return r;
         }
 
+        /**
+        * retrieve the time at which the frame went through a stage of the pipeline
+        * \param[in] stage   the stage of interest
+        * \return            the system time of the stage in milliseconds, or 0 if the frame did not go through it
+        */
+        rs2_time_t get_frame_trace(rs2_frame_trace_stage stage) const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_trace(frame_ref, stage, &e);
+            error::handle(e);
+            return r;
+        }
+
         /** determine if the device allows a specific metadata to be queried
         * \param[in] frame_metadata  the frame_metadata to check for support
         * \return            true if the frame_metadata can be queried
@@ -774,6 +813,18 @@ namespace rs2
             return (const texture_coordinate*)res;
         }
 
+        /**
+        * Retrieve the index of the depth pixel of each vertex, when the pointcloud emits only the vertices with depth
+        * \return const int* - pointer of indices, or nullptr when there is a vertex per depth pixel
+        */
+        const int* get_indices() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_get_frame_points_indices(get(), &e);
+            error::handle(e);
+            return res;
+        }
+
         size_t size() const
         {
             return _size;
@@ -1145,5 +1196,26 @@ namespace rs2
 
         void release() override { delete this; }
     };
+
+    template<class A, class D>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;
+        D deallocate_function;
+    public:
+        frame_allocator(A allocate, D deallocate) : allocate_function(allocate), deallocate_function(deallocate) {}
+
+        void* allocate(int size) override
+        {
+            return allocate_function(size);
+        }
+
+        void deallocate(void* ptr, int size) override
+        {
+            deallocate_function(ptr, size);
+        }
+
+        void release() override { delete this; }
+    };
 }
 #endif // LIBREALSENSE_RS2_FRAME_HPP
@@ -148,6 +148,18 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Inject video frame into the sensor, letting processing blocks write over its pixels
+        *
+        * \param[in] frame   all the parameters that required to define video frame
+        */
+        void on_writable_video_frame(rs2_software_video_frame frame)
+        {
+            rs2_error* e = nullptr;
+            rs2_software_sensor_on_writable_video_frame(_sensor.get(), frame, &e);
+            error::handle(e);
+        }
+
         /**
         * Inject motion frame into the sensor
         *
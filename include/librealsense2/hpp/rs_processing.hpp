@@ -259,6 +259,29 @@ namespace rs2
             start(on_frame);
             return on_frame;
         }
+        /**
+        * Place the frames published by the processing block in user-provided memory
+        * \param[in] allocate    callable returning a buffer of at least the requested size: void*(int). Returning nullptr falls back to the default allocation
+        * \param[in] deallocate  callable receiving a buffer previously returned by allocate, once its frame is released: void(void*, int)
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate)
+        {
+            rs2_error* e = nullptr;
+            rs2_set_processing_block_frame_allocator_cpp(get(), new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Restore the default allocation of frame buffers
+        */
+        void reset_frame_allocator()
+        {
+            rs2_error* e = nullptr;
+            rs2_set_processing_block_frame_allocator_cpp(get(), nullptr, &e);
+            error::handle(e);
+        }
+
         /**
         * Ask processing block to process the frame
         *
@@ -658,6 +681,85 @@ namespace rs2
         frame_queue _results;
     };
 
+    class multi_device_syncer : public processing_block
+    {
+    public:
+        /**
+        * Sync instance matching the frames of several devices by their timestamps on the host clock. Pass it the
+        * frames, or framesets, of all the devices. See rs2_create_multi_device_sync_processing_block
+        * \param[in] queue_size   Number of framesets kept for the application
+        */
+        multi_device_syncer(int queue_size = 1)
+            : processing_block(init()), _results(queue_size)
+        {
+            start(_results);
+        }
+
+        /**
+        * Wait until coherent set of frames becomes available
+        * \param[in] timeout_ms   Max time in milliseconds to wait until an exception will be thrown
+        * \return Set of coherent frames
+        */
+        frameset wait_for_frames(unsigned int timeout_ms = 5000) const
+        {
+            return frameset(_results.wait_for_frame(timeout_ms));
+        }
+
+        /**
+        * Check if a coherent set of frames is available
+        * \param[out] fs      New coherent frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool poll_for_frames(frameset* fs) const
+        {
+            frame result;
+            if (_results.poll_for_frame(&result))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+        * Retrieve the synchronization metrics of the devices frames were received from: their clock drift,
+        * and the offset of their frames to those of the first device
+        * \return the metrics of the devices, in the order frames were first received from them
+        */
+        std::vector<rs2_sync_device_metrics> get_metrics() const
+        {
+            rs2_error* e = nullptr;
+            std::vector<rs2_sync_device_metrics> metrics;
+            int count = 0;
+            do
+            {
+                metrics.resize(count);
+                count = rs2_get_multi_device_sync_metrics(get(), metrics.data(), static_cast<int>(metrics.size()), &e);
+                error::handle(e);
+            } while (count > static_cast<int>(metrics.size()));
+            metrics.resize(count);
+            return metrics;
+        }
+
+        void operator()(frame f) const
+        {
+            invoke(std::move(f));
+        }
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_multi_device_sync_processing_block(&e),
+                rs2_delete_processing_block);
+
+            error::handle(e);
+            return block;
+        }
+
+        frame_queue _results;
+    };
+
     /**
     Auxiliary processing block that performs image alignment using depth data and camera calibration
     */
@@ -1179,5 +1281,30 @@ namespace rs2
             return block;
         }
     };
+
+    class depth_filter_chain : public filter
+    {
+    public:
+        /**
+        * Create a block running decimation, depth to disparity, spatial, temporal and disparity to depth
+        * on stereo depth frames in a single pass. The options of the individual filters are set on this block:
+        * RS2_OPTION_FILTER_MAGNITUDE, shared by the decimation and spatial filters, applies to both
+        */
+        depth_filter_chain() : filter(init(), 1) {}
+
+    private:
+        friend class context;
+
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_filter_chain_block(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
 }
 #endif // LIBREALSENSE_RS2_PROCESSING_HPP
@@ -234,6 +234,25 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Creates a recording device with a bounded write queue, to record the given device and save it to the given file as rosbag format
+        * \param[in]  file                  The desired path to which the recorder should save the data
+        * \param[in]  device                The device to record
+        * \param[in]  compression_enabled   Indicates if compression is enabled
+        * \param[in]  max_queued_bytes      Budget for the frame data waiting to be written, 0 for no limit
+        * \param[in]  policy                What to do with a frame that does not fit in the budget
+        * \param[in]  serialization_threads Number of threads serializing frames ahead of the writing thread
+        */
+        recorder(const std::string& file, rs2::device dev, bool compression_enabled, unsigned long long max_queued_bytes,
+                 rs2_record_queue_policy policy, int serialization_threads)
+        {
+            rs2_error* e = nullptr;
+            _dev = std::shared_ptr<rs2_device>(
+                rs2_create_record_device_with_queue(dev.get().get(), file.c_str(), compression_enabled,
+                                                    max_queued_bytes, policy, serialization_threads, &e),
+                rs2_delete_device);
+            rs2::error::handle(e);
+        }
 
         /**
         * Pause the recording device without stopping the actual device from streaming.
@@ -266,6 +285,19 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Gets the counters of the write queue of the recorder
+        * \return The queued bytes, dropped and written frames, and write latency of the recording
+        */
+        rs2_record_statistics get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_record_statistics statistics;
+            rs2_record_device_get_statistics(_dev.get(), &statistics, &e);
+            error::handle(e);
+            return statistics;
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
@@ -189,6 +189,29 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Place the frames published by the sensor in user-provided memory
+        * \param[in] allocate    callable returning a buffer of at least the requested size: void*(int). Returning nullptr falls back to the default allocation
+        * \param[in] deallocate  callable receiving a buffer previously returned by allocate, once its frame is released: void(void*, int)
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Restore the default allocation of frame buffers
+        */
+        void reset_frame_allocator() const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), nullptr, &e);
+            error::handle(e);
+        }
+
         /**
         * stop streaming
         */
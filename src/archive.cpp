@@ -51,16 +51,36 @@ namespace librealsense
         auto video_stream_profile = dynamic_cast<video_stream_profile_interface*>(stream_profile);
         if (!video_stream_profile)
             throw librealsense::invalid_value_exception("stream must be video stream");
-        const auto vertices = get_vertices();
-        const auto texcoords = get_texture_coordinates();
+        auto vertices = get_vertices();
+        auto texcoords = get_texture_coordinates();
+        auto vertex_count = get_vertex_count();
+
+        // The faces are found on the pixel grid, so put the vertices of a compacted frame back on it
+        std::vector<float3> grid_vertices;
+        std::vector<float2> grid_texcoords;
+        if (auto indices = get_vertex_indices())
+        {
+            auto pixels = size_t(video_stream_profile->get_width()) * video_stream_profile->get_height();
+            grid_vertices.assign(pixels, float3{ 0, 0, 0 });
+            grid_texcoords.assign(pixels, float2{ 0, 0 });
+            for (size_t i = 0; i < vertex_count; ++i)
+            {
+                grid_vertices[indices[i]] = vertices[i];
+                grid_texcoords[indices[i]] = texcoords[i];
+            }
+            vertices = grid_vertices.data();
+            texcoords = grid_texcoords.data();
+            vertex_count = pixels;
+        }
+
         std::vector<float3> new_vertices;
         std::vector<std::tuple<uint8_t, uint8_t, uint8_t>> new_tex;
         std::map<int, int> index2reducedIndex;
 
-        new_vertices.reserve(get_vertex_count());
-        new_tex.reserve(get_vertex_count());
-        assert(get_vertex_count());
-        for (size_t i = 0; i < get_vertex_count(); ++i)
+        new_vertices.reserve(vertex_count);
+        new_tex.reserve(vertex_count);
+        assert(vertex_count);
+        for (size_t i = 0; i < vertex_count; ++i)
             if (fabs(vertices[i].x) >= MIN_DISTANCE || fabs(vertices[i].y) >= MIN_DISTANCE ||
                 fabs(vertices[i].z) >= MIN_DISTANCE)
             {
@@ -139,47 +159,73 @@ namespace librealsense
         }
     }
 
+    size_t points::get_capacity() const
+    {
+        return data.size() / (sizeof(float3) + sizeof(int2) + (_indexed ? sizeof(int) : 0));
+    }
+
     size_t points::get_vertex_count() const
     {
-        return data.size() / (sizeof(float3) + sizeof(int2));
+        return _indexed ? _vertex_count : get_capacity();
     }
 
     float2* points::get_texture_coordinates()
     {
         get_frame_data(); // call GetData to ensure data is in main memory
         auto xyz = (float3*)data.data();
-        auto ijs = (float2*)(xyz + get_vertex_count());
+        auto ijs = (float2*)(xyz + get_capacity());
         return ijs;
     }
 
+    void points::set_indexed()
+    {
+        _indexed = true;
+        _vertex_count = get_capacity();
+    }
+
+    int* points::get_vertex_indices()
+    {
+        if (!_indexed)
+            return nullptr;
+        return (int*)(get_texture_coordinates() + get_capacity());
+    }
+
+    void points::set_vertex_count(size_t count)
+    {
+        if (!_indexed || count > get_capacity())
+            throw invalid_value_exception("points frame has no room for the vertex count");
+        _vertex_count = count;
+    }
+
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
         std::atomic<uint32_t>* in_max_frame_queue_size,
+        std::atomic<uint32_t>* in_pool_watermark,
         std::shared_ptr<platform::time_service> ts,
         std::shared_ptr<metadata_parser_map> parsers)
     {
         switch (type)
         {
         case RS2_EXTENSION_VIDEO_FRAME:
-            return std::make_shared<frame_archive<video_frame>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<video_frame>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         case RS2_EXTENSION_COMPOSITE_FRAME:
-            return std::make_shared<frame_archive<composite_frame>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<composite_frame>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         case RS2_EXTENSION_MOTION_FRAME:
-            return std::make_shared<frame_archive<motion_frame>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<motion_frame>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         case RS2_EXTENSION_POINTS:
-            return std::make_shared<frame_archive<points>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<points>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         case RS2_EXTENSION_DEPTH_FRAME:
-            return std::make_shared<frame_archive<depth_frame>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<depth_frame>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         case RS2_EXTENSION_POSE_FRAME:
-            return std::make_shared<frame_archive<pose_frame>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<pose_frame>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         case RS2_EXTENSION_DISPARITY_FRAME:
-            return std::make_shared<frame_archive<disparity_frame>>(in_max_frame_queue_size, ts, parsers);
+            return std::make_shared<frame_archive<disparity_frame>>(in_max_frame_queue_size, in_pool_watermark, ts, parsers);
 
         default:
             throw std::runtime_error("Requested frame type is not supported!");
@@ -242,12 +288,14 @@ namespace librealsense
 
     int frame::get_frame_data_size() const
     {
+        if (external_data.data)
+            return static_cast<int>(external_data.size);
         return data.size();
     }
 
     const byte* frame::get_frame_data() const
     {
-        const byte* frame_data = data.data();
+        const byte* frame_data = external_data.data ? external_data.data : data.data();
 
         if (on_release.get_data())
         {
@@ -287,9 +335,20 @@ namespace librealsense
         return additional_data.frame_callback_started;
     }
 
+    rs2_time_t frame::get_frame_trace(rs2_frame_trace_stage stage) const
+    {
+        return additional_data.trace[stage];
+    }
+
+    void frame::update_frame_trace(rs2_frame_trace_stage stage, rs2_time_t ts)
+    {
+        additional_data.trace[stage] = ts;
+    }
+
     void frame::log_callback_start(rs2_time_t timestamp)
     {
         update_frame_callback_start_ts(timestamp);
+        update_frame_trace(RS2_FRAME_TRACE_STAGE_USER_CALLBACK_START, timestamp);
         LOG_DEBUG("CallbackStarted," << std::dec << librealsense::get_string(get_stream()->get_stream_type()) << "," << get_frame_number() << ",DispatchedAt," << std::fixed << timestamp);
     }
 
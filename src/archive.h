@@ -5,6 +5,7 @@
 
 #include "types.h"
 #include "core/streaming.h"
+#include "frame-buffer-pool.h"
 #include <atomic>
 #include <array>
 #include <math.h>
@@ -40,6 +41,7 @@ namespace librealsense
                                                  // if the recorder was configured to realtime mode or not
                                                  // if true, this will force any queue receiving this frame not to drop it
         uint32_t            raw_size = 0;   // The frame transmitted size (payload only)
+        frame_trace         trace = {};
 
         frame_additional_data() {}
 
@@ -63,6 +65,8 @@ namespace librealsense
             is_blocking(in_is_blocking),
             raw_size(transmitted_size)
         {
+            trace[RS2_FRAME_TRACE_STAGE_KERNEL_DEQUEUE] = backend_time;
+            trace[RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK] = in_system_time;
             // Copy up to 255 bytes to preserve metadata as raw data
             if (metadata_size)
                 std::copy(md_buf, md_buf + std::min(md_size, MAX_META_DATA_SIZE), metadata_blob.begin());
@@ -78,6 +82,10 @@ namespace librealsense
 
         virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
 
+        virtual frame_pool_stats get_pool_stats() const = 0;
+
+        virtual void set_frame_allocator(frame_allocator_ptr allocator) = 0;
+
         virtual void flush() = 0;
 
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
@@ -88,14 +96,42 @@ namespace librealsense
 
     std::shared_ptr<archive_interface> make_archive(rs2_extension type,
         std::atomic<uint32_t>* in_max_frame_queue_size,
+        std::atomic<uint32_t>* in_pool_watermark,
         std::shared_ptr<platform::time_service> ts,
         std::shared_ptr<metadata_parser_map> parsers);
 
+    // Frame data placed in memory obtained from a user-supplied frame allocator, or borrowed from the user
+    // (software sensor frames). The memory goes back to the allocator, or to the deleter of the borrowed
+    // buffer, together with the frame that holds it: exactly once, as the buffer is moved with the frame
+    struct external_frame_buffer
+    {
+        byte* data = nullptr;
+        size_t size = 0;
+        frame_allocator_ptr allocator;
+        void(*deleter)(void*) = nullptr;
+        // The owner of a borrowed buffer lets processing blocks write their output over it
+        bool writable = false;
+
+        void reset()
+        {
+            if (data && allocator)
+                allocator->deallocate(data, static_cast<int>(size));
+            else if (data && deleter)
+                deleter(data);
+            data = nullptr;
+            size = 0;
+            allocator.reset();
+            deleter = nullptr;
+            writable = false;
+        }
+    };
+
     // Define a movable but explicitly noncopyable buffer type to hold our frame data
     class LRS_EXTENSION_API frame : public frame_interface
     {
     public:
         std::vector<byte> data;
+        external_frame_buffer external_data; // when set, takes the place of data
         frame_additional_data additional_data;
         std::shared_ptr<metadata_parser_map> metadata_parsers = nullptr;
         explicit frame() : ref_count(0), owner(nullptr), on_release(),_kept(false) {}
@@ -112,6 +148,9 @@ namespace librealsense
         frame& operator=(frame&& r)
         {
             data = move(r.data);
+            external_data.reset();
+            external_data = std::move(r.external_data);
+            r.external_data = {};
             owner = r.owner;
             ref_count = r.ref_count.exchange(0);
             _kept = r._kept.exchange(false);
@@ -123,7 +162,7 @@ namespace librealsense
             return *this;
         }
 
-        virtual ~frame() { on_release.reset(); }
+        virtual ~frame() { on_release.reset(); external_data.reset(); }
         rs2_metadata_type get_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
         bool supports_frame_metadata(const rs2_frame_metadata_value& frame_metadata) const override;
         int get_frame_data_size() const override;
@@ -144,6 +183,8 @@ namespace librealsense
 
         rs2_time_t get_frame_callback_start_time_point() const override;
         void update_frame_callback_start_ts(rs2_time_t ts) override;
+        rs2_time_t get_frame_trace(rs2_frame_trace_stage stage) const override;
+        void update_frame_trace(rs2_frame_trace_stage stage, rs2_time_t ts) override;
 
         void acquire() override { ref_count.fetch_add(1); }
         void release() override;
@@ -187,6 +228,18 @@ namespace librealsense
         void export_to_ply(const std::string& fname, const frame_holder& texture);
         size_t get_vertex_count() const;
         float2* get_texture_coordinates();
+
+        // Indexed frames have room for a depth pixel index per vertex, and may hold fewer vertices than
+        // pixels (see RS2_OPTION_COMPACT_POINTS). Other frames hold a vertex per pixel, and no indices
+        void set_indexed();
+        int* get_vertex_indices();
+        void set_vertex_count(size_t count);
+
+    private:
+        size_t get_capacity() const;
+
+        bool _indexed = false;
+        size_t _vertex_count = 0;
     };
 
     MAP_EXTENSION(RS2_EXTENSION_POINTS, librealsense::points);
@@ -259,6 +312,18 @@ namespace librealsense
         {
             return first()->get_frame_system_time();
         }
+        rs2_time_t get_frame_trace(rs2_frame_trace_stage stage) const override
+        {
+            return first()->get_frame_trace(stage);
+        }
+        // The stages the frameset goes through are those of each of its frames
+        void update_frame_trace(rs2_frame_trace_stage stage, rs2_time_t ts) override
+        {
+            auto frames = get_frames();
+            for (size_t i = 0; i < get_embedded_frames_count(); i++)
+                if (frames[i]) frames[i]->update_frame_trace(stage, ts);
+            frame::update_frame_trace(stage, ts);
+        }
         std::shared_ptr<sensor_interface> get_sensor() const override
         {
             return first()->get_sensor();
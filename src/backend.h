@@ -29,6 +29,7 @@
 
 const uint16_t MAX_RETRIES                = 100;
 const uint8_t  DEFAULT_V4L2_FRAME_BUFFERS = 4;
+const uint8_t  MAX_V4L2_FRAME_BUFFERS     = 16;
 const uint16_t DELAY_FOR_RETRIES          = 50;
 
 const uint8_t MAX_META_DATA_SIZE          = 0xff; // UVC Metadata total length
@@ -372,6 +373,10 @@ namespace librealsense
             virtual std::string get_device_location() const = 0;
             virtual usb_spec  get_usb_specification() const = 0;
 
+            // True when frame pixels stay valid until the frame continuation is invoked,
+            // so that frames can be published without copying them out of the capture buffers
+            virtual bool supports_zero_copy() const { return false; }
+
             virtual ~uvc_device() = default;
 
         protected:
@@ -497,6 +502,11 @@ namespace librealsense
                 return _dev->get_usb_specification();
             }
 
+            bool supports_zero_copy() const override
+            {
+                return _dev->supports_zero_copy();
+            }
+
             void lock() const override { _dev->lock(); }
             void unlock() const override { _dev->unlock(); }
 
@@ -759,6 +769,11 @@ namespace librealsense
                 return _dev.front()->get_usb_specification();
             }
 
+            bool supports_zero_copy() const override
+            {
+                return _dev.front()->supports_zero_copy();
+            }
+
             void lock() const override
             {
                 std::vector<uvc_device*> locked_dev;
@@ -15,7 +15,7 @@ std::shared_ptr<ICompression> CompressionFactory::getObject(int t_width, int t_h
     }
     else if(t_streamType == RS2_STREAM_DEPTH)
     {
-        zipMeth = ZipMethod::lz;
+        zipMeth = ZipMethod::rvl;
     }
     if(!isCompressionSupported(t_format, t_streamType))
     {
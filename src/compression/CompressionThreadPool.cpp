@@ -0,0 +1,92 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "CompressionThreadPool.h"
+#include <algorithm>
+
+CompressionThreadPool& CompressionThreadPool::getInstance()
+{
+    static CompressionThreadPool pool(std::max(1, int(std::thread::hardware_concurrency()) - 1));
+    return pool;
+}
+
+CompressionThreadPool::CompressionThreadPool(int t_threads)
+{
+    for(int i = 0; i < t_threads; i++)
+    {
+        m_threads.emplace_back([this]() { run(); });
+    }
+}
+
+CompressionThreadPool::~CompressionThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    for(auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void CompressionThreadPool::parallelFor(int t_count, const std::function<void(int)>& t_fn)
+{
+    if(t_count <= 1 || m_threads.empty())
+    {
+        for(int i = 0; i < t_count; i++)
+        {
+            t_fn(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> call(m_callMutex);
+    std::unique_lock<std::mutex> lk(m_mutex);
+    m_fn = &t_fn;
+    m_count = t_count;
+    m_next = 0;
+    m_pending = t_count;
+    m_generation++;
+    m_workAvailable.notify_all();
+
+    // Take a share of the work, then wait for the calls the threads took
+    while(m_next < m_count)
+    {
+        int i = m_next++;
+        lk.unlock();
+        t_fn(i);
+        lk.lock();
+        m_pending--;
+    }
+    m_workDone.wait(lk, [this]() { return m_pending == 0; });
+    m_fn = nullptr;
+}
+
+void CompressionThreadPool::run()
+{
+    unsigned long long generation = 0;
+    std::unique_lock<std::mutex> lk(m_mutex);
+    while(true)
+    {
+        m_workAvailable.wait(lk, [&]() { return m_stopping || (m_generation != generation && m_next < m_count); });
+        if(m_stopping)
+        {
+            return;
+        }
+        while(m_fn && m_next < m_count)
+        {
+            int i = m_next++;
+            auto fn = m_fn;
+            lk.unlock();
+            (*fn)(i);
+            lk.lock();
+            if(--m_pending == 0)
+            {
+                m_workDone.notify_all();
+            }
+        }
+        generation = m_generation;
+    }
+}
@@ -0,0 +1,35 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads shared by the codecs to process the independent parts of a frame (e.g. the row bands of RVL)
+class CompressionThreadPool
+{
+public:
+    static CompressionThreadPool& getInstance();
+    ~CompressionThreadPool();
+
+    // Call t_fn(i) for i in [0, t_count), on the threads of the pool and the calling thread, and return
+    // once all calls are done
+    void parallelFor(int t_count, const std::function<void(int)>& t_fn);
+
+private:
+    explicit CompressionThreadPool(int t_threads);
+    void run();
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable, m_workDone;
+    const std::function<void(int)>* m_fn = nullptr;
+    int m_count = 0, m_next = 0, m_pending = 0;
+    unsigned long long m_generation = 0;
+    bool m_stopping = false;
+    std::mutex m_callMutex; // One parallelFor at a time, the others wait for it
+};
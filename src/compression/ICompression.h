@@ -7,6 +7,15 @@
 
 #include <librealsense2/rs.hpp>
 
+// First byte of the compressed depth payloads, identifying the codec and layout the server used, so that
+// the client rejects the payloads it cannot decode instead of misreading them
+enum class CompressionVersion : unsigned char
+{
+    lz4 = 1,      // LZ4 of the frame
+    lz4Delta = 2, // LZ4 of the differences of the 16-bit pixels to their left neighbour
+    rvlBands = 3, // RVL of bands of rows, coded independently of each other
+};
+
 class ICompression
 {
 public:
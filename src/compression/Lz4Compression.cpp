@@ -2,10 +2,43 @@
 // Copyright(c) 2020 Intel Corporation. All Rights Reserved.
 
 #include "Lz4Compression.h"
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
 #include <ipDeviceCommon/Statistic.h>
 
+namespace
+{
+    // Row by row, as the first pixel of a row is unrelated to the last one of the previous row
+    void toDeltas(const uint16_t* t_pixels, int t_width, int t_count, uint16_t* t_deltas)
+    {
+        for(int row = 0; row < t_count; row += t_width)
+        {
+            int end = std::min(row + t_width, t_count);
+            uint16_t previous = 0;
+            for(int i = row; i < end; i++)
+            {
+                t_deltas[i] = uint16_t(t_pixels[i] - previous);
+                previous = t_pixels[i];
+            }
+        }
+    }
+
+    void fromDeltas(uint16_t* t_pixels, int t_width, int t_count)
+    {
+        for(int row = 0; row < t_count; row += t_width)
+        {
+            int end = std::min(row + t_width, t_count);
+            uint16_t previous = 0;
+            for(int i = row; i < end; i++)
+            {
+                previous = t_pixels[i] = uint16_t(t_pixels[i] + previous);
+            }
+        }
+    }
+}
+
 Lz4Compression::Lz4Compression(int t_width, int t_height, rs2_format t_format, int t_bpp)
     :ICompression(t_width, t_height, t_format, t_bpp)
 {
@@ -13,13 +46,25 @@ Lz4Compression::Lz4Compression(int t_width, int t_height, rs2_format t_format, i
 
 int Lz4Compression::compressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_compressedBuf)
 {
+    CompressionVersion version = CompressionVersion::lz4;
+    const char* source = (const char*)t_buffer;
+    if(m_bpp == 2 && m_width > 0)
+    {
+        m_deltas.resize(t_size / 2);
+        toDeltas((const uint16_t*)t_buffer, m_width, int(m_deltas.size()), m_deltas.data());
+        version = CompressionVersion::lz4Delta;
+        source = (const char*)m_deltas.data();
+    }
+    unsigned char* payload = t_compressedBuf + sizeof(int);
+    payload[0] = (unsigned char)version;
     const int maxDstSize = LZ4_compressBound(t_size);
-    const int compressedSize = LZ4_compress_default((const char*)t_buffer, (char*)t_compressedBuf + sizeof(int), t_size, maxDstSize);
-    if(compressedSize <= 0)
+    const int lz4Size = LZ4_compress_default(source, (char*)payload + 1, t_size, maxDstSize);
+    if(lz4Size <= 0)
     {
         ERR << "Failure trying to compress the data.";
         return -1;
     }
+    const int compressedSize = lz4Size + 1;
     int compressWithHeaderSize = compressedSize + sizeof(compressedSize);
     if(compressWithHeaderSize > t_size)
     {
@@ -36,13 +81,22 @@ int Lz4Compression::compressBuffer(unsigned char* t_buffer, int t_size, unsigned
 
 int Lz4Compression::decompressBuffer(unsigned char* t_buffer, int t_compressedSize, unsigned char* t_uncompressedBuf)
 {
-    const int decompressed_size = LZ4_decompress_safe((const char*)t_buffer, (char*)t_uncompressedBuf, t_compressedSize, m_width * m_height * m_bpp);
+    CompressionVersion version = t_compressedSize > 0 ? CompressionVersion(t_buffer[0]) : CompressionVersion();
+    if(version != CompressionVersion::lz4 && !(version == CompressionVersion::lz4Delta && m_bpp == 2))
+    {
+        ERR << "Unsupported depth compression version " << (t_compressedSize > 0 ? int(t_buffer[0]) : -1) << ", expected lz4";
+        return -1;
+    }
+    const int decompressed_size = LZ4_decompress_safe((const char*)t_buffer + 1, (char*)t_uncompressedBuf, t_compressedSize - 1, m_width * m_height * m_bpp);
     if(decompressed_size < 0)
     {
         ERR << "Failure trying to decompress the frame.";
         return -1;
     }
-    int original_size = m_width * m_height * m_bpp;
+    if(version == CompressionVersion::lz4Delta)
+    {
+        fromDeltas((uint16_t*)t_uncompressedBuf, m_width, decompressed_size / 2);
+    }
     if(m_decompFrameCounter++ % 50 == 0)
     {
         INF << "frame " << m_decompFrameCounter << "\tdepth\tdecompression\tlz4\t" << t_compressedSize << "\t/\t" << decompressed_size;
@@ -5,11 +5,17 @@
 
 #include "ICompression.h"
 #include <lz4.h>
+#include <vector>
 
+// LZ4 coding. 16-bit frames are first replaced by the differences of their pixels to their left neighbour,
+// which are mostly small, and so more repetitive. The payload is the CompressionVersion then the LZ4 block
 class Lz4Compression : public ICompression
 {
 public:
     Lz4Compression(int t_width, int t_height, rs2_format t_format, int t_bpp);
     int compressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_compressedBuf);
     int decompressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_uncompressedBuf);
+
+private:
+    std::vector<uint16_t> m_deltas;
 };
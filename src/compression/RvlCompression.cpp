@@ -2,94 +2,257 @@
 // Copyright(c) 2020 Intel Corporation. All Rights Reserved.
 
 #include "RvlCompression.h"
-#include <cstdint>
+#include "CompressionThreadPool.h"
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <ipDeviceCommon/Statistic.h>
 
-RvlCompression::RvlCompression(int t_width, int t_height, rs2_format t_format, int t_bpp)
-    :ICompression(t_width, t_height, t_format, t_bpp)
+namespace
 {
-}
+    const int MAX_BANDS = 16;
+    const int MIN_BAND_PIXELS = 16 * 1024;
+    const int HEADER_SIZE = 4; // version, bands count and two reserved bytes
 
-int RvlCompression::encodeVLE(int t_value)
-{
-    do
-    {
-        int nibble = t_value & 0x7; // lower 3 bits
-        if(t_value >>= 3)
-            nibble |= 0x8; // more to come
-        m_word <<= 4;
-        m_word |= nibble;
-        if(++m_nibblesWritten == 8) // output word
+    // Variable-length coding of values in nibbles, the lowest 3 bits first. All but the last nibble
+    // of a value have their high bit set. The nibbles are packed from the high end of 32-bit words
+    class NibbleWriter
+    {
+    public:
+        explicit NibbleWriter(uint32_t* t_out)
+            : m_begin(t_out)
+            , m_out(t_out)
         {
-            *m_pBuffer++ = m_word;
-            m_nibblesWritten = 0;
-            m_word = 0;
         }
-    } while(t_value);
 
-    return 0;
-}
+        void writeVLE(uint32_t t_value)
+        {
+            uint64_t code = t_value & 0x7;
+            int nibbles = 1;
+            while(t_value >>= 3)
+            {
+                code = ((code | 0x8) << 4) | (t_value & 0x7);
+                nibbles++;
+            }
+            // Values hold up to 21 bits (7 nibbles), so that the pending nibbles fit in 64 bits
+            m_pending = (m_pending << (4 * nibbles)) | code;
+            m_pendingNibbles += nibbles;
+            if(m_pendingNibbles >= 8)
+            {
+                m_pendingNibbles -= 8;
+                *m_out++ = uint32_t(m_pending >> (4 * m_pendingNibbles));
+            }
+        }
 
-int RvlCompression::decodeVLE()
-{
-    unsigned int nibble;
-    int value = 0, bits = 29;
-    do
+        // Return the number of words written
+        int flush()
+        {
+            if(m_pendingNibbles)
+            {
+                *m_out++ = uint32_t(m_pending << (4 * (8 - m_pendingNibbles)));
+            }
+            return int(m_out - m_begin);
+        }
+
+    private:
+        uint32_t* m_begin;
+        uint32_t* m_out;
+        uint64_t m_pending = 0;
+        int m_pendingNibbles = 0;
+    };
+
+    class NibbleReader
     {
-        if(!m_nibblesWritten)
+    public:
+        NibbleReader(const uint32_t* t_in, const uint32_t* t_end)
+            : m_in(t_in)
+            , m_end(t_end)
         {
-            m_word = *m_pBuffer++; // load word
-            m_nibblesWritten = 8;
         }
-        nibble = m_word & 0xf0000000;
-        value |= (nibble << 1) >> bits;
-        m_word <<= 4;
-        m_nibblesWritten--;
-        bits -= 3;
-    } while(nibble & 0x80000000);
-    return value;
-}
 
-int RvlCompression::compressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_compressedBuf)
-{
-    short* buffer2 = (short*)t_buffer;
-    int* pHead = m_pBuffer = (int*)t_compressedBuf + 1;
-    m_nibblesWritten = 0;
-    short* end = buffer2 + t_size / m_bpp;
-    short previous = 0;
-    while(buffer2 != end)
-    {
-        int zeros = 0, nonzeros = 0;
-        for(; (buffer2 != end) && !*buffer2; buffer2++, zeros++)
+        // Return false past the end of the words, or on a value longer than any written
+        bool readVLE(uint32_t& t_value)
+        {
+            uint32_t value = 0, nibble;
+            int shift = 0;
+            do
+            {
+                if(!m_nibbles)
+                {
+                    if(m_in == m_end)
+                    {
+                        return false;
+                    }
+                    m_word = *m_in++;
+                    m_nibbles = 8;
+                }
+                nibble = m_word >> 28;
+                m_word <<= 4;
+                m_nibbles--;
+                value |= (nibble & 0x7) << shift;
+                shift += 3;
+            } while((nibble & 0x8) && shift < 24);
+            t_value = value;
+            return !(nibble & 0x8);
+        }
+
+    private:
+        const uint32_t* m_in;
+        const uint32_t* m_end;
+        uint32_t m_word = 0;
+        int m_nibbles = 0;
+    };
+
+    // Runs of zero and non-zero pixels are found four pixels at a time
+    const uint16_t* skipZeros(const uint16_t* t_pixels, const uint16_t* t_end)
+    {
+        uint64_t four;
+        for(; t_end - t_pixels >= 4; t_pixels += 4)
+        {
+            memcpy(&four, t_pixels, sizeof(four));
+            if(four)
+                break;
+        }
+        for(; t_pixels != t_end && !*t_pixels; t_pixels++)
             ;
-        encodeVLE(zeros);
-        for(short* p = buffer2; (p != end) && *p++; nonzeros++)
+        return t_pixels;
+    }
+
+    const uint16_t* skipNonzeros(const uint16_t* t_pixels, const uint16_t* t_end)
+    {
+        const uint64_t ones = 0x0001000100010001ULL, highs = 0x8000800080008000ULL;
+        uint64_t four;
+        for(; t_end - t_pixels >= 4; t_pixels += 4)
+        {
+            memcpy(&four, t_pixels, sizeof(four));
+            if((four - ones) & ~four & highs) // One of the four is zero
+                break;
+        }
+        for(; t_pixels != t_end && *t_pixels; t_pixels++)
             ;
-        encodeVLE(nonzeros);
-        for(int i = 0; i < nonzeros; i++)
+        return t_pixels;
+    }
+
+    // Code runs of zeros, runs of non-zeros and the differences of the non-zeros to the previous one
+    int encodeBand(const uint16_t* t_pixels, int t_count, uint32_t* t_out)
+    {
+        NibbleWriter writer(t_out);
+        const uint16_t* end = t_pixels + t_count;
+        int previous = 0;
+        while(t_pixels != end)
         {
-            short current = *buffer2++;
-            int delta = current - previous;
-            int positive = (delta << 1) ^ (delta >> 31);
-            encodeVLE(positive);
-            previous = current;
+            const uint16_t* nonzeros = skipZeros(t_pixels, end);
+            writer.writeVLE(uint32_t(nonzeros - t_pixels));
+            t_pixels = skipNonzeros(nonzeros, end);
+            writer.writeVLE(uint32_t(t_pixels - nonzeros));
+            for(; nonzeros != t_pixels; nonzeros++)
+            {
+                int delta = int(*nonzeros) - previous;
+                writer.writeVLE((uint32_t(delta) << 1) ^ uint32_t(delta >> 31));
+                previous = *nonzeros;
+            }
         }
+        return writer.flush();
+    }
+
+    bool decodeBand(const uint32_t* t_in, int t_words, uint16_t* t_pixels, int t_count)
+    {
+        NibbleReader reader(t_in, t_in + t_words);
+        uint16_t* end = t_pixels + t_count;
+        int previous = 0;
+        while(t_pixels != end)
+        {
+            uint32_t zeros, nonzeros;
+            if(!reader.readVLE(zeros) || zeros > uint32_t(end - t_pixels))
+            {
+                return false;
+            }
+            memset(t_pixels, 0, zeros * sizeof(uint16_t));
+            t_pixels += zeros;
+            if(!reader.readVLE(nonzeros) || nonzeros > uint32_t(end - t_pixels))
+            {
+                return false;
+            }
+            for(; nonzeros; nonzeros--)
+            {
+                uint32_t positive;
+                if(!reader.readVLE(positive))
+                {
+                    return false;
+                }
+                previous += int(positive >> 1) ^ -int(positive & 1);
+                *t_pixels++ = uint16_t(previous);
+            }
+        }
+        return true;
+    }
+
+    // The encoder and the decoder split a frame the same way, from its size alone
+    int bandCount(int t_width, int t_height)
+    {
+        return std::max(1, std::min({MAX_BANDS, t_height, t_width * t_height / MIN_BAND_PIXELS}));
+    }
+
+    // First pixel of a band, which starts at a row
+    int bandStart(int t_band, int t_bands, int t_width, int t_height)
+    {
+        return int((long long)t_band * t_height / t_bands) * t_width;
+    }
+}
+
+RvlCompression::RvlCompression(int t_width, int t_height, rs2_format t_format, int t_bpp)
+    :ICompression(t_width, t_height, t_format, t_bpp)
+{
+}
+
+int RvlCompression::compressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_compressedBuf)
+{
+    const uint16_t* pixels = (const uint16_t*)t_buffer;
+    int count = m_width * m_height;
+    if(t_size < count * int(sizeof(uint16_t)))
+    {
+        ERR << "Depth frame of " << t_size << " bytes is smaller than " << m_width << "x" << m_height;
+        return -1;
+    }
+    int bands = bandCount(m_width, m_height);
+    m_bands.resize(bands);
+    m_bandWords.resize(bands);
+    CompressionThreadPool::getInstance().parallelFor(bands, [&](int t_band) {
+        int start = bandStart(t_band, bands, m_width, m_height);
+        int bandPixels = bandStart(t_band + 1, bands, m_width, m_height) - start;
+        // At most 8 nibbles per pixel: a run of n pixels takes no more than n nibbles, and a difference 6
+        m_bands[t_band].resize(bandPixels + 1);
+        m_bandWords[t_band] = encodeBand(pixels + start, bandPixels, m_bands[t_band].data());
+    });
+
+    int compressedSize = HEADER_SIZE + bands * int(sizeof(uint32_t));
+    for(int words : m_bandWords)
+    {
+        compressedSize += words * int(sizeof(uint32_t));
     }
-    if(m_nibblesWritten) // last few values
-        *m_pBuffer++ = m_word << 4 * (8 - m_nibblesWritten);
-    int compressedSize = int((char*)m_pBuffer - (char*)pHead);
     int compressWithHeaderSize = compressedSize + sizeof(compressedSize);
     if(compressWithHeaderSize > t_size)
     {
         ERR << "Compression overflow, destination buffer is smaller than the compressed size";
         return -1;
     }
-    memcpy(t_compressedBuf, &compressedSize, sizeof(compressedSize));
+
+    unsigned char* payload = t_compressedBuf + sizeof(compressedSize);
+    payload[0] = (unsigned char)CompressionVersion::rvlBands;
+    payload[1] = (unsigned char)bands;
+    payload[2] = payload[3] = 0;
+    unsigned char* words = payload + HEADER_SIZE + bands * sizeof(uint32_t);
+    for(int band = 0; band < bands; band++)
+    {
+        uint32_t bandWords = m_bandWords[band];
+        memcpy(payload + HEADER_SIZE + band * sizeof(uint32_t), &bandWords, sizeof(bandWords));
+        memcpy(words, m_bands[band].data(), bandWords * sizeof(uint32_t));
+        words += bandWords * sizeof(uint32_t);
+    }
     if(m_compFrameCounter++ % 50 == 0)
     {
-        INF << "frame " << m_compFrameCounter << "\tdepth\tcompression\tlz4\t" << t_size << "\t/\t" << compressedSize;
+        INF << "frame " << m_compFrameCounter << "\tdepth\tcompression\trvl\t" << t_size << "\t/\t" << compressedSize;
     }
     memcpy(t_compressedBuf, &compressedSize, sizeof(compressedSize));
     return compressWithHeaderSize;
@@ -97,33 +260,56 @@ int RvlCompression::compressBuffer(unsigned char* t_buffer, int t_size, unsigned
 
 int RvlCompression::decompressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_uncompressedBuf)
 {
-    short* currentPtr = (short*)t_uncompressedBuf;
-    m_pBuffer = (int*)t_buffer + 1;
-    m_nibblesWritten = 0;
-    short current, previous = 0;
-    unsigned int compressedSize;
-    int numPixelsToDecode = t_size / 2;
-    while(numPixelsToDecode)
-    {
-        int zeros = decodeVLE();
-        numPixelsToDecode -= zeros;
-        for(; zeros; zeros--)
-            *currentPtr++ = 0;
-        int nonzeros = decodeVLE();
-        numPixelsToDecode -= nonzeros;
-        for(; nonzeros; nonzeros--)
+    if(t_size < HEADER_SIZE || t_buffer[0] != (unsigned char)CompressionVersion::rvlBands)
+    {
+        ERR << "Unsupported depth compression version " << (t_size > 0 ? int(t_buffer[0]) : -1) << ", expected rvl";
+        return -1;
+    }
+    int bands = t_buffer[1];
+    int headerSize = HEADER_SIZE + bands * int(sizeof(uint32_t));
+    if(bands != bandCount(m_width, m_height) || t_size < headerSize)
+    {
+        ERR << "Corrupted rvl frame header";
+        return -1;
+    }
+
+    std::vector<const uint32_t*> bandWords(bands);
+    std::vector<int> bandSizes(bands);
+    long long offset = headerSize;
+    for(int band = 0; band < bands; band++)
+    {
+        uint32_t words;
+        memcpy(&words, t_buffer + HEADER_SIZE + band * sizeof(uint32_t), sizeof(words));
+        bandWords[band] = (const uint32_t*)(t_buffer + offset);
+        bandSizes[band] = int(words);
+        offset += (long long)words * sizeof(uint32_t);
+    }
+    if(offset > t_size)
+    {
+        ERR << "Corrupted rvl frame: " << offset << " bytes of bands in a " << t_size << " bytes frame";
+        return -1;
+    }
+
+    uint16_t* pixels = (uint16_t*)t_uncompressedBuf;
+    int count = m_width * m_height;
+    std::atomic<bool> corrupted(false);
+    CompressionThreadPool::getInstance().parallelFor(bands, [&](int t_band) {
+        int start = bandStart(t_band, bands, m_width, m_height);
+        if(!decodeBand(bandWords[t_band], bandSizes[t_band], pixels + start, bandStart(t_band + 1, bands, m_width, m_height) - start))
         {
-            int positive = decodeVLE();
-            int delta = (positive >> 1) ^ -(positive & 1);
-            current = previous + delta;
-            *currentPtr++ = current;
-            previous = current;
+            corrupted = true;
         }
+    });
+    if(corrupted)
+    {
+        ERR << "Corrupted rvl frame";
+        return -1;
     }
-    int uncompressedSize = int((char*)currentPtr - (char*)t_uncompressedBuf);
+
+    int uncompressedSize = count * int(sizeof(uint16_t));
     if(m_decompFrameCounter++ % 50 == 0)
     {
-        INF << "frame " << m_decompFrameCounter << "\tdepth\tcompression\tlz4\t" << compressedSize << "\t/\t" << uncompressedSize;
+        INF << "frame " << m_decompFrameCounter << "\tdepth\tdecompression\trvl\t" << t_size << "\t/\t" << uncompressedSize;
     }
     return uncompressedSize;
 }
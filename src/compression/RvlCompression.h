@@ -4,7 +4,15 @@
 #pragma once
 
 #include "ICompression.h"
+#include <cstdint>
+#include <vector>
 
+// RVL coding of 16-bit depth. The frame is split into bands of whole rows, coded independently of each other
+// on the threads of the CompressionThreadPool. The number of bands follows from the frame size, so that the
+// decoder rejects a payload split otherwise. The payload is:
+//  - the CompressionVersion (rvlBands), the number of bands and two reserved bytes
+//  - the number of 32-bit words of each band
+//  - the words of each band
 class RvlCompression : public ICompression
 {
 public:
@@ -13,7 +21,6 @@ public:
     int decompressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_uncompressedBuf);
 
 private:
-    int encodeVLE(int value);
-    int decodeVLE();
-    int *m_pBuffer, m_word, m_nibblesWritten;
+    std::vector<std::vector<uint32_t>> m_bands;
+    std::vector<int> m_bandWords;
 };
@@ -8,6 +8,8 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <memory>
+#include <cstddef>
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -139,13 +141,230 @@ public:
     }
 };
 
+// A bounded queue with the interface and semantics of single_consumer_queue (enqueue drops the
+// oldest item when full, clear() refuses items until the next dequeue), for queues on callback
+// paths where the locking and notifications of single_consumer_queue dominate the latency.
+// Enqueue and dequeue are lock-free, and only take the mutex to wake a thread that waits.
+//
+// The ring is the bounded MPMC queue of Dmitry Vyukov: every cell holds a sequence number telling
+// producers and consumers whose turn it is. A dequeuing thread that finds the queue empty first
+// retries 'spin' times, yielding in between, and then blocks.
+// Items cannot be peeked: other producers may drop them at any time.
 template<class T>
+class lock_free_queue
+{
+    struct cell
+    {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    std::unique_ptr<cell[]> _cells;
+    const size_t _cap;
+    const unsigned int _spin;
+    std::atomic<size_t> _enqueue_pos;
+    std::atomic<size_t> _dequeue_pos;
+
+    std::mutex _mutex;
+    std::condition_variable _deq_cv;
+    std::condition_variable _enq_cv;
+    std::atomic<int> _deq_waiters;
+    std::atomic<int> _enq_waiters;
+
+    std::atomic<bool> _accepting;
+    std::atomic<bool> _need_to_flush;
+
+    bool try_push(T& item)
+    {
+        auto pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& c = _cells[pos % _cap];
+            auto seq = c.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0)
+            {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    c.item = std::move(item);
+                    c.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false; // Full
+            else
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    bool try_pop(T* item)
+    {
+        auto pos = _dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            auto& c = _cells[pos % _cap];
+            auto seq = c.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0)
+            {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    *item = std::move(c.item);
+                    c.item = T(); // Release what the item holds now, not when the cell is reused
+                    c.sequence.store(pos + _cap, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+                return false; // Empty, or the producer of the oldest item is still writing it
+            else
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    // The waiting side counts itself, then checks the queue; the other side changes the queue, then
+    // checks the count. With a full fence between the two steps on both sides, at least one of them
+    // sees the other, and taking the mutex makes sure the waiter is in wait() when notified
+    void wake(std::atomic<int>& waiters, std::condition_variable& cv)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) == 0)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        cv.notify_one();
+    }
+
+    void push_dropping_oldest(T& item)
+    {
+        while (!try_push(item))
+        {
+            T oldest;
+            if (!try_pop(&oldest))
+                std::this_thread::yield();
+        }
+        wake(_deq_waiters, _deq_cv);
+    }
+
+public:
+    explicit lock_free_queue(unsigned int cap = QUEUE_MAX_SIZE, unsigned int spin = 0)
+        : _cells(new cell[cap ? cap : 1]), _cap(cap ? cap : 1), _spin(spin), _enqueue_pos(0), _dequeue_pos(0),
+          _deq_waiters(0), _enq_waiters(0), _accepting(true), _need_to_flush(false)
+    {
+        for (size_t i = 0; i < _cap; i++)
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    void enqueue(T&& item)
+    {
+        if (_accepting)
+            push_dropping_oldest(item);
+    }
+
+    void blocking_enqueue(T&& item)
+    {
+        if (!_accepting)
+            return;
+        if (try_push(item))
+        {
+            wake(_deq_waiters, _deq_cv);
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        ++_enq_waiters;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool pushed = false;
+        _enq_cv.wait(lock, [&]() { return (pushed = try_push(item)) || _need_to_flush; });
+        --_enq_waiters;
+        lock.unlock();
+
+        // Once flushed, the item is queued as single_consumer_queue does, regardless of the capacity
+        if (pushed)
+            wake(_deq_waiters, _deq_cv);
+        else
+            push_dropping_oldest(item);
+    }
+
+    bool dequeue(T* item, unsigned int timeout_ms)
+    {
+        _accepting = true;
+        for (unsigned int i = 0; ; i++)
+        {
+            if (try_pop(item))
+            {
+                wake(_enq_waiters, _enq_cv);
+                return true;
+            }
+            if (_need_to_flush || i >= _spin)
+                break;
+            std::this_thread::yield();
+        }
+        if (_need_to_flush)
+            return false;
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        ++_deq_waiters;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool popped = false;
+        _deq_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&]() { return (popped = try_pop(item)) || _need_to_flush; });
+        --_deq_waiters;
+        lock.unlock();
+
+        if (popped)
+            wake(_enq_waiters, _enq_cv);
+        return popped;
+    }
+
+    bool try_dequeue(T* item)
+    {
+        _accepting = true;
+        if (!try_pop(item))
+            return false;
+        wake(_enq_waiters, _enq_cv);
+        return true;
+    }
+
+    void clear()
+    {
+        _accepting = false;
+        _need_to_flush = true;
+
+        T item;
+        while (try_pop(&item)) {}
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        _enq_cv.notify_all();
+        _deq_cv.notify_all();
+    }
+
+    void start()
+    {
+        _need_to_flush = false;
+        _accepting = true;
+    }
+
+    size_t size()
+    {
+        auto dequeued = _dequeue_pos.load();
+        auto enqueued = _enqueue_pos.load();
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+};
+
+// Q is single_consumer_queue<T>, or lock_free_queue<T> for queues that are never peeked
+template<class T, class Q = single_consumer_queue<T>>
 class single_consumer_frame_queue
 {
-    single_consumer_queue<T> _queue;
+    Q _queue;
 
 public:
-    single_consumer_frame_queue<T>(unsigned int cap = QUEUE_MAX_SIZE) : _queue(cap) {}
+    single_consumer_frame_queue(unsigned int cap = QUEUE_MAX_SIZE) : _queue(cap) {}
+    single_consumer_frame_queue(unsigned int cap, unsigned int spin) : _queue(cap, spin) {}
 
     void enqueue(T&& item)
     {
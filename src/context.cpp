@@ -127,6 +127,7 @@ namespace librealsense
        environment::get_instance().set_time_service(_backend->create_time_service());
 
        _device_watcher = _backend->create_device_watcher();
+       _processing_pool = processing_thread_pool::get();
     }
 
 
@@ -7,6 +7,7 @@
 #include "backend.h"
 #include "mock/recorder.h"
 #include "core/streaming.h"
+#include "proc/processing-thread-pool.h"
 
 #include <vector>
 #include <media/playback/playback_device.h>
@@ -151,6 +152,9 @@ namespace librealsense
         std::map<int, std::weak_ptr<const stream_interface>> _streams;
         std::map<int, std::map<int, std::weak_ptr<lazy<rs2_extrinsics>>>> _extrinsics;
         std::mutex _streams_mutex, _devices_changed_callbacks_mtx;
+
+        // Shared by the processing blocks that run on multiple threads
+        std::shared_ptr<processing_thread_pool> _processing_pool;
     };
 
     class readonly_device_info : public device_info
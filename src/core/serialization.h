@@ -326,6 +326,16 @@ namespace librealsense
         public:
             virtual void write_device_description(const device_snapshot& device_description) = 0;
             virtual void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) = 0;
+            /**
+            * Split write_frame in two steps, so that several frames can be serialized concurrently:
+            * prepare_frame may be called from any thread and returns the function that writes the
+            * frame, which must be called from the writing thread, in recording order
+            */
+            virtual std::function<void()> prepare_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+            {
+                auto holder = std::make_shared<frame_holder>(std::move(frame));
+                return [this, stream_id, timestamp, holder]() { write_frame(stream_id, timestamp, std::move(*holder)); };
+            }
             virtual void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
@@ -5,6 +5,7 @@
 #include "options.h"
 #include "types.h"
 #include "info.h"
+#include <array>
 #include <functional>
 
 namespace librealsense
@@ -79,6 +80,9 @@ namespace librealsense
         virtual void set_c_wrapper(rs2_stream_profile* wrapper) = 0;
     };
 
+    // System time at which a frame went through each rs2_frame_trace_stage, 0 where it did not
+    typedef std::array<rs2_time_t, RS2_FRAME_TRACE_STAGE_COUNT> frame_trace;
+
     class frame_interface : public sensor_part
     {
     public:
@@ -99,6 +103,9 @@ namespace librealsense
         virtual rs2_time_t get_frame_callback_start_time_point() const = 0;
         virtual void update_frame_callback_start_ts(rs2_time_t ts) = 0;
 
+        virtual rs2_time_t get_frame_trace(rs2_frame_trace_stage stage) const = 0;
+        virtual void update_frame_trace(rs2_frame_trace_stage stage, rs2_time_t ts) = 0;
+
         virtual void acquire() = 0;
         virtual void release() = 0;
         virtual frame_interface* publish(std::shared_ptr<archive_interface> new_owner) = 0;
@@ -237,6 +244,7 @@ namespace librealsense
         virtual void set_frames_callback(frame_callback_ptr cb) = 0;
         virtual bool is_streaming() const = 0;
         virtual device_interface& get_device() = 0;
+        virtual void set_frame_allocator(frame_allocator_ptr allocator) = 0;
 
         virtual ~sensor_interface() = default;
     };
@@ -214,6 +214,52 @@ namespace librealsense
     }
 
 
+    void latency_statistics::record(int stream_id, const frame_trace& trace)
+    {
+        rs2_time_t origin = 0;
+        for (auto t : trace)
+            if (t && (!origin || t < origin))
+                origin = t;
+        if (!origin)
+            return;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto&& h = _streams[stream_id];
+        if (!h)
+            h.reset(new histograms());
+
+        for (int stage = 0; stage < RS2_FRAME_TRACE_STAGE_COUNT; ++stage)
+        {
+            if (!trace[stage])
+                continue;
+            auto bin = std::min<double>((trace[stage] - origin) / RS2_LATENCY_HISTOGRAM_BIN_WIDTH, RS2_LATENCY_HISTOGRAM_BINS - 1);
+            ++h->bins[stage][static_cast<int>(bin)];
+            ++h->frames[stage];
+        }
+    }
+
+    unsigned long long latency_statistics::query(int stream_id, rs2_frame_trace_stage stage, unsigned long long* bins, int bins_count) const
+    {
+        _enabled = true;
+        bins_count = std::min(bins_count, RS2_LATENCY_HISTOGRAM_BINS);
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _streams.find(stream_id);
+        if (it == _streams.end())
+        {
+            std::fill(bins, bins + bins_count, 0ULL);
+            return 0;
+        }
+        std::copy(it->second->bins[stage], it->second->bins[stage] + bins_count, bins);
+        return it->second->frames[stage];
+    }
+
+    void latency_statistics::reset(int stream_id)
+    {
+        _enabled = true;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _streams.erase(stream_id);
+    }
+
     environment& environment::get_instance()
     {
         static environment env;
@@ -234,4 +280,9 @@ namespace librealsense
     {
         return _ts;
     }
+
+    latency_statistics& environment::get_latency_statistics()
+    {
+        return _latency;
+    }
 }
@@ -64,6 +64,29 @@ namespace librealsense
     };
 
 
+    // Per-stream histograms of the time each frame took to reach the stages of the pipeline, counted
+    // from the earliest stage it was stamped at. Fed with the traces of the frames as they are released,
+    // once the histograms of any stream were queried or reset: until then, releasing a frame costs no lock
+    class latency_statistics
+    {
+    public:
+        bool is_enabled() const { return _enabled; }
+        void record(int stream_id, const frame_trace& trace);
+        unsigned long long query(int stream_id, rs2_frame_trace_stage stage, unsigned long long* bins, int bins_count) const;
+        void reset(int stream_id);
+
+    private:
+        struct histograms
+        {
+            unsigned long long frames[RS2_FRAME_TRACE_STAGE_COUNT] = {};
+            unsigned long long bins[RS2_FRAME_TRACE_STAGE_COUNT][RS2_LATENCY_HISTOGRAM_BINS] = {};
+        };
+
+        mutable std::mutex _mutex;
+        std::map<int, std::unique_ptr<histograms>> _streams;
+        mutable std::atomic<bool> _enabled{ false };
+    };
+
     class environment
     {
     public:
@@ -76,6 +99,8 @@ namespace librealsense
         void set_time_service(std::shared_ptr<platform::time_service> ts);
         std::shared_ptr<platform::time_service> get_time_service();
 
+        latency_statistics& get_latency_statistics();
+
         environment(const environment&) = delete;
         environment(const environment&&) = delete;
         environment operator=(const environment&) = delete;
@@ -85,6 +110,7 @@ namespace librealsense
         extrinsics_graph _extrinsics;
         std::atomic<int> _stream_id;
         std::shared_ptr<platform::time_service> _ts;
+        latency_statistics _latency;
 
         environment(){_stream_id = 0;}
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "archive.h"
+#include "environment.h"
 
 namespace librealsense
 {
@@ -16,7 +17,8 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
+        frame_buffer_pool _buffer_pool; // frame data is returned here
+        frame_allocator_ptr _allocator; // optional, user-supplied memory for frame data
         std::atomic<bool> recycle_frames;
         int pending_frames = 0;
         std::recursive_mutex mutex;
@@ -29,35 +31,25 @@ namespace librealsense
         T alloc_frame(const size_t size, const frame_additional_data& additional_data, bool requires_memory)
         {
             T backbuffer;
-            //const size_t size = modes[stream].get_image_size(stream);
+            if (requires_memory)
             {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
+                auto allocator = std::atomic_load(&_allocator);
+                if (allocator && size)
                 {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
+                    // User memory is returned to the allocator when the frame is unpublished (see external_frame_buffer)
+                    backbuffer.external_data.data = static_cast<byte*>(allocator->allocate(static_cast<int>(size)));
+                    if (backbuffer.external_data.data)
                     {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
+                        backbuffer.external_data.size = size;
+                        backbuffer.external_data.allocator = allocator;
                     }
+                    else
+                        LOG_DEBUG("Frame allocator returned null, falling back to internal memory");
                 }
 
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
-                {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
-                }
-            }
-
-            if (requires_memory)
-            {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                // Recycled buffers already have the right size, only fresh ones are allocated (and zeroed) here
+                if (!backbuffer.external_data.data && !_buffer_pool.acquire(size, backbuffer.data))
+                    backbuffer.data.resize(size, 0);
             }
             backbuffer.additional_data = additional_data;
             return backbuffer;
@@ -84,15 +76,17 @@ namespace librealsense
             {
                 auto f = (T*)frame;
                 log_frame_callback_end(f);
+                record_frame_latency(f);
                 std::unique_lock<std::recursive_mutex> lock(mutex);
 
                 frame->keep();
+                lock.unlock();
 
                 if (recycle_frames)
                 {
-                    freelist.push_back(std::move(*f));
+                    _buffer_pool.release(std::move(f->data));
                 }
-                lock.unlock();
+                f->external_data.reset();
 
                 if (f->is_fixed())
                     published_frames.deallocate(f);
@@ -141,6 +135,8 @@ namespace librealsense
             if (frame && frame->get_stream())
             {
                 auto callback_ended = _time_service ? _time_service->get_time() : 0;
+                frame->additional_data.trace[RS2_FRAME_TRACE_STAGE_USER_CALLBACK_END] = callback_ended;
+
                 auto callback_warning_duration = 1000 / (frame->get_stream()->get_framerate() + 1);
                 auto callback_duration = callback_ended - frame->get_frame_callback_start_time_point();
 
@@ -157,15 +153,37 @@ namespace librealsense
             }
         }
 
+        // The trace is complete once the frame is released: the frames delivered by a sensor, and those processed
+        // from them, are accounted for in the latency histograms of their stream, while these are enabled
+        void record_frame_latency(const T* frame) const
+        {
+            auto& statistics = environment::get_instance().get_latency_statistics();
+            if (!statistics.is_enabled() || !frame || !frame->get_stream())
+                return;
+
+            const auto& trace = frame->additional_data.trace;
+            if (trace[RS2_FRAME_TRACE_STAGE_USER_CALLBACK_END] && trace[RS2_FRAME_TRACE_STAGE_UNPACK_DONE])
+                statistics.record(frame->get_stream()->get_unique_id(), trace);
+        }
+
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        frame_pool_stats get_pool_stats() const override { return _buffer_pool.get_stats(); }
+
+        void set_frame_allocator(frame_allocator_ptr allocator) override
+        {
+            std::atomic_store(&_allocator, allocator);
+        }
+
         friend class frame;
 
     public:
         explicit frame_archive(std::atomic<uint32_t>* in_max_frame_queue_size,
+            std::atomic<uint32_t>* in_pool_watermark,
             std::shared_ptr<platform::time_service> ts,
             std::shared_ptr<metadata_parser_map> parsers)
             : max_frame_queue_size(in_max_frame_queue_size),
+            _buffer_pool(in_pool_watermark),
             recycle_frames(true), mutex(), _time_service(ts),
             _metadata_parsers(parsers)
         {
@@ -202,10 +220,7 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
+            _buffer_pool.clear();
 
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
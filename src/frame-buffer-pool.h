@@ -0,0 +1,207 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace librealsense
+{
+    struct frame_pool_stats
+    {
+        uint64_t hits = 0;      // allocations served from a recycled buffer
+        uint64_t misses = 0;    // allocations that required fresh memory
+    };
+
+    /*
+        Recycles frame data buffers between frames of the same size.
+        Buffers are kept in a small number of size buckets; each bucket is a fixed array
+        of slots that change hands through atomic state transitions, so neither acquire()
+        nor release() ever takes a lock or allocates. Recycled buffers are handed back
+        as-is (no zero-fill), the caller owns the content from that point on.
+        The number of buffers kept per bucket is capped by a watermark that can be
+        changed at runtime; a watermark of zero disables recycling altogether.
+    */
+    class frame_buffer_pool
+    {
+    public:
+        static const int BUCKETS = 4;
+        static const int SLOTS_PER_BUCKET = 32;
+
+        explicit frame_buffer_pool(const std::atomic<uint32_t>* watermark)
+            : _watermark(watermark), _tick(0), _hits(0), _misses(0)
+        {}
+
+        frame_buffer_pool(const frame_buffer_pool&) = delete;
+        frame_buffer_pool& operator=(const frame_buffer_pool&) = delete;
+
+        // Moves a recycled buffer of exactly `size` bytes into `out`
+        // Returns false (and leaves `out` untouched) when no such buffer is available
+        bool acquire(size_t size, std::vector<uint8_t>& out)
+        {
+            if (size)
+            {
+                auto tick = ++_tick;
+                for (auto& b : _buckets)
+                {
+                    if (b.size.load(std::memory_order_acquire) != size)
+                        continue;
+
+                    b.last_used.store(tick, std::memory_order_relaxed);
+                    for (auto& s : b.slots)
+                    {
+                        if (!s.try_lock(slot::FULL))
+                            continue;
+
+                        std::vector<uint8_t> candidate = std::move(s.data);
+                        s.unlock(slot::EMPTY);
+                        b.count.fetch_sub(1, std::memory_order_relaxed);
+
+                        // A bucket can be re-purposed while a release() is in flight,
+                        // so the size of what we pulled out has to be re-validated
+                        if (candidate.size() != size)
+                            continue;
+
+                        out = std::move(candidate);
+                        ++_hits;
+                        return true;
+                    }
+                }
+            }
+            ++_misses;
+            return false;
+        }
+
+        // Takes ownership of the buffer; it is either kept for reuse or freed
+        void release(std::vector<uint8_t>&& buffer)
+        {
+            const auto size = buffer.size();
+            const uint32_t watermark = std::min<uint32_t>(_watermark ? _watermark->load() : 0, SLOTS_PER_BUCKET);
+            if (!size || !watermark)
+                return;
+
+            auto b = find_or_claim_bucket(size);
+            if (!b)
+                return;
+
+            if (b->count.fetch_add(1, std::memory_order_relaxed) >= watermark)
+            {
+                b->count.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            for (auto& s : b->slots)
+            {
+                if (!s.try_lock(slot::EMPTY))
+                    continue;
+
+                s.data = std::move(buffer);
+                s.unlock(slot::FULL);
+                return;
+            }
+            b->count.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Frees every cached buffer. Safe to call concurrently with acquire()/release()
+        void clear()
+        {
+            for (auto& b : _buckets)
+                drain(b);
+        }
+
+        frame_pool_stats get_stats() const
+        {
+            frame_pool_stats stats;
+            stats.hits = _hits.load();
+            stats.misses = _misses.load();
+            return stats;
+        }
+
+    private:
+        struct slot
+        {
+            enum : int { EMPTY, BUSY, FULL };
+
+            slot() : state(EMPTY) {}
+
+            bool try_lock(int expected)
+            {
+                // Cheap pre-check to avoid bouncing the cache line on every CAS
+                if (state.load(std::memory_order_relaxed) != expected)
+                    return false;
+                return state.compare_exchange_strong(expected, BUSY, std::memory_order_acquire);
+            }
+            void unlock(int next) { state.store(next, std::memory_order_release); }
+
+            std::atomic<int> state;
+            std::vector<uint8_t> data;
+        };
+
+        struct bucket
+        {
+            bucket() : size(0), count(0), last_used(0) {}
+
+            std::atomic<size_t> size;       // 0 when the bucket is unassigned
+            std::atomic<uint32_t> count;    // number of FULL slots (approximate while in flux)
+            std::atomic<uint64_t> last_used;
+            slot slots[SLOTS_PER_BUCKET];
+        };
+
+        bucket* find_or_claim_bucket(size_t size)
+        {
+            for (auto& b : _buckets)
+                if (b.size.load(std::memory_order_acquire) == size)
+                    return &b;
+
+            for (auto& b : _buckets)
+            {
+                size_t unassigned = 0;
+                if (b.size.compare_exchange_strong(unassigned, size))
+                {
+                    b.last_used.store(_tick.load(), std::memory_order_relaxed);
+                    return &b;
+                }
+                if (unassigned == size)
+                    return &b;
+            }
+
+            // All buckets are taken by other sizes (e.g. after a resolution change),
+            // re-purpose the one that was used least recently
+            bucket* lru = nullptr;
+            for (auto& b : _buckets)
+                if (!lru || b.last_used.load() < lru->last_used.load())
+                    lru = &b;
+
+            auto old_size = lru->size.load();
+            if (!lru->size.compare_exchange_strong(old_size, size))
+                return old_size == size ? lru : nullptr; // someone else got there first
+
+            lru->last_used.store(_tick.load(), std::memory_order_relaxed);
+            drain(*lru);
+            return lru;
+        }
+
+        static void drain(bucket& b)
+        {
+            for (auto& s : b.slots)
+            {
+                if (!s.try_lock(slot::FULL))
+                    continue;
+
+                std::vector<uint8_t>().swap(s.data);
+                s.unlock(slot::EMPTY);
+                b.count.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        const std::atomic<uint32_t>* _watermark;
+        std::atomic<uint64_t> _tick;
+        std::atomic<uint64_t> _hits;
+        std::atomic<uint64_t> _misses;
+        bucket _buckets[BUCKETS];
+    };
+}
@@ -108,7 +108,8 @@ namespace librealsense
                         auto orig = (librealsense::frame_interface*)f.get();
                         auto depth_data = (uint16_t*)orig->get_frame_data();
 
-                        memcpy(ptr->data.data(), depth_data, ptr->data.size());
+                        // The frame data may be external (see rs2_set_processing_block_frame_allocator), not in ptr->data
+                        memcpy(const_cast<byte*>(ptr->get_frame_data()), depth_data, ptr->get_frame_data_size());
 
                         ptr->set_sensor(orig->get_sensor());
                         orig->acquire();
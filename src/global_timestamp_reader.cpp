@@ -124,17 +124,27 @@ namespace librealsense
         return y;
     }
 
-    bool CLinearCoefficients::update_samples_base(double x)
+    double CLinearCoefficients::calc_wrapped_value(double x) const
+    {
+        return calc_value(x + samples_base_shift(x));
+    }
+
+    double CLinearCoefficients::samples_base_shift(double x) const
     {
         static const double max_device_time(pow(2, 32) * TIMESTAMP_USEC_TO_MSEC);
-        double base_x;
         if (_last_values.empty())
-            return false;
+            return 0;
         if ((_last_values.front()._x - x) > max_device_time / 2)
-            base_x = max_device_time;
-        else if ((x - _last_values.front()._x) > max_device_time / 2)
-            base_x = -max_device_time;
-        else
+            return max_device_time;
+        if ((x - _last_values.front()._x) > max_device_time / 2)
+            return -max_device_time;
+        return 0;
+    }
+
+    bool CLinearCoefficients::update_samples_base(double x)
+    {
+        double base_x(samples_base_shift(x));
+        if (base_x == 0)
             return false;
         LOG_DEBUG(__FUNCTION__ << "(" << base_x << ")");
 
@@ -269,6 +279,20 @@ namespace librealsense
             return crnt_hw_time;
     }
 
+    double time_diff_keeper::map_system_hw_time(double crnt_hw_time, bool& is_ready) const
+    {
+        std::lock_guard<std::recursive_mutex> lock(_read_mtx);
+        is_ready = _is_ready;
+        return _is_ready ? _coefs.calc_wrapped_value(crnt_hw_time) : crnt_hw_time;
+    }
+
+    double time_diff_keeper::get_clock_drift_ppm(bool& is_ready) const
+    {
+        std::lock_guard<std::recursive_mutex> lock(_read_mtx);
+        is_ready = _is_ready;
+        return _is_ready ? (_coefs.get_slope() - 1) * 1e6 : 0;
+    }
+
     global_timestamp_reader::global_timestamp_reader(std::unique_ptr<frame_timestamp_reader> device_timestamp_reader,
                                                      std::shared_ptr<time_diff_keeper> timediff,
                                                      std::shared_ptr<global_time_option> enable_option) :
@@ -40,11 +40,14 @@ namespace librealsense
         bool update_samples_base(double x);
         void update_last_sample_time(double x);
         double calc_value(double x) const;
+        double calc_wrapped_value(double x) const; // calc_value across a device clock wrap, without rebasing the samples
+        double get_slope() const { return _dest_a; }
         bool is_full() const;
 
     private:
         void calc_linear_coefs();
         void get_a_b(double x, double& a, double& b) const;
+        double samples_base_shift(double x) const;
 
     private:
         unsigned int _buffer_size;
@@ -66,6 +69,8 @@ namespace librealsense
         void stop();
         ~time_diff_keeper();
         double get_system_hw_time(double crnt_hw_time, bool& is_ready);
+        double map_system_hw_time(double crnt_hw_time, bool& is_ready) const; // Same mapping, leaving the keeper untouched
+        double get_clock_drift_ppm(bool& is_ready) const; // Rate of the host clock relative to the device clock, minus one
 
     private:
         bool update_diff_time();
@@ -112,6 +117,7 @@ namespace librealsense
         global_time_interface();
         ~global_time_interface() { _tf_keeper.reset(); }
         void enable_time_diff_keeper(bool is_enable);
+        std::shared_ptr<time_diff_keeper> get_time_diff_keeper() const { return _tf_keeper; }
         virtual double get_device_time_ms() = 0; // Returns time in miliseconds.
         virtual void create_snapshot(std::shared_ptr<global_time_interface>& snapshot) const override {}
         virtual void enable_recording(std::function<void(const global_time_interface&)> record_action) override {}
@@ -58,7 +58,7 @@ namespace librealsense
             std::map<int, std::string> _id_to_sensor;
             std::map<std::string, int> _sensor_to_id;
             std::vector<hid_profile> _configured_profiles;
-            single_consumer_queue<REALSENSE_HID_REPORT> _queue;
+            lock_free_queue<REALSENSE_HID_REPORT> _queue;   // Filled from the USB request callbacks at IMU rates
             std::shared_ptr<active_object<>> _handle_interrupts_thread;
         };
     }
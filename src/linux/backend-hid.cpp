@@ -245,10 +245,14 @@ namespace librealsense
 
             _callback = sensor_callback;
             _is_capturing = true;
-            _hid_thread = std::unique_ptr<std::thread>(new std::thread([this, read_device_path_str](){
-                const uint32_t channel_size = 24; // TODO: why 24?
-                std::vector<uint8_t> raw_data(channel_size * hid_buf_len);
+            if (epoll_reactor::enabled())
+            {
+                _reactor = epoll_reactor::get();
+                _reactor->add(this, { _fd }, std::chrono::seconds(5));
+                return;
+            }
 
+            _hid_thread = std::unique_ptr<std::thread>(new std::thread([this, read_device_path_str](){
                 do {
                     fd_set fds;
                     FD_ZERO(&fds);
@@ -256,7 +260,6 @@ namespace librealsense
                     FD_SET(_stop_pipe_fd[0], &fds);
 
                     int max_fd = std::max(_stop_pipe_fd[0], _fd);
-                    size_t read_size = 0;
 
                     struct timeval tv = {5,0};
                     LOG_DEBUG_HID("HID Select initiated");
@@ -279,9 +282,7 @@ namespace librealsense
                         }
                         else if (FD_ISSET(_fd, &fds))
                         {
-                            read_size = read(_fd, raw_data.data(), raw_data.size());
-                            if (read_size <= 0 )
-                                continue;
+                            read_reports();
                         }
                         else
                         {
@@ -289,36 +290,56 @@ namespace librealsense
                             LOG_WARNING("HID unresolved event : after select->FD_ISSET");
                             continue;
                         }
-
-                        auto sz= read_size / channel_size;
-                        if (sz > 2)
-                        {
-                            LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
-                        }
-                        for (auto i = 0; i < read_size / channel_size; ++i)
-                        {
-                            auto p_raw_data = raw_data.data() + channel_size * i;
-
-                            // TODO: code refactoring to reduce latency
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
-
-                            sens_data.fo = {channel_size, channel_size, p_raw_data, p_raw_data};
-                            this->_callback(sens_data);
-                        }
-                        if (sz > 2)
-                        {
-                            LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
-                        }
                     }
                     else
                     {
-                        LOG_WARNING("hid_custom_sensor: Frames didn't arrived within 5 seconds");
+                        on_timeout();
                     }
                 } while(this->_is_capturing);
             }));
         }
 
+        void hid_custom_sensor::read_reports()
+        {
+            const uint32_t channel_size = 24; // TODO: why 24?
+            uint8_t raw_data[channel_size * hid_buf_len];
+
+            auto read_size = read(_fd, raw_data, sizeof(raw_data));
+            if (read_size <= 0 )
+                return;
+
+            auto sz= read_size / channel_size;
+            if (sz > 2)
+            {
+                LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
+            }
+            for (auto i = 0; i < sz; ++i)
+            {
+                auto p_raw_data = raw_data + channel_size * i;
+
+                // TODO: code refactoring to reduce latency
+                sensor_data sens_data{};
+                sens_data.sensor = hid_sensor{get_sensor_name()};
+
+                sens_data.fo = {channel_size, channel_size, p_raw_data, p_raw_data};
+                this->_callback(sens_data);
+            }
+            if (sz > 2)
+            {
+                LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
+            }
+        }
+
+        void hid_custom_sensor::on_ready(const std::vector<int>&)
+        {
+            read_reports();
+        }
+
+        void hid_custom_sensor::on_timeout()
+        {
+            LOG_WARNING("hid_custom_sensor: Frames didn't arrived within 5 seconds");
+        }
+
         void hid_custom_sensor::stop_capture()
         {
             if (!_is_capturing)
@@ -328,8 +349,16 @@ namespace librealsense
             }
 
             _is_capturing = false;
-            signal_stop();
-            _hid_thread->join();
+            if (_reactor)
+            {
+                _reactor->remove(this);
+                _reactor.reset();
+            }
+            else
+            {
+                signal_stop();
+                _hid_thread->join();
+            }
             enable(false);
             _callback = nullptr;
 
@@ -525,14 +554,18 @@ namespace librealsense
             }
 
             _callback = sensor_callback;
+            _channel_size = get_channel_size();
+            _raw_data.resize(_channel_size * hid_buf_len);
+            _has_metadata = has_metadata();
             _is_capturing = true;
-            _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
-                const uint32_t channel_size = get_channel_size();
-                size_t raw_data_size = channel_size*hid_buf_len;
-
-                std::vector<uint8_t> raw_data(raw_data_size);
-                auto metadata = has_metadata();
+            if (epoll_reactor::enabled())
+            {
+                _reactor = epoll_reactor::get();
+                _reactor->add(this, { _fd }, std::chrono::seconds(5));
+                return;
+            }
 
+            _hid_thread = std::unique_ptr<std::thread>(new std::thread([this](){
                 do {
                     fd_set fds;
                     FD_ZERO(&fds);
@@ -541,7 +574,6 @@ namespace librealsense
 
                     int max_fd = std::max(_stop_pipe_fd[0], _fd);
 
-                    ssize_t read_size = 0;
                     struct timeval tv = {5, 0};
                     LOG_DEBUG_HID("HID IIO Select initiated");
                     auto val = select(max_fd + 1, &fds, nullptr, nullptr, &tv);
@@ -565,9 +597,7 @@ namespace librealsense
                         }
                         else if (FD_ISSET(_fd, &fds))
                         {
-                            read_size = read(_fd, raw_data.data(), raw_data_size);
-                            if (read_size < 0 )
-                                continue;
+                            read_reports();
                         }
                         else
                         {
@@ -575,66 +605,86 @@ namespace librealsense
                             LOG_WARNING("HID IIO unresolved event : after select->FD_ISSET");
                             continue;
                         }
-
-                        auto sz= read_size / channel_size;
-                        if (sz > 2)
-                        {
-                            LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
-                        }
-                        // TODO: code refactoring to reduce latency
-                        for (auto i = 0; i < sz; ++i)
-                        {
-                            auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
-                            auto p_raw_data = raw_data.data() + channel_size * i;
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
-
-                            auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
-                            // Populate HID IMU data - Header
-                            metadata_hid_raw meta_data{};
-                            meta_data.header.report_type = md_hid_report_type::hid_report_imu;
-                            meta_data.header.length = hid_header_size + metadata_imu_report_size;
-                            meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
-                            // Payload:
-                            meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
-                            meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
-//                            meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
-//                                                                                            md_hid_imu_attributes::imu_counter_attribute |
-//                                                                                            md_hid_imu_attributes::usb_counter_attribute);
-//                            meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
-//                            meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
-//                            meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
-
-                            sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
-                                            p_raw_data,  metadata? &meta_data : nullptr, now_ts};
-                            //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
-                            if (metadata)
-                            {
-                                //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
-                                //*ts_nsec /=1000;
-                                meta_data.header.timestamp /=1000;
-                            }
-
-//                            for (auto i=0ul; i<channel_size; i++)
-//                                std::cout << std::hex << int(p_raw_data[i]) << " ";
-//                            std::cout << std::dec << std::endl;
-
-                            this->_callback(sens_data);
-                        }
-                        if (sz > 2)
-                        {
-                            LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
-                        }
                     }
                     else
                     {
-                        LOG_WARNING("iio_hid_sensor: Frames didn't arrived within the predefined interval");
+                        on_timeout();
                         std::this_thread::sleep_for(std::chrono::milliseconds(2));
                     }
                 } while(this->_is_capturing);
             }));
         }
 
+        void iio_hid_sensor::read_reports()
+        {
+            const uint32_t channel_size = _channel_size;
+            auto metadata = _has_metadata;
+
+            auto read_size = read(_fd, _raw_data.data(), _raw_data.size());
+            if (read_size < 0 )
+                return;
+
+            auto sz= read_size / channel_size;
+            if (sz > 2)
+            {
+                LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
+            }
+            // TODO: code refactoring to reduce latency
+            for (auto i = 0; i < sz; ++i)
+            {
+                auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+                auto p_raw_data = _raw_data.data() + channel_size * i;
+                sensor_data sens_data{};
+                sens_data.sensor = hid_sensor{get_sensor_name()};
+
+                auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
+                // Populate HID IMU data - Header
+                metadata_hid_raw meta_data{};
+                meta_data.header.report_type = md_hid_report_type::hid_report_imu;
+                meta_data.header.length = hid_header_size + metadata_imu_report_size;
+                meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
+                // Payload:
+                meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
+                meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
+//                meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
+//                                                                                md_hid_imu_attributes::imu_counter_attribute |
+//                                                                                md_hid_imu_attributes::usb_counter_attribute);
+//                meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
+//                meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
+//                meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
+
+                sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
+                                p_raw_data,  metadata? &meta_data : nullptr, now_ts};
+                //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
+                if (metadata)
+                {
+                    //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
+                    //*ts_nsec /=1000;
+                    meta_data.header.timestamp /=1000;
+                }
+
+//                for (auto i=0ul; i<channel_size; i++)
+//                    std::cout << std::hex << int(p_raw_data[i]) << " ";
+//                std::cout << std::dec << std::endl;
+
+                this->_callback(sens_data);
+            }
+            if (sz > 2)
+            {
+                LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
+            }
+        }
+
+        void iio_hid_sensor::on_ready(const std::vector<int>&)
+        {
+            read_reports();
+        }
+
+        void iio_hid_sensor::on_timeout()
+        {
+            LOG_WARNING("iio_hid_sensor: Frames didn't arrived within the predefined interval");
+        }
+
         void iio_hid_sensor::stop_capture()
         {
             if (!_is_capturing)
@@ -642,8 +692,16 @@ namespace librealsense
 
             _is_capturing = false;
             set_power(false);
-            signal_stop();
-            _hid_thread->join();
+            if (_reactor)
+            {
+                _reactor->remove(this);
+                _reactor.reset();
+            }
+            else
+            {
+                signal_stop();
+                _hid_thread->join();
+            }
             _callback = nullptr;
             _channels.clear();
 
@@ -4,6 +4,7 @@
 
 #include "backend.h"
 #include "types.h"
+#include "epoll-reactor.h"
 
 #include <limits.h>
 #include <list>
@@ -95,7 +96,7 @@ namespace librealsense
             hid_input_info info;
         };
 
-        class hid_custom_sensor {
+        class hid_custom_sensor : public epoll_reactor::source {
         public:
             hid_custom_sensor(const std::string& device_path, const std::string& sensor_name);
 
@@ -118,6 +119,10 @@ namespace librealsense
 
             void signal_stop();
 
+            void read_reports();
+            void on_ready(const std::vector<int>& fds) override;
+            void on_timeout() override;
+
             int _fd;
             int _stop_pipe_fd[2]; // write to _stop_pipe_fd[1] and read from _stop_pipe_fd[0]
             std::map<std::string, std::string> _reports;
@@ -127,10 +132,11 @@ namespace librealsense
             hid_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
+            std::shared_ptr<epoll_reactor> _reactor;
         };
 
         // declare device sensor with all of its inputs.
-        class iio_hid_sensor {
+        class iio_hid_sensor : public epoll_reactor::source {
         public:
             iio_hid_sensor(const std::string& device_path, uint32_t frequency);
 
@@ -151,6 +157,10 @@ namespace librealsense
 
             void signal_stop();
 
+            void read_reports();
+            void on_ready(const std::vector<int>& fds) override;
+            void on_timeout() override;
+
             bool has_metadata();
 
             static bool sort_hids(hid_input* first, hid_input* second);
@@ -182,6 +192,10 @@ namespace librealsense
             hid_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
+            std::shared_ptr<epoll_reactor> _reactor;
+            uint32_t _channel_size = 0;
+            bool _has_metadata = false;
+            std::vector<uint8_t> _raw_data;
             std::unique_ptr<std::thread> _pm_thread;    // Delayed initialization due to power-up sequence
             dispatcher                  _pm_dispatcher; // Asynchronous power management
         };
@@ -230,8 +230,8 @@ namespace librealsense
             return r;
         }
 
-        buffer::buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index)
-            : _type(type), _use_memory_map(use_memory_map), _index(index)
+        buffer::buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index, std::shared_ptr<stream_token> token)
+            : _type(type), _use_memory_map(use_memory_map), _index(index), _token(std::move(token))
         {
             v4l2_buffer buf = {};
             buf.type = _type;
@@ -318,11 +318,16 @@ namespace librealsense
                     memset((byte*)(get_frame_start()) + metadata_offset, 0, MAX_META_DATA_SIZE);
                 }
 
-                LOG_DEBUG_V4L("Enqueue buf " << std::dec << _buf.index << " for fd " << fd);
-                if (xioctl(fd, VIDIOC_QBUF, &_buf) < 0)
+                // A frame released after its stream is closed must not touch the (possibly reused) descriptor
+                if (!_token->if_alive([&]()
                 {
-                    LOG_ERROR("xioctl(VIDIOC_QBUF) failed when requesting new frame! fd: " << fd << " error: " << strerror(errno));
-                }
+                    LOG_DEBUG_V4L("Enqueue buf " << std::dec << _buf.index << " for fd " << fd);
+                    if (xioctl(fd, VIDIOC_QBUF, &_buf) < 0)
+                    {
+                        LOG_ERROR("xioctl(VIDIOC_QBUF) failed when requesting new frame! fd: " << fd << " error: " << strerror(errno));
+                    }
+                }))
+                    LOG_DEBUG_V4L("Buf " << std::dec << _buf.index << " released after its stream was closed");
 
                 _must_enqueue = false;
             }
@@ -705,6 +710,8 @@ namespace librealsense
         {
             _is_capturing = false;
             if (_thread && _thread->joinable()) _thread->join();
+            if (_stream_token)
+                _stream_token->expire();
             for (auto&& fd : _fds)
             {
                 try { if (fd) ::close(fd);} catch (...) {}
@@ -715,6 +722,8 @@ namespace librealsense
         {
             if(!_is_capturing && !_callback)
             {
+                release_held_buffers();
+
                 v4l2_fmtdesc pixel_format = {};
                 pixel_format.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
 
@@ -801,7 +810,19 @@ namespace librealsense
                 streamon();
 
                 _is_capturing = true;
-                _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
+                if (epoll_reactor::enabled())
+                {
+                    // The stop pipe is only needed to break out of select()
+                    std::vector<int> fds;
+                    for (auto fd : _fds)
+                        if (fd != _stop_pipe_fd[0] && fd != _stop_pipe_fd[1])
+                            fds.push_back(fd);
+
+                    _reactor = epoll_reactor::get();
+                    _reactor->add(this, fds, std::chrono::seconds(5));
+                }
+                else
+                    _thread = std::unique_ptr<std::thread>(new std::thread([this](){ capture_loop(); }));
             }
         }
 
@@ -815,11 +836,19 @@ namespace librealsense
             _is_capturing = false;
             _is_started = false;
 
-            // Stop nn-demand frames polling
-            signal_stop();
+            if (_reactor)
+            {
+                _reactor->remove(this);
+                _reactor.reset();
+            }
+            else
+            {
+                // Stop nn-demand frames polling
+                signal_stop();
 
-            _thread->join();
-            _thread.reset();
+                _thread->join();
+                _thread.reset();
+            }
 
             // Notify kernel
             streamoff();
@@ -846,14 +875,40 @@ namespace librealsense
             {
                 // Release allocated buffers
                 allocate_io_buffers(0);
+                _buf_dispatch = buffers_mgr(_use_memory_map);
 
-                // Release IO
-                negotiate_kernel_buffers(0);
+                // Release IO. The kernel refuses to while frames map the buffers, then it is deferred to the next stream
+                if (!buffers_held())
+                    negotiate_kernel_buffers(0);
 
                 _callback = nullptr;
             }
         }
 
+        bool v4l_uvc_device::buffers_held()
+        {
+            _held_buffers.erase(std::remove_if(_held_buffers.begin(), _held_buffers.end(),
+                [](const std::weak_ptr<buffer>& b) { return b.expired(); }), _held_buffers.end());
+            return !_held_buffers.empty();
+        }
+
+        void v4l_uvc_device::release_held_buffers()
+        {
+            if (_held_buffers.empty())
+                return;
+
+            // Frames are usually released shortly after their stream is closed
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            while (buffers_held() && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+            if (buffers_held())
+                throw linux_backend_exception(to_string() << _name << " capture buffers are still held by "
+                    << _held_buffers.size() << " frames of the previous stream, release them before streaming again");
+
+            negotiate_kernel_buffers(0);
+        }
+
         std::string v4l_uvc_device::fourcc_to_string(uint32_t id) const
         {
             uint32_t device_fourcc = id;
@@ -960,171 +1015,203 @@ namespace librealsense
                             return;
                         }
                     }
-                    else // Check and acquire data buffers from kernel
+                    else
                     {
-                        bool md_extracted = false;
-                        bool keep_md = false;
-                        bool wa_applied = false;
-                        buffers_mgr buf_mgr(_use_memory_map);
-                        if (_buf_dispatch.metadata_size())
-                        {
-                            buf_mgr = _buf_dispatch;    // Handle over MD buffer from the previous cycle
-                            md_extracted = true;
-                            wa_applied = true;
-                            _buf_dispatch.set_md_attributes(0,nullptr);
-                        }
-                        // RAII to handle exceptions
-                        std::unique_ptr<int, std::function<void(int*)> > md_poller(new int(0),
-                            [this,&buf_mgr,&md_extracted,&keep_md,&fds](int* d)
-                            {
-                                if (!md_extracted)
-                                {
-                                    LOG_DEBUG_V4L("MD Poller read md ");
-                                    acquire_metadata(buf_mgr,fds);
-                                    if (buf_mgr.metadata_size())
-                                    {
-                                        if (keep_md) // store internally for next poll cycle
-                                        {
-                                            auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
-                                            auto mdb = buf_mgr.get_buffers().at(e_metadata_buf);
-                                            LOG_DEBUG_V4L("Poller stores buf for fd " << std::dec << mdb._file_desc
-                                                          << " ,seq = " << mdb._dq_buf.sequence << " v4l_buf " << mdb._dq_buf.index
-                                                          << " , metadata size = " << (int)buf_mgr.metadata_size()
-                                                          << ", fn = " << fn);
-                                            _buf_dispatch  = buf_mgr; // TODO keep metadata only as dispatch may hold video buf from previous cycle
-                                            buf_mgr.handle_buffer(e_metadata_buf,-1); // transfer new buffer request to next cycle
-                                        }
-                                        else // Discard collected metadata buffer
-                                        {
-                                            LOG_DEBUG_V4L("Discard md buffer");
-                                            auto md_buf = buf_mgr.get_buffers().at(e_metadata_buf);
-                                            if (md_buf._data_buf)
-                                                md_buf._data_buf->request_next_frame(md_buf._file_desc,true);
-                                        }
-                                    }
-                                }
-                                delete d;
-                            });
+                        // Check and acquire data buffers from kernel
+                        acquire_and_dispatch(fds);
+                    }
+                }
+                else // (val==0)
+                {
+                    on_timeout();
+                }
+            }
+        }
 
-                        if(FD_ISSET(_fd, &fds))
+        void v4l_uvc_device::acquire_and_dispatch(fd_set& fds)
+        {
+            bool md_extracted = false;
+            bool keep_md = false;
+            bool wa_applied = false;
+            buffers_mgr buf_mgr(_use_memory_map);
+            if (_buf_dispatch.metadata_size())
+            {
+                buf_mgr = _buf_dispatch;    // Handle over MD buffer from the previous cycle
+                md_extracted = true;
+                wa_applied = true;
+                _buf_dispatch.set_md_attributes(0,nullptr);
+            }
+            // RAII to handle exceptions
+            std::unique_ptr<int, std::function<void(int*)> > md_poller(new int(0),
+                [this,&buf_mgr,&md_extracted,&keep_md,&fds](int* d)
+                {
+                    if (!md_extracted)
+                    {
+                        LOG_DEBUG_V4L("MD Poller read md ");
+                        acquire_metadata(buf_mgr,fds);
+                        if (buf_mgr.metadata_size())
                         {
-                            FD_CLR(_fd,&fds);
-                            v4l2_buffer buf = {};
-                            buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
-                            if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+                            if (keep_md) // store internally for next poll cycle
+                            {
+                                auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
+                                auto mdb = buf_mgr.get_buffers().at(e_metadata_buf);
+                                LOG_DEBUG_V4L("Poller stores buf for fd " << std::dec << mdb._file_desc
+                                              << " ,seq = " << mdb._dq_buf.sequence << " v4l_buf " << mdb._dq_buf.index
+                                              << " , metadata size = " << (int)buf_mgr.metadata_size()
+                                              << ", fn = " << fn);
+                                _buf_dispatch  = buf_mgr; // TODO keep metadata only as dispatch may hold video buf from previous cycle
+                                buf_mgr.handle_buffer(e_metadata_buf,-1); // transfer new buffer request to next cycle
+                            }
+                            else // Discard collected metadata buffer
                             {
-                                LOG_DEBUG_V4L("Dequeued empty buf for fd " << std::dec << _fd);
+                                LOG_DEBUG_V4L("Discard md buffer");
+                                auto md_buf = buf_mgr.get_buffers().at(e_metadata_buf);
+                                if (md_buf._data_buf)
+                                    md_buf._data_buf->request_next_frame(md_buf._file_desc,true);
                             }
-                            LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
+                        }
+                    }
+                    delete d;
+                });
 
-                            auto buffer = _buffers[buf.index];
-                            buf_mgr.handle_buffer(e_video_buf,_fd, buf,buffer);
+            if(FD_ISSET(_fd, &fds))
+            {
+                FD_CLR(_fd,&fds);
+                v4l2_buffer buf = {};
+                buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+                buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                if(xioctl(_fd, VIDIOC_DQBUF, &buf) < 0)
+                {
+                    LOG_DEBUG_V4L("Dequeued empty buf for fd " << std::dec << _fd);
+                }
+                LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
 
-                            if (_is_started)
-                            {
-                                if(buf.bytesused == 0)
-                                {
-                                    LOG_DEBUG_V4L("Empty video frame arrived, index " << buf.index);
-                                    return;
-                                }
+                auto buffer = _buffers[buf.index];
+                buf_mgr.handle_buffer(e_video_buf,_fd, buf,buffer);
 
-                                // Relax the required frame size for compressed formats, i.e. MJPG, Z16H
-                                // Drop partial and overflow frames (assumes D4XX metadata only)
-                                bool compressed_format = val_in_range(_profile.format, { 0x4d4a5047U , 0x5a313648U});
-                                bool partial_frame = (!compressed_format && (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE));
-                                bool overflow_frame = (buf.bytesused ==  buffer->get_length_frame_only() + MAX_META_DATA_SIZE);
-                                if (partial_frame || overflow_frame)
-                                {
-                                    auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
-                                    std::stringstream s;
-                                    if (partial_frame)
-                                    {
-                                        s << "Incomplete video frame detected!\nSize " << buf.bytesused
-                                            << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
-                                        if (overflow_frame)
-                                        {
-                                            s << ". Overflow detected: payload size " << buffer->get_length_frame_only();
-                                            LOG_ERROR("Corrupted UVC frame data, underflow and overflow reported:\n" << s.str().c_str());
-                                        }
-                                    }
-                                    else
-                                    {
-                                        if (overflow_frame)
-                                            s << "overflow video frame detected!\nSize " << buf.bytesused
-                                                << ", payload size " << buffer->get_length_frame_only();
-                                    }
-                                    LOG_WARNING("Incomplete frame received: " << s.str()); // Ev -try1
-                                    librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
-
-                                    _error_handler(n);
-                                    // Check if metadata was already allocated
-                                    if (buf_mgr.metadata_size())
-                                    {
-                                        LOG_WARNING("Metadata was present when partial frame arrived, mark md as extracted");
-                                        md_extracted = true;
-                                        LOG_DEBUG_V4L("Discarding md due to invalid video payload");
-                                        auto md_buf = buf_mgr.get_buffers().at(e_metadata_buf);
-                                        md_buf._data_buf->request_next_frame(md_buf._file_desc,true);
-                                    }
-                                }
-                                else
-                                {
-                                    auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
-                                    timestamp = monotonic_to_realtime(timestamp);
-
-                                    // Read metadata. Metadata node performs a blocking call to ensure video and metadata sync
-                                    acquire_metadata(buf_mgr,fds,compressed_format);
-                                    md_extracted = true;
-
-                                    if (wa_applied)
-                                    {
-                                        auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
-                                        LOG_INFO("Extracting md buff, fn = " << fn);
-                                    }
-
-                                    auto frame_sz = buf_mgr.md_node_present() ? buf.bytesused :
-                                                        std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only());
-                                    frame_object fo{ frame_sz, buf_mgr.metadata_size(),
-                                                     buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
-
-                                    buffer->attach_buffer(buf);
-                                    buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
-
-                                    if (buf_mgr.verify_vd_md_sync())
-                                    {
-                                        //Invoke user callback and enqueue next frame
-                                        _callback(_profile, fo, [buf_mgr]() mutable {
-                                            buf_mgr.request_next_frame();
-                                        });
-                                    }
-                                    else
-                                    {
-                                        LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
-                                    }
-                                }
-                            }
-                            else
+                if (_is_started)
+                {
+                    if(buf.bytesused == 0)
+                    {
+                        LOG_DEBUG_V4L("Empty video frame arrived, index " << buf.index);
+                        return;
+                    }
+
+                    // Relax the required frame size for compressed formats, i.e. MJPG, Z16H
+                    // Drop partial and overflow frames (assumes D4XX metadata only)
+                    bool compressed_format = val_in_range(_profile.format, { 0x4d4a5047U , 0x5a313648U});
+                    bool partial_frame = (!compressed_format && (buf.bytesused < buffer->get_full_length() - MAX_META_DATA_SIZE));
+                    bool overflow_frame = (buf.bytesused ==  buffer->get_length_frame_only() + MAX_META_DATA_SIZE);
+                    if (partial_frame || overflow_frame)
+                    {
+                        auto percentage = (100 * buf.bytesused) / buffer->get_full_length();
+                        std::stringstream s;
+                        if (partial_frame)
+                        {
+                            s << "Incomplete video frame detected!\nSize " << buf.bytesused
+                                << " out of " << buffer->get_full_length() << " bytes (" << percentage << "%)";
+                            if (overflow_frame)
                             {
-                                LOG_DEBUG_V4L("Video frame arrived in idle mode."); // TODO - verification
+                                s << ". Overflow detected: payload size " << buffer->get_length_frame_only();
+                                LOG_ERROR("Corrupted UVC frame data, underflow and overflow reported:\n" << s.str().c_str());
                             }
                         }
                         else
                         {
-                            if (_is_started)
-                                keep_md = true;
-                            LOG_DEBUG("FD_ISSET: no data on video node sink");
+                            if (overflow_frame)
+                                s << "overflow video frame detected!\nSize " << buf.bytesused
+                                    << ", payload size " << buffer->get_length_frame_only();
+                        }
+                        LOG_WARNING("Incomplete frame received: " << s.str()); // Ev -try1
+                        librealsense::notification n = { RS2_NOTIFICATION_CATEGORY_FRAME_CORRUPTED, 0, RS2_LOG_SEVERITY_WARN, s.str()};
+
+                        _error_handler(n);
+                        // Check if metadata was already allocated
+                        if (buf_mgr.metadata_size())
+                        {
+                            LOG_WARNING("Metadata was present when partial frame arrived, mark md as extracted");
+                            md_extracted = true;
+                            LOG_DEBUG_V4L("Discarding md due to invalid video payload");
+                            auto md_buf = buf_mgr.get_buffers().at(e_metadata_buf);
+                            md_buf._data_buf->request_next_frame(md_buf._file_desc,true);
+                        }
+                    }
+                    else
+                    {
+                        auto timestamp = (double)buf.timestamp.tv_sec*1000.f + (double)buf.timestamp.tv_usec/1000.f;
+                        timestamp = monotonic_to_realtime(timestamp);
+
+                        // Read metadata. Metadata node performs a blocking call to ensure video and metadata sync
+                        acquire_metadata(buf_mgr,fds,compressed_format);
+                        md_extracted = true;
+
+                        if (wa_applied)
+                        {
+                            auto fn = *(uint32_t*)((char*)(buf_mgr.metadata_start())+28);
+                            LOG_INFO("Extracting md buff, fn = " << fn);
+                        }
+
+                        auto frame_sz = buf_mgr.md_node_present() ? buf.bytesused :
+                                            std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only());
+                        frame_object fo{ frame_sz, buf_mgr.metadata_size(),
+                                         buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+
+                        buffer->attach_buffer(buf);
+                        buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
+
+                        if (buf_mgr.verify_vd_md_sync())
+                        {
+                            //Invoke user callback and enqueue next frame
+                            _callback(_profile, fo, [buf_mgr]() mutable {
+                                buf_mgr.request_next_frame();
+                            });
+                        }
+                        else
+                        {
+                            LOG_WARNING("Video frame dropped, video and metadata buffers inconsistency");
                         }
                     }
                 }
-                else // (val==0)
+                else
                 {
-                    LOG_WARNING("Frames didn't arrived within 5 seconds");
-                    librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
-
-                    _error_handler(n);
+                    LOG_DEBUG_V4L("Video frame arrived in idle mode."); // TODO - verification
                 }
             }
+            else
+            {
+                if (_is_started)
+                    keep_md = true;
+                LOG_DEBUG("FD_ISSET: no data on video node sink");
+            }
+        }
+
+        void v4l_uvc_device::on_ready(const std::vector<int>& fds)
+        {
+            fd_set ready{};
+            FD_ZERO(&ready);
+            for (auto fd : fds)
+                FD_SET(fd, &ready);
+
+            try
+            {
+                acquire_and_dispatch(ready);
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR(ex.what());
+
+                librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_UNKNOWN_ERROR, 0, RS2_LOG_SEVERITY_ERROR, ex.what()};
+
+                _error_handler(n);
+            }
+        }
+
+        void v4l_uvc_device::on_timeout()
+        {
+            LOG_WARNING("Frames didn't arrived within 5 seconds");
+            librealsense::notification n = {RS2_NOTIFICATION_CATEGORY_FRAMES_TIMEOUT, 0, RS2_LOG_SEVERITY_WARN,  "Frames didn't arrived within 5 seconds"};
+
+            _error_handler(n);
         }
 
         void v4l_uvc_device::acquire_metadata(buffers_mgr & buf_mgr,fd_set &, bool compressed_format)
@@ -1475,16 +1562,20 @@ namespace librealsense
         {
             if (buffers)
             {
+                _stream_token = std::make_shared<stream_token>();
                 for(size_t i = 0; i < buffers; ++i)
                 {
-                    _buffers.push_back(std::make_shared<buffer>(_fd, V4L2_BUF_TYPE_VIDEO_CAPTURE, _use_memory_map, i));
+                    _buffers.push_back(std::make_shared<buffer>(_fd, V4L2_BUF_TYPE_VIDEO_CAPTURE, _use_memory_map, i, _stream_token));
                 }
             }
             else
             {
+                if (_stream_token)
+                    _stream_token->expire();
                 for(size_t i = 0; i < _buffers.size(); i++)
                 {
                     _buffers[i]->detach_buffer();
+                    _held_buffers.push_back(_buffers[i]);
                 }
                 _buffers.resize(0);
             }
@@ -1551,6 +1642,8 @@ namespace librealsense
             _fd = 0;
             _stop_pipe_fd[0] = _stop_pipe_fd[1] = 0;
             _fds.clear();
+            // Closing the descriptor frees the kernel buffers; frames still holding them only keep their mapping
+            _held_buffers.clear();
         }
 
         void v4l_uvc_device::set_format(stream_profile profile)
@@ -1616,14 +1709,15 @@ namespace librealsense
             {
                 for(size_t i = 0; i < buffers; ++i)
                 {
-                    _md_buffers.push_back(std::make_shared<buffer>(_md_fd, LOCAL_V4L2_BUF_TYPE_META_CAPTURE, _use_memory_map, i));
+                    _md_buffers.push_back(std::make_shared<buffer>(_md_fd, LOCAL_V4L2_BUF_TYPE_META_CAPTURE, _use_memory_map, i, _stream_token));
                 }
             }
             else
             {
-                for(size_t i = 0; i < _buffers.size(); i++)
+                for(size_t i = 0; i < _md_buffers.size(); i++)
                 {
                     _md_buffers[i]->detach_buffer();
+                    _held_buffers.push_back(_md_buffers[i]);
                 }
                 _md_buffers.resize(0);
             }
@@ -5,6 +5,7 @@
 
 #include "backend.h"
 #include "types.h"
+#include "epoll-reactor.h"
 
 #include <cassert>
 #include <cstdlib>
@@ -117,10 +118,36 @@ namespace librealsense
         };
         static int xioctl(int fh, unsigned long request, void *arg);
 
+        // Shared by the capture buffers of a stream. Zero-copy frames may hold a buffer after its stream is closed,
+        // when the device descriptor may be closed or reused: buffers are only handed back to the kernel while
+        // the stream is alive, and expiring the stream waits for any hand-back in progress
+        class stream_token
+        {
+        public:
+            template<class F> bool if_alive(F f)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_alive)
+                    return false;
+                f();
+                return true;
+            }
+
+            void expire()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _alive = false;
+            }
+
+        private:
+            std::mutex _mutex;
+            bool _alive = true;
+        };
+
         class buffer
         {
         public:
-            buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index);
+            buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index, std::shared_ptr<stream_token> token);
 
             void prepare_for_streaming(int fd);
 
@@ -139,6 +166,9 @@ namespace librealsense
 
             bool use_memory_map() const { return _use_memory_map; }
 
+            // Runs f, which hands the buffer back to the kernel, unless the stream of the buffer is closed
+            template<class F> bool if_streaming(F f) { return _token->if_alive(f); }
+
         private:
             v4l2_buf_type _type;
             uint8_t* _start;
@@ -149,6 +179,7 @@ namespace librealsense
             v4l2_buffer _buf;
             std::mutex _mutex;
             bool _must_enqueue = false;
+            std::shared_ptr<stream_token> _token;
         };
 
         enum supported_kernel_buf_types : uint8_t
@@ -193,7 +224,7 @@ namespace librealsense
                 {
                     if (_data_buf && (!_managed))
                     {
-                        if (_file_desc > 0)
+                        if (_file_desc > 0) _data_buf->if_streaming([this]()
                         {
                             if (xioctl(_file_desc, (int)VIDIOC_QBUF, &_dq_buf) < 0)
                             {
@@ -211,7 +242,7 @@ namespace librealsense
                             }
                             else
                                 LOG_DEBUG_V4L("Enqueue (e) buf " << std::dec << _dq_buf.index << " for fd " << _file_desc);
-                        }
+                        });
                     }
                 }
 
@@ -252,7 +283,7 @@ namespace librealsense
             virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds, bool compressed_format) = 0;
         };
 
-        class v4l_uvc_device : public uvc_device, public v4l_uvc_interface
+        class v4l_uvc_device : public uvc_device, public v4l_uvc_interface, public epoll_reactor::source
         {
         public:
             static void foreach_uvc_device(
@@ -279,6 +310,10 @@ namespace librealsense
 
             void poll();
 
+            // epoll_reactor::source, used instead of the capture thread when the shared reactor is enabled
+            void on_ready(const std::vector<int>& fds) override;
+            void on_timeout() override;
+
             void set_power_state(power_state state) override;
             power_state get_power_state() const override { return _state; }
 
@@ -300,6 +335,8 @@ namespace librealsense
 
             std::string get_device_location() const override { return _device_path; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
+            // Kernel buffers are only re-queued by the frame continuation, see buffers_mgr
+            bool supports_zero_copy() const override { return true; }
 
         protected:
             static uint32_t get_cid(rs2_option option);
@@ -320,6 +357,13 @@ namespace librealsense
             virtual void stop_data_capture() override;
             virtual void acquire_metadata(buffers_mgr & buf_mgr,fd_set &fds, bool compressed_format = false) override;
 
+            void acquire_and_dispatch(fd_set& fds);
+
+            // Capture buffers of closed streams that frames still map (zero-copy capture). The kernel buffers
+            // are released once they are unmapped, before the next stream is configured
+            bool buffers_held();
+            void release_held_buffers();
+
             power_state _state = D3;
             std::string _name = "";
             std::string _device_path = "";
@@ -327,12 +371,15 @@ namespace librealsense
             uvc_device_info _info;
 
             std::vector<std::shared_ptr<buffer>> _buffers;
+            std::shared_ptr<stream_token> _stream_token;
+            std::vector<std::weak_ptr<buffer>> _held_buffers;
             stream_profile _profile;
             frame_callback _callback;
             std::atomic<bool> _is_capturing;
             std::atomic<bool> _is_alive;
             std::atomic<bool> _is_started;
             std::unique_ptr<std::thread> _thread;
+            std::shared_ptr<epoll_reactor> _reactor;
             std::unique_ptr<named_mutex> _named_mtx;
             bool _use_memory_map;
             int _max_fd = 0;                    // specifies the maximal pipe number the polling process will monitor
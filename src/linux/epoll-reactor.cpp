@@ -0,0 +1,261 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "epoll-reactor.h"
+#include "types.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        static const uint64_t WAKE_ID = 0;               // entry ids start from 1
+        static const int MAX_REACTOR_THREADS = 4;
+        static const int TIMEOUTS_CHECK_INTERVAL_MS = 500;
+
+        bool epoll_reactor::enabled()
+        {
+#ifdef V4L2_EPOLL_REACTOR
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        std::shared_ptr<epoll_reactor> epoll_reactor::get()
+        {
+            static std::mutex instance_mutex;
+            static std::weak_ptr<epoll_reactor> instance;
+
+            std::lock_guard<std::mutex> lock(instance_mutex);
+            auto reactor = instance.lock();
+            if (!reactor)
+            {
+                reactor = std::shared_ptr<epoll_reactor>(new epoll_reactor());
+                instance = reactor;
+            }
+            return reactor;
+        }
+
+        epoll_reactor::epoll_reactor()
+            : _epfd(-1), _wake_fd(-1), _running(true), _next_id(WAKE_ID + 1),
+              _last_timeouts_check(std::chrono::steady_clock::now())
+        {
+            _epfd = epoll_create1(EPOLL_CLOEXEC);
+            if (_epfd < 0)
+                throw linux_backend_exception("epoll_reactor: epoll_create1 failed");
+
+            _wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (_wake_fd < 0)
+            {
+                ::close(_epfd);
+                throw linux_backend_exception("epoll_reactor: eventfd failed");
+            }
+
+            // Level-triggered on purpose: once signalled, it wakes every reactor thread
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.u64 = WAKE_ID;
+            if (epoll_ctl(_epfd, EPOLL_CTL_ADD, _wake_fd, &ev) < 0)
+            {
+                ::close(_wake_fd);
+                ::close(_epfd);
+                throw linux_backend_exception("epoll_reactor: cannot register wake-up descriptor");
+            }
+
+            auto threads = std::max(1, std::min<int>(MAX_REACTOR_THREADS, std::thread::hardware_concurrency() / 2));
+            for (auto i = 0; i < threads; ++i)
+                _threads.emplace_back([this]() { run(); });
+            LOG_INFO("V4L2 epoll reactor started with " << threads << " threads");
+        }
+
+        epoll_reactor::~epoll_reactor()
+        {
+            _running = false;
+            uint64_t one = 1;
+            if (write(_wake_fd, &one, sizeof(one)) < 0)
+                LOG_ERROR("epoll_reactor: could not signal the reactor threads to stop");
+
+            for (auto&& t : _threads)
+                t.join();
+
+            ::close(_wake_fd);
+            ::close(_epfd);
+        }
+
+        void epoll_reactor::add(source* src, const std::vector<int>& fds, std::chrono::milliseconds timeout)
+        {
+            auto e = std::make_shared<entry>();
+            e->src = src;
+            e->fds = fds;
+            e->timeout = timeout;
+            e->last_event = std::chrono::steady_clock::now();
+            e->epfd = epoll_create1(EPOLL_CLOEXEC);
+            if (e->epfd < 0)
+                throw linux_backend_exception("epoll_reactor: epoll_create1 failed");
+
+            for (auto fd : fds)
+            {
+                epoll_event ev{};
+                ev.events = EPOLLIN;
+                ev.data.fd = fd;
+                if (epoll_ctl(e->epfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+                {
+                    ::close(e->epfd);
+                    throw linux_backend_exception(to_string() << "epoll_reactor: cannot register fd " << fd);
+                }
+            }
+
+            uint64_t id;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                id = _next_id++;
+                _entries[id] = e;
+            }
+
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLONESHOT;
+            ev.data.u64 = id;
+            if (epoll_ctl(_epfd, EPOLL_CTL_ADD, e->epfd, &ev) < 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _entries.erase(id);
+                }
+                ::close(e->epfd);
+                throw linux_backend_exception("epoll_reactor: cannot register source");
+            }
+        }
+
+        void epoll_reactor::remove(source* src)
+        {
+            std::shared_ptr<entry> e;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = std::find_if(_entries.begin(), _entries.end(),
+                    [src](const std::pair<const uint64_t, std::shared_ptr<entry>>& kvp) { return kvp.second->src == src; });
+                if (it == _entries.end())
+                    return;
+                e = it->second;
+                _entries.erase(it);
+            }
+
+            // Blocks until a callback that is already running for this source returns
+            std::lock_guard<std::mutex> lock(e->dispatch_mutex);
+            e->removed = true;
+            epoll_ctl(_epfd, EPOLL_CTL_DEL, e->epfd, nullptr);
+            ::close(e->epfd);
+        }
+
+        void epoll_reactor::run()
+        {
+            while (_running)
+            {
+                // One event per wake-up, so that ready sources are spread across the threads
+                epoll_event ev{};
+                auto n = epoll_wait(_epfd, &ev, 1, TIMEOUTS_CHECK_INTERVAL_MS);
+                if (n < 0)
+                {
+                    if (errno != EINTR)
+                        LOG_WARNING("epoll_reactor: epoll_wait failed, error = " << strerror(errno));
+                    continue;
+                }
+
+                if (n > 0 && ev.data.u64 != WAKE_ID)
+                    dispatch(ev.data.u64);
+
+                check_timeouts();
+            }
+        }
+
+        void epoll_reactor::dispatch(uint64_t id)
+        {
+            std::shared_ptr<entry> e;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _entries.find(id);
+                if (it == _entries.end())
+                    return;
+                e = it->second;
+            }
+
+            std::lock_guard<std::mutex> lock(e->dispatch_mutex);
+            if (e->removed)
+                return;
+
+            epoll_event events[8];
+            auto n = epoll_wait(e->epfd, events, sizeof(events) / sizeof(events[0]), 0);
+            if (n > 0)
+            {
+                std::vector<int> ready;
+                for (auto i = 0; i < n; ++i)
+                    ready.push_back(events[i].data.fd);
+
+                e->last_event = std::chrono::steady_clock::now();
+                try
+                {
+                    e->src->on_ready(ready);
+                }
+                catch (const std::exception& ex)
+                {
+                    LOG_ERROR("epoll_reactor: " << ex.what());
+                }
+            }
+
+            rearm(*e, id);
+        }
+
+        void epoll_reactor::rearm(const entry& e, uint64_t id)
+        {
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLONESHOT;
+            ev.data.u64 = id;
+            if (epoll_ctl(_epfd, EPOLL_CTL_MOD, e.epfd, &ev) < 0)
+                LOG_ERROR("epoll_reactor: failed to re-arm source, error = " << strerror(errno));
+        }
+
+        void epoll_reactor::check_timeouts()
+        {
+            std::unique_lock<std::mutex> check_lock(_timeouts_mutex, std::try_to_lock);
+            if (!check_lock)
+                return;
+
+            auto now = std::chrono::steady_clock::now();
+            if (now - _last_timeouts_check < std::chrono::milliseconds(TIMEOUTS_CHECK_INTERVAL_MS))
+                return;
+            _last_timeouts_check = now;
+
+            std::vector<std::shared_ptr<entry>> entries;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (auto&& kvp : _entries)
+                    entries.push_back(kvp.second);
+            }
+
+            for (auto&& e : entries)
+            {
+                // A source that is being serviced right now is evidently not timing out
+                std::unique_lock<std::mutex> lock(e->dispatch_mutex, std::try_to_lock);
+                if (!lock || e->removed || (now - e->last_event < e->timeout))
+                    continue;
+
+                e->last_event = now;
+                try
+                {
+                    e->src->on_timeout();
+                }
+                catch (const std::exception& ex)
+                {
+                    LOG_ERROR("epoll_reactor: " << ex.what());
+                }
+            }
+        }
+    }
+}
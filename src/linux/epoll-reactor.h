@@ -0,0 +1,85 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Services the capture descriptors of many devices (video, metadata and HID nodes)
+        // on a small pool of threads shared by the whole process, instead of a select() loop
+        // thread per node. Enabled with the ENABLE_V4L2_EPOLL_REACTOR build option.
+        //
+        // Every source owns a private epoll set holding its descriptors, and that set is
+        // registered in the reactor as a single EPOLLONESHOT entry. Consequently a source is
+        // never serviced by two threads at once, and since it handles one cycle per wake-up
+        // before being re-armed, a busy device cannot starve the others (per-device fairness).
+        class epoll_reactor
+        {
+        public:
+            class source
+            {
+            public:
+                // Called with the descriptors of this source that are ready for reading
+                virtual void on_ready(const std::vector<int>& fds) = 0;
+                // Called when none of the descriptors became ready within the source timeout
+                virtual void on_timeout() = 0;
+
+                virtual ~source() = default;
+            };
+
+            static bool enabled();
+
+            // The reactor lives as long as at least one source holds it. As with the per-device
+            // capture threads, the last reference must not be dropped from a reactor thread
+            static std::shared_ptr<epoll_reactor> get();
+
+            ~epoll_reactor();
+
+            void add(source* src, const std::vector<int>& fds, std::chrono::milliseconds timeout);
+
+            // Waits for an in-flight on_ready/on_timeout of the source to complete.
+            // Must not be called from within a callback of the same source
+            void remove(source* src);
+
+        private:
+            struct entry
+            {
+                source* src;
+                int epfd;
+                std::vector<int> fds;
+                std::chrono::milliseconds timeout;
+                std::chrono::steady_clock::time_point last_event;
+                std::mutex dispatch_mutex;
+                bool removed = false;
+            };
+
+            epoll_reactor();
+
+            void run();
+            void dispatch(uint64_t id);
+            void check_timeouts();
+            void rearm(const entry& e, uint64_t id);
+
+            int _epfd;
+            int _wake_fd;
+            std::atomic<bool> _running;
+            std::vector<std::thread> _threads;
+
+            std::mutex _mutex;
+            uint64_t _next_id;
+            std::map<uint64_t, std::shared_ptr<entry>> _entries;
+            std::mutex _timeouts_mutex;
+            std::chrono::steady_clock::time_point _last_timeouts_check;
+        };
+    }
+}
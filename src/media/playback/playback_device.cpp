@@ -320,7 +320,7 @@ void playback_device::resume()
         auto total_duration = m_reader->query_duration();
         if (m_last_published_timestamp >= total_duration)
             m_last_published_timestamp = device_serializer::nanoseconds(0);
-        m_reader->reset();
+        //Seeking rebuilds the samples view, there is no need to reopen the file (and read its index again)
         m_reader->seek_to_time(m_last_published_timestamp);
         while (m_last_published_timestamp != device_serializer::nanoseconds(0) && !m_reader->read_next_data()->is<serialized_frame>());
 
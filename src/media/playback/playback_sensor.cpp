@@ -162,6 +162,10 @@ bool playback_sensor::is_streaming() const
 {
     return m_is_started;
 }
+void playback_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+{
+    throw not_implemented_exception("Frame allocators are not supported by playback sensors");
+}
 bool playback_sensor::extend_to(rs2_extension extension_type, void** ext)
 {
     std::shared_ptr<extension_snapshot> e = m_sensor_description.get_sensor_extensions_snapshots().find(extension_type);
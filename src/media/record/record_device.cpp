@@ -10,10 +10,16 @@
 using namespace librealsense;
 
 librealsense::record_device::record_device(std::shared_ptr<librealsense::device_interface> device,
-                                      std::shared_ptr<librealsense::device_serializer::writer> serializer):
+                                      std::shared_ptr<librealsense::device_serializer::writer> serializer,
+                                      const record_queue_settings& queue_settings):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
     m_is_recording(true),
-    m_record_pause_time(0)
+    m_record_pause_time(0),
+    m_queue_settings(queue_settings),
+    m_queue_statistics(),
+    m_next_write_sequence(0),
+    m_next_written_sequence(0),
+    m_is_stopping(false)
 {
     if (device == nullptr)
     {
@@ -27,6 +33,12 @@ librealsense::record_device::record_device(std::shared_ptr<librealsense::device_
 
     m_device = device;
     m_ros_writer = serializer;
+    for (uint32_t i = 0; i < m_queue_settings.serialization_threads; i++)
+    {
+        // The queue budget is enforced by write_data, before the frames reach these threads
+        m_serialization_threads.push_back(std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max()));
+        m_serialization_threads.back()->start();
+    }
     (*m_write_thread)->start(); //Start thread before creating the sensors (since they might write right away)
     m_sensors = create_record_sensors(m_device);
     LOG_DEBUG("Created record_device");
@@ -60,10 +72,20 @@ librealsense::record_device::~record_device()
         s->on_extension_change -= m_on_extension_change_token;
         s->disable_recording();
     }
-    if ((*m_write_thread)->flush() == false)
+    {
+        //Release the sensors blocked on a full queue
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_is_stopping = true;
+    }
+    m_queue_space_cv.notify_all();
+    if (flush_writes() == false)
     {
         LOG_ERROR("Error - timeout waiting for flush, possible deadlock detected");
     }
+    for (auto&& t : m_serialization_threads)
+    {
+        t->stop();
+    }
     (*m_write_thread)->stop();
     //Just in case someone still holds a reference to the sensors,
     // we make sure that they will not try to record anything
@@ -124,53 +146,193 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         initialize_recording();
     });
 
-    //TODO: restore: uint64_t data_size = frame.frame->get_frame_data_size();
-    uint64_t cached_data_size = m_cached_data_size; //TODO: restore: (+ data_size)
-    if (cached_data_size > MAX_CACHED_DATA_SIZE)
+    if (!frame)
+    {
+        return;
+    }
+
+    uint64_t data_size = frame.frame->get_frame_data_size();
+    if (!reserve_queue_space(data_size))
     {
-        LOG_WARNING("Recorder reached maximum cache size, frame dropped");
-        on_error("Recorder reached maximum cache size, frame dropped");
+        LOG_DEBUG("Recorder queue is full, frame " << frame.frame->get_frame_number() << " from sensor " << sensor_index << " dropped");
         return;
     }
 
-    m_cached_data_size = cached_data_size;
     auto capture_time = get_capture_time();
+    auto queued_time = std::chrono::high_resolution_clock::now();
+    const uint32_t device_index = 0;
+    auto stream_type = frame.frame->get_stream()->get_stream_type();
+    auto stream_index = static_cast<uint32_t>(frame.frame->get_stream()->get_stream_index());
+    device_serializer::stream_identifier stream_id{ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index };
     //TODO: remove usage of shared pointer when frame_holder is copyable
-    auto frame_holder_ptr = std::make_shared<frame_holder>();
-    *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
-        if (m_is_recording == false)
+    auto frame_holder_ptr = std::make_shared<frame_holder>(std::move(frame));
+
+    auto prepare = [this, stream_id, capture_time, frame_holder_ptr, on_error]() -> std::function<void()>
+    {
+        try
         {
-            return; //Recording is paused
+            return m_ros_writer->prepare_frame(stream_id, capture_time, std::move(*frame_holder_ptr));
         }
-        std::call_once(m_first_frame_flag, [&]()
+        catch (std::exception& e)
+        {
+            on_error(to_string() << "Failed to write frame. " << e.what());
+            return nullptr;
+        }
+    };
+
+    //Runs on the writing thread, in recording order
+    auto write = [this, data_size, queued_time, on_error](std::function<void()> write_frame)
+    {
+        bool written = false;
+        if (m_is_recording && write_frame)
         {
+            std::call_once(m_first_frame_flag, [&]()
+            {
+                try
+                {
+                    write_header();
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Failed to write header. " << e.what());
+                    on_error(to_string() << "Failed to write header. " << e.what());
+                }
+            });
+
             try
             {
-                write_header();
+                write_frame();
+                written = true;
             }
-            catch (const std::exception& e)
+            catch (std::exception& e)
             {
-                LOG_ERROR("Failed to write header. " << e.what());
-                on_error(to_string() << "Failed to write header. " << e.what());
+                on_error(to_string() << "Failed to write frame. " << e.what());
             }
+        }
+        release_queue_space(data_size, queued_time, written);
+    };
+
+    if (m_serialization_threads.empty())
+    {
+        (*m_write_thread)->invoke([this, prepare, write](dispatcher::cancellable_timer t)
+        {
+            //Frames are not serialized while recording is paused
+            write(m_is_recording ? prepare() : nullptr);
         });
+        return;
+    }
 
-        try
+    auto sequence = reserve_write_sequence();
+    auto& serialization_thread = m_serialization_threads[sequence % m_serialization_threads.size()];
+    serialization_thread->invoke([this, sequence, prepare, write](dispatcher::cancellable_timer t)
+    {
+        auto write_frame = prepare();
+        schedule_write(sequence, [write, write_frame]() { write(write_frame); });
+    });
+}
+
+bool librealsense::record_device::reserve_queue_space(uint64_t data_size)
+{
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    auto max_bytes = m_queue_settings.max_queued_bytes;
+    //A frame larger than the whole budget is still accepted into an empty queue
+    auto has_space = [&]() { return m_is_stopping || max_bytes == 0 || m_queue_statistics.queued_bytes == 0 ||
+                                    m_queue_statistics.queued_bytes + data_size <= max_bytes; };
+    if (!has_space())
+    {
+        if (m_queue_settings.policy == RS2_RECORD_QUEUE_POLICY_DROP_NEWEST)
         {
-            const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+            m_queue_statistics.dropped_frames++;
+            return false;
+        }
+        m_queue_space_cv.wait(lock, has_space);
+    }
+    if (m_is_stopping)
+    {
+        return false;
+    }
+    m_queue_statistics.queued_bytes += data_size;
+    return true;
+}
+
+void librealsense::record_device::release_queue_space(uint64_t data_size, std::chrono::high_resolution_clock::time_point queued_time, bool written)
+{
+    auto latency = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - queued_time).count();
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_queue_statistics.queued_bytes -= data_size;
+        if (written)
+        {
+            auto& stats = m_queue_statistics;
+            stats.average_write_latency += (latency - stats.average_write_latency) / ++stats.written_frames;
+            stats.max_write_latency = std::max(stats.max_write_latency, latency);
         }
-        catch(std::exception& e)
+    }
+    m_queue_space_cv.notify_all();
+}
+
+uint64_t librealsense::record_device::reserve_write_sequence()
+{
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    return m_next_write_sequence++;
+}
+
+void librealsense::record_device::schedule_write(uint64_t sequence, std::function<void()> write)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_pending_writes[sequence] = std::move(write);
+    }
+    (*m_write_thread)->invoke([this](dispatcher::cancellable_timer t)
+    {
+        //Run every write whose predecessors were all written
+        while (true)
         {
-            on_error(to_string() << "Failed to write frame. " << e.what());
+            std::function<void()> next;
+            {
+                std::lock_guard<std::mutex> lock(m_queue_mutex);
+                auto it = m_pending_writes.find(m_next_written_sequence);
+                if (it == m_pending_writes.end())
+                    return;
+                next = std::move(it->second);
+                m_pending_writes.erase(it);
+                m_next_written_sequence++;
+            }
+            next();
         }
     });
 }
 
+void librealsense::record_device::submit_write(std::function<void()> write)
+{
+    if (m_serialization_threads.empty())
+    {
+        (*m_write_thread)->invoke([write](dispatcher::cancellable_timer t) { write(); });
+    }
+    else
+    {
+        //Keep the order relative to the frames still being serialized
+        schedule_write(reserve_write_sequence(), std::move(write));
+    }
+}
+
+bool librealsense::record_device::flush_writes()
+{
+    //Once the serialization threads are flushed, all their frames are scheduled on the writing thread
+    bool flushed = true;
+    for (auto&& t : m_serialization_threads)
+    {
+        flushed = t->flush() && flushed;
+    }
+    return (*m_write_thread)->flush() && flushed;
+}
+
+rs2_record_statistics librealsense::record_device::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    return m_queue_statistics;
+}
+
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
 {
     return m_device->get_info(info);
@@ -275,7 +437,7 @@ void librealsense::record_device::write_device_extension_changes(const T& ext)
         return;
     }
     auto capture_time = get_capture_time();
-    (*m_write_thread)->invoke([this, capture_time, ext_snapshot](dispatcher::cancellable_timer t)
+    submit_write([this, capture_time, ext_snapshot]()
     {
         try
         {
@@ -295,7 +457,7 @@ void record_device::write_sensor_extension_snapshot(size_t sensor_index,
     std::function<void(std::string const&)> on_error)
 {
     auto capture_time = get_capture_time();
-    (*m_write_thread)->invoke([this, sensor_index, capture_time, ext, snapshot, on_error](dispatcher::cancellable_timer t)
+    submit_write([this, sensor_index, capture_time, ext, snapshot, on_error]()
     {
         try
         {
@@ -312,7 +474,7 @@ void record_device::write_sensor_extension_snapshot(size_t sensor_index,
 void librealsense::record_device::write_notification(size_t sensor_index, const notification& n)
 {
     auto capture_time = get_capture_time();
-    (*m_write_thread)->invoke([this, sensor_index, capture_time, n](dispatcher::cancellable_timer t)
+    submit_write([this, sensor_index, capture_time, n]()
     {
         try
         {
@@ -375,7 +537,7 @@ void librealsense::record_device::pause_recording()
 {
     LOG_INFO("Record Pause called");
 
-    (*m_write_thread)->invoke([this](dispatcher::cancellable_timer c)
+    submit_write([this]()
     {
         LOG_DEBUG("Record pause invoked");
 
@@ -387,13 +549,13 @@ void librealsense::record_device::pause_recording()
         m_is_recording = false;
         LOG_DEBUG("Time of pause: " << m_time_of_pause.time_since_epoch().count());
     });
-    (*m_write_thread)->flush();
+    flush_writes();
     LOG_INFO("Record paused");
 }
 void librealsense::record_device::resume_recording()
 {
     LOG_INFO("Record resume called");
-    (*m_write_thread)->invoke([this](dispatcher::cancellable_timer c)
+    submit_write([this]()
     {
         LOG_DEBUG("Record resume invoked");
         if (m_is_recording)
@@ -424,7 +586,6 @@ void record_device::initialize_recording()
 {
     //Expected to be called once when recording to file actually starts
     m_capture_time_base = std::chrono::high_resolution_clock::now();
-    m_cached_data_size = 0;
 }
 void record_device::stop_gracefully(to_string error_msg)
 {
@@ -13,14 +13,20 @@
 
 namespace librealsense
 {
+    struct record_queue_settings
+    {
+        uint64_t max_queued_bytes = 0;        // Budget for the frame data waiting to be written, 0 for no limit
+        rs2_record_queue_policy policy = RS2_RECORD_QUEUE_POLICY_DROP_NEWEST;   // What to do with a frame that does not fit in the budget
+        uint32_t serialization_threads = 0;   // Threads serializing frames ahead of the writing thread, 0 to serialize on the writing thread
+    };
+
     class record_device : public device_interface,
                           public extendable_interface,
                           public info_container
     {
     public:
-        static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS
-
-        record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer);
+        record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer,
+                      const record_queue_settings& queue_settings = record_queue_settings());
         virtual ~record_device();
 
         std::shared_ptr<context> get_context() const override;
@@ -39,6 +45,7 @@ namespace librealsense
         void pause_recording();
         void resume_recording();
         const std::string& get_filename() const;
+        rs2_record_statistics get_statistics() const;
         platform::backend_device_group get_device_data() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
@@ -55,6 +62,12 @@ namespace librealsense
         void write_header();
         std::chrono::nanoseconds get_capture_time() const;
         void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error);
+        bool reserve_queue_space(uint64_t data_size);
+        void release_queue_space(uint64_t data_size, std::chrono::high_resolution_clock::time_point queued_time, bool written);
+        uint64_t reserve_write_sequence();
+        void schedule_write(uint64_t sequence, std::function<void()> write);
+        void submit_write(std::function<void()> write);
+        bool flush_writes();
         void write_sensor_extension_snapshot(size_t sensor_index, rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot, std::function<void(std::string const&)> on_error);
         void write_notification(size_t sensor_index, const notification& n);
         std::vector<std::shared_ptr<record_sensor>> create_record_sensors(std::shared_ptr<device_interface> m_device);
@@ -64,6 +77,7 @@ namespace librealsense
         std::vector<std::shared_ptr<record_sensor>> m_sensors;
 
         lazy<std::shared_ptr<dispatcher>> m_write_thread;
+        std::vector<std::shared_ptr<dispatcher>> m_serialization_threads;
         std::shared_ptr<device_serializer::writer> m_ros_writer;
 
         std::chrono::high_resolution_clock::time_point m_capture_time_base;
@@ -76,7 +90,16 @@ namespace librealsense
         int m_on_notification_token;
         int m_on_frame_token;
         int m_on_extension_change_token;
-        uint64_t m_cached_data_size;
+
+        record_queue_settings m_queue_settings;
+        mutable std::mutex m_queue_mutex;
+        std::condition_variable m_queue_space_cv;
+        rs2_record_statistics m_queue_statistics;
+        uint64_t m_next_write_sequence;       // Sequence of the next write submitted with serialization threads
+        uint64_t m_next_written_sequence;     // Sequence of the next write to run on the writing thread
+        std::map<uint64_t, std::function<void()>> m_pending_writes;
+        bool m_is_stopping;
+
         std::once_flag m_first_call_flag;
         void initialize_recording();
         void stop_gracefully(to_string error_msg);
@@ -131,6 +131,10 @@ bool librealsense::record_sensor::is_streaming() const
 {
     return m_sensor.is_streaming();
 }
+void librealsense::record_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+{
+    m_sensor.set_frame_allocator(allocator);
+}
 
 template <rs2_extension E, typename P>
 bool librealsense::record_sensor::extend_to_aux(P* p, void** ext)
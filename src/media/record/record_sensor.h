@@ -35,6 +35,7 @@ namespace librealsense
         void start(frame_callback_ptr callback) override;
         void stop() override;
         bool is_streaming() const override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         bool extend_to(rs2_extension extension_type, void** ext) override;
         device_interface& get_device() override;
         frame_callback_ptr get_frames_callback() const override;
@@ -27,7 +27,9 @@ namespace librealsense
         m_total_duration(0),
         m_file_path(file),
         m_context(ctx),
-        m_version(0)
+        m_version(0),
+        m_prefetch_done(false),
+        m_prefetch_stopped(false)
     {
         try
         {
@@ -41,12 +43,101 @@ namespace librealsense
         }
     }
 
+    ros_reader::~ros_reader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+            m_prefetch_stopped = true;
+        }
+        m_prefetch_cv.notify_all();
+        if (m_prefetch_thread)
+            m_prefetch_thread->stop();
+    }
+
     device_snapshot ros_reader::query_device_description(const nanoseconds& time)
     {
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
         return read_device_description(time);
     }
 
     std::shared_ptr<serialized_data> ros_reader::read_next_data()
+    {
+        if (!m_prefetch_thread)
+        {
+            //Reading, decompressing and deserializing the next samples overlaps with the processing of the current ones
+            m_prefetch_thread.reset(new active_object<>([this](dispatcher::cancellable_timer t) { prefetch_next_data(); }));
+            m_prefetch_thread->start();
+        }
+
+        prefetched_data next;
+        {
+            std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+            m_prefetch_cv.wait(lock, [this]() { return !m_prefetched.empty() || m_prefetch_done; });
+            if (m_prefetched.empty())
+            {
+                //Past the end of the file, or an error, which are raised again
+                lock.unlock();
+                std::lock_guard<std::mutex> file_lock(m_file_mutex);
+                return read_next_data_from_file();
+            }
+            next = std::move(m_prefetched.front());
+            m_prefetched.pop_front();
+        }
+        m_prefetch_cv.notify_all();
+
+        if (next.error)
+        {
+            std::rethrow_exception(next.error);
+        }
+        return next.data;
+    }
+
+    void ros_reader::prefetch_next_data()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_prefetch_mutex);
+            m_prefetch_cv.wait(lock, [this]() { return m_prefetch_stopped || (!m_prefetch_done && m_prefetched.size() < PREFETCH_DEPTH); });
+            if (m_prefetch_stopped)
+                return;
+        }
+
+        //The sample is queued before releasing the file, so that rewind_prefetched_data() sees it
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        prefetched_data next;
+        next.position = m_samples_itrator;
+        try
+        {
+            next.data = read_next_data_from_file();
+        }
+        catch (...)
+        {
+            next.error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+            m_prefetch_done = next.error || next.data->is<serialized_end_of_file>();
+            m_prefetched.push_back(std::move(next));
+        }
+        m_prefetch_cv.notify_all();
+    }
+
+    void ros_reader::rewind_prefetched_data()
+    {
+        //Called with m_file_mutex locked: moves the samples iterator back to the first sample not returned by read_next_data()
+        {
+            std::lock_guard<std::mutex> lock(m_prefetch_mutex);
+            if (!m_prefetched.empty())
+            {
+                m_samples_itrator = m_prefetched.front().position;
+                m_prefetched.clear();
+            }
+            m_prefetch_done = false;
+        }
+        m_prefetch_cv.notify_all();
+    }
+
+    std::shared_ptr<serialized_data> ros_reader::read_next_data_from_file()
     {
         if (m_samples_view == nullptr || m_samples_itrator == m_samples_view->end())
         {
@@ -98,6 +189,8 @@ namespace librealsense
         {
             throw invalid_value_exception(to_string() << "Requested time is out of playback length. (Requested = " << seek_time.count() << ", Duration = " << m_total_duration.count() << ")");
         }
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        rewind_prefetched_data();
         auto seek_time_as_secs = std::chrono::duration_cast<std::chrono::duration<double>>(seek_time);
         auto seek_time_as_rostime = rs2rosinternal::Time(seek_time_as_secs.count());
 
@@ -115,34 +208,50 @@ namespace librealsense
 
     std::vector<std::shared_ptr<serialized_data>> ros_reader::fetch_last_frames(const nanoseconds& seek_time)
     {
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
         std::vector<std::shared_ptr<serialized_data>> result;
-        rosbag::View view(m_file, FalseQuery());
         auto as_rostime = to_rostime(seek_time);
-        auto start_time = to_rostime(get_static_file_info_timestamp());
 
         for (auto topic : m_enabled_streams_topics)
         {
-            view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
+            auto& index = get_topic_index(topic);
+            if (!index.is_frame)
+                continue;
+
+            //The last frame at or before the seek time
+            auto next = std::upper_bound(index.times.begin(), index.times.end(), as_rostime);
+            if (next == index.times.begin())
+                continue;
+            auto frame_time = *std::prev(next);
+
+            rosbag::View view(m_file, rosbag::TopicQuery(topic), frame_time, frame_time);
+            auto msg = view.begin();
+            if (msg == view.end())
+                continue;
+            result.push_back(create_frame(*msg));
         }
-        std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
+        return result;
+    }
+
+    const ros_reader::topic_index& ros_reader::get_topic_index(const std::string& topic)
+    {
+        auto it = m_topics_index.find(topic);
+        if (it != m_topics_index.end())
+            return it->second;
+
+        //Built once per topic from the bag index, without reading the messages
+        topic_index index{ false, {} };
+        rosbag::View view(m_file, rosbag::TopicQuery(topic));
+        index.times.reserve(view.size());
         for (auto&& m : view)
         {
-            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
-            {
-                auto id = ros_topic::get_stream_identifier(m.getTopic());
-                last_frames[id] = m.getTime();
-            }
+            if (index.times.empty())
+                index.is_frame = m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>();
+            index.times.push_back(m.getTime());
         }
-        for (auto&& kvp : last_frames)
-        {
-            auto topic = ros_topic::frame_data_topic(kvp.first);
-            rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
-            auto msg = view.begin();
-            auto new_frame = create_frame(*msg);
-            result.push_back(new_frame);
-        }
-        return result;
+        return m_topics_index[topic] = std::move(index);
     }
+
     nanoseconds ros_reader::query_duration() const
     {
         return m_total_duration;
@@ -150,6 +259,9 @@ namespace librealsense
 
     void ros_reader::reset()
     {
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        rewind_prefetched_data();
+        m_topics_index.clear();
         m_file.close();
         m_file.open(m_file_path, rosbag::BagMode::Read);
         m_version = read_file_version(m_file);
@@ -161,6 +273,8 @@ namespace librealsense
 
     void ros_reader::enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
     {
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        rewind_prefetched_data();
         rs2rosinternal::Time start_time = rs2rosinternal::TIME_MIN + rs2rosinternal::Duration{ 0, 1 }; //first non 0 timestamp and afterward
         if (m_samples_view == nullptr) //Starting to stream
         {
@@ -205,6 +319,8 @@ namespace librealsense
 
     void ros_reader::disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
     {
+        std::lock_guard<std::mutex> file_lock(m_file_mutex);
+        rewind_prefetched_data();
         if (m_samples_view == nullptr)
         {
             return;
@@ -2,7 +2,9 @@
 // Copyright(c) 2017 Intel Corporation. All Rights Reserved.
 
 #pragma once
+#include <deque>
 #include <core/serialization.h>
+#include "concurrency.h"
 #include "rosbag/view.h"
 #include "ros_file_format.h"
 
@@ -14,6 +16,7 @@ namespace librealsense
     {
     public:
         ros_reader(const std::string& file, const std::shared_ptr<context>& ctx);
+        ~ros_reader();
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
         void seek_to_time(const nanoseconds& seek_time) override;
@@ -24,7 +27,29 @@ namespace librealsense
         virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         const std::string& get_file_name() const override;
 
+        // Number of samples read ahead of read_next_data() by the prefetch thread
+        static const size_t PREFETCH_DEPTH = 8;
+
     private:
+        // A sample read ahead, with the position of the samples iterator before it was read
+        struct prefetched_data
+        {
+            rosbag::View::iterator position;
+            std::shared_ptr<serialized_data> data;
+            std::exception_ptr error;
+        };
+
+        // Times of the messages of a topic, in the order of the bag index
+        struct topic_index
+        {
+            bool is_frame;
+            std::vector<rs2rosinternal::Time> times;
+        };
+
+        std::shared_ptr<serialized_data> read_next_data_from_file();
+        void prefetch_next_data();
+        void rewind_prefetched_data();
+        const topic_index& get_topic_index(const std::string& topic);
 
         template <typename ROS_TYPE>
         static typename ROS_TYPE::ConstPtr instantiate_msg(const rosbag::MessageInstance& msg)
@@ -143,5 +168,15 @@ namespace librealsense
         std::vector<std::string>                m_enabled_streams_topics;
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
+        std::map<std::string, topic_index>      m_topics_index;
+
+        // The bag is accessed by a single thread at a time, the prefetch thread or the reader's user
+        std::mutex                              m_file_mutex;
+        std::mutex                              m_prefetch_mutex;
+        std::condition_variable                 m_prefetch_cv;
+        std::deque<prefetched_data>             m_prefetched;
+        bool                                    m_prefetch_done;    // The last sample read ahead is the end of file, or an error
+        bool                                    m_prefetch_stopped;
+        std::unique_ptr<active_object<>>        m_prefetch_thread;
     };
 }
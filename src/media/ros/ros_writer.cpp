@@ -48,23 +48,25 @@ namespace librealsense
 
     void ros_writer::write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
+        prepare_frame(stream_id, timestamp, std::move(frame))();
+    }
+
+    std::function<void()> ros_writer::prepare_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    {
+        auto messages = std::make_shared<frame_messages>();
         if (Is<video_frame>(frame.frame))
         {
-            write_video_frame(stream_id, timestamp, std::move(frame));
-            return;
+            prepare_video_frame(stream_id, timestamp, frame, *messages);
         }
-
-        if (Is<motion_frame>(frame.frame))
+        else if (Is<motion_frame>(frame.frame))
         {
-            write_motion_frame(stream_id, timestamp, std::move(frame));
-            return;
+            prepare_motion_frame(stream_id, timestamp, frame, *messages);
         }
-
-        if (Is<pose_frame>(frame.frame))
+        else if (Is<pose_frame>(frame.frame))
         {
-            write_pose_frame(stream_id, timestamp, std::move(frame));
-            return;
+            prepare_pose_frame(stream_id, timestamp, frame, *messages);
         }
+        return [this, messages]() { messages->write(*this); };
     }
 
     void ros_writer::write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot)
@@ -89,18 +91,18 @@ namespace librealsense
         write_message(ros_topic::file_version_topic(), get_static_file_info_timestamp(), msg);
     }
 
-    void ros_writer::write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame)
+    void ros_writer::prepare_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame, frame_messages& messages)
     {
         auto metadata_topic = ros_topic::frame_metadata_topic(stream_id);
         diagnostic_msgs::KeyValue system_time;
         system_time.key = SYSTEM_TIME_MD_STR;
         system_time.value = std::to_string(frame->get_frame_system_time());
-        write_message(metadata_topic, timestamp, system_time);
+        messages.add(metadata_topic, timestamp, system_time);
 
         diagnostic_msgs::KeyValue timestamp_domain;
         timestamp_domain.key = TIMESTAMP_DOMAIN_MD_STR;
         timestamp_domain.value = librealsense::get_string(frame->get_frame_timestamp_domain());
-        write_message(metadata_topic, timestamp, timestamp_domain);
+        messages.add(metadata_topic, timestamp, timestamp_domain);
 
         for (int i = 0; i < static_cast<rs2_frame_metadata_value>(rs2_frame_metadata_value::RS2_FRAME_METADATA_COUNT); i++)
         {
@@ -111,16 +113,19 @@ namespace librealsense
                 diagnostic_msgs::KeyValue md_msg;
                 md_msg.key = librealsense::get_string(type);
                 md_msg.value = std::to_string(md);
-                write_message(metadata_topic, timestamp, md_msg);
+                messages.add(metadata_topic, timestamp, md_msg);
             }
         }
     }
 
-    void ros_writer::write_extrinsics(const stream_identifier& stream_id, frame_interface* frame)
+    void ros_writer::prepare_extrinsics(const stream_identifier& stream_id, frame_interface* frame, frame_messages& messages)
     {
-        if (m_extrinsics_msgs.find(stream_id) != m_extrinsics_msgs.end())
         {
-            return; //already wrote it
+            std::lock_guard<std::mutex> lock(m_extrinsics_mutex);
+            if (m_extrinsics_msgs.find(stream_id) != m_extrinsics_msgs.end())
+            {
+                return; //already wrote it
+            }
         }
         auto& dev = frame->get_sensor()->get_device();
         uint32_t reference_id = 0;
@@ -128,8 +133,20 @@ namespace librealsense
         std::tie(reference_id, ext) = dev.get_extrinsics(*frame->get_stream());
         geometry_msgs::Transform tf_msg;
         convert(ext, tf_msg);
-        write_message(ros_topic::stream_extrinsic_topic(stream_id, reference_id), get_static_file_info_timestamp(), tf_msg);
-        m_extrinsics_msgs[stream_id] = tf_msg;
+
+        //Prepared frames are not all written (e.g. while recording is paused): the extrinsics are marked as
+        //written by the first frame of the stream that writes them
+        auto topic = ros_topic::stream_extrinsic_topic(stream_id, reference_id);
+        messages.add([stream_id, topic, tf_msg](ros_writer& writer)
+        {
+            std::lock_guard<std::mutex> lock(writer.m_extrinsics_mutex);
+            if (writer.m_extrinsics_msgs.find(stream_id) != writer.m_extrinsics_msgs.end())
+            {
+                return;
+            }
+            writer.write_message(topic, get_static_file_info_timestamp(), tf_msg);
+            writer.m_extrinsics_msgs[stream_id] = tf_msg;
+        });
     }
 
     realsense_msgs::Notification ros_writer::to_notification_msg(const notification& n)
@@ -150,11 +167,11 @@ namespace librealsense
         write_message(ros_topic::notification_topic({ sensor_id.device_index, sensor_id.sensor_index }, n.category), timestamp, noti_msg);
     }
 
-    void ros_writer::write_additional_frame_messages(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame)
+    void ros_writer::prepare_additional_frame_messages(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame, frame_messages& messages)
     {
         try
         {
-            write_frame_metadata(stream_id, timestamp, frame);
+            prepare_frame_metadata(stream_id, timestamp, frame, messages);
         }
         catch (std::exception const& e)
         {
@@ -163,7 +180,7 @@ namespace librealsense
 
         try
         {
-            write_extrinsics(stream_id, frame);
+            prepare_extrinsics(stream_id, frame, messages);
         }
         catch (std::exception const& e)
         {
@@ -171,7 +188,7 @@ namespace librealsense
         }
     }
 
-    void ros_writer::write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    void ros_writer::prepare_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame, frame_messages& messages)
     {
         sensor_msgs::Image image;
         auto vid_frame = dynamic_cast<librealsense::video_frame*>(frame.frame);
@@ -191,11 +208,11 @@ namespace librealsense
         std::string TODO_CORRECT_ME = "0";
         image.header.frame_id = TODO_CORRECT_ME;
         auto image_topic = ros_topic::frame_data_topic(stream_id);
-        write_message(image_topic, timestamp, image);
-        write_additional_frame_messages(stream_id, timestamp, frame);
+        messages.add(image_topic, timestamp, std::move(image));
+        prepare_additional_frame_messages(stream_id, timestamp, frame, messages);
     }
 
-    void ros_writer::write_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    void ros_writer::prepare_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame, frame_messages& messages)
     {
         sensor_msgs::Imu imu_msg;
         if (!frame)
@@ -228,8 +245,8 @@ namespace librealsense
         }
 
         auto topic = ros_topic::frame_data_topic(stream_id);
-        write_message(topic, timestamp, imu_msg);
-        write_additional_frame_messages(stream_id, timestamp, frame);
+        messages.add(topic, timestamp, imu_msg);
+        prepare_additional_frame_messages(stream_id, timestamp, frame, messages);
     }
 
     inline geometry_msgs::Vector3 ros_writer::to_vector3(const float3& f)
@@ -251,7 +268,7 @@ namespace librealsense
         return q;
     }
 
-    void ros_writer::write_pose_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
+    void ros_writer::prepare_pose_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame, frame_messages& messages)
     {
         auto pose = As<librealsense::pose_frame>(frame.frame);
         if (!frame)
@@ -276,9 +293,9 @@ namespace librealsense
         std::string twist_topic = ros_topic::pose_twist_topic(stream_id);
 
         //Write the the pose frame as 3 separate messages (each with different topic)
-        write_message(transform_topic, timestamp, transform);
-        write_message(accel_topic, timestamp, accel);
-        write_message(twist_topic, timestamp, twist);
+        messages.add(transform_topic, timestamp, transform);
+        messages.add(accel_topic, timestamp, accel);
+        messages.add(twist_topic, timestamp, twist);
 
         // Write the pose confidence as metadata for the pose frame
         std::string md_topic = ros_topic::frame_metadata_topic(stream_id);
@@ -286,27 +303,27 @@ namespace librealsense
         diagnostic_msgs::KeyValue tracker_confidence_msg;
         tracker_confidence_msg.key = TRACKER_CONFIDENCE_MD_STR;
         tracker_confidence_msg.value = std::to_string(pose->get_tracker_confidence());
-        write_message(md_topic, timestamp, tracker_confidence_msg);
+        messages.add(md_topic, timestamp, tracker_confidence_msg);
 
         diagnostic_msgs::KeyValue mapper_confidence_msg;
         mapper_confidence_msg.key = MAPPER_CONFIDENCE_MD_STR;
         mapper_confidence_msg.value = std::to_string(pose->get_mapper_confidence());
-        write_message(md_topic, timestamp, mapper_confidence_msg);
+        messages.add(md_topic, timestamp, mapper_confidence_msg);
 
         //Write frame's timestamp as metadata
         diagnostic_msgs::KeyValue frame_timestamp_msg;
         frame_timestamp_msg.key = FRAME_TIMESTAMP_MD_STR;
         frame_timestamp_msg.value = to_string() << std::hexfloat << std::fixed << pose->get_frame_timestamp();
-        write_message(md_topic, timestamp, frame_timestamp_msg);
+        messages.add(md_topic, timestamp, frame_timestamp_msg);
 
         //Write frame's number as external param
         diagnostic_msgs::KeyValue frame_num_msg;
         frame_num_msg.key = FRAME_NUMBER_MD_STR;
         frame_num_msg.value = to_string() << pose->get_frame_number();
-        write_message(md_topic, timestamp, frame_num_msg);
+        messages.add(md_topic, timestamp, frame_num_msg);
 
         // Write the rest of the frame metadata and stream extrinsics
-        write_additional_frame_messages(stream_id, timestamp, frame);
+        prepare_additional_frame_messages(stream_id, timestamp, frame, messages);
     }
 
     void ros_writer::write_stream_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<stream_profile_interface> profile)
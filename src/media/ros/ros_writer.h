@@ -15,22 +15,49 @@ namespace librealsense
         explicit ros_writer(const std::string& file, bool compress_while_record);
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
+        std::function<void()> prepare_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         const std::string& get_file_name() const override;
 
     private:
+        // The messages of a frame, built by prepare_frame without accessing the bag
+        class frame_messages
+        {
+        public:
+            template <typename T>
+            void add(std::string const& topic, nanoseconds const& time, T msg)
+            {
+                auto m = std::make_shared<T>(std::move(msg));
+                _writes.push_back([topic, time, m](ros_writer& writer) { writer.write_message(topic, time, *m); });
+            }
+
+            void add(std::function<void(ros_writer&)> write)
+            {
+                _writes.push_back(std::move(write));
+            }
+
+            void write(ros_writer& writer) const
+            {
+                for (auto&& write : _writes)
+                    write(writer);
+            }
+
+        private:
+            std::vector<std::function<void(ros_writer&)>> _writes;
+        };
+
         void write_file_version();
-        void write_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
-        void write_extrinsics(const stream_identifier& stream_id, frame_interface* frame);
+        void prepare_frame_metadata(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame, frame_messages& messages);
+        void prepare_extrinsics(const stream_identifier& stream_id, frame_interface* frame, frame_messages& messages);
         realsense_msgs::Notification to_notification_msg(const notification& n);
         void write_notification(const sensor_identifier& sensor_id, const nanoseconds& timestamp, const notification& n) override;
-        void write_additional_frame_messages(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame);
-        void write_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
-        void write_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
+        void prepare_additional_frame_messages(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_interface* frame, frame_messages& messages);
+        void prepare_video_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame, frame_messages& messages);
+        void prepare_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame, frame_messages& messages);
         inline geometry_msgs::Vector3 to_vector3(const float3& f);
         inline geometry_msgs::Quaternion to_quaternion(const float4& f);
-        void write_pose_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame);
+        void prepare_pose_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, const frame_holder& frame, frame_messages& messages);
         void write_stream_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<stream_profile_interface> profile);
         void write_streaming_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<video_stream_profile_interface> profile);
         void write_streaming_info(nanoseconds timestamp, const sensor_identifier& sensor_id, std::shared_ptr<motion_stream_profile_interface> profile);
@@ -74,6 +101,7 @@ namespace librealsense
 
         static uint8_t is_big_endian();
         std::map<stream_identifier, geometry_msgs::Transform> m_extrinsics_msgs;
+        std::mutex m_extrinsics_mutex;
         std::string m_file_path;
         rosbag::Bag m_bag;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
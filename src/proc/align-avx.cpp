@@ -0,0 +1,45 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "align-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        struct avx2_ops
+        {
+            typedef __m256 V;
+            static const size_t L = 8;
+
+            static V set1(float f) { return _mm256_set1_ps(f); }
+            static V load(const float* p) { return _mm256_loadu_ps(p); }
+            static V load(const uint16_t* p)
+            {
+                return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+            }
+            static void store_int(int* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvttps_epi32(v)); }
+
+            static V add(V a, V b) { return _mm256_add_ps(a, b); }
+            static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+            static V div(V a, V b) { return _mm256_div_ps(a, b); }
+        };
+
+        bool align_built() { return true; }
+
+        size_t align_project(const uint16_t* depth, const float* ray_x, const float* ray_y, size_t count,
+                             const align_projection& p, int* other_x, int* other_y)
+        {
+            return align_kernels<avx2_ops>::project(depth, ray_x, ray_y, count, p, other_x, other_y);
+        }
+#else
+        bool align_built() { return false; }
+        size_t align_project(const uint16_t*, const float*, const float*, size_t, const align_projection&, int*, int*) { return 0; }
+#endif
+    }
+}
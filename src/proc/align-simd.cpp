@@ -0,0 +1,73 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "align-simd.h"
+#include "simd-support.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ALIGN_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+#ifdef ALIGN_NEON
+    struct neon_ops
+    {
+        typedef float32x4_t V;
+        static const size_t L = 4;
+
+        static V set1(float f) { return vdupq_n_f32(f); }
+        static V load(const float* p) { return vld1q_f32(p); }
+        static V load(const uint16_t* p) { return vcvtq_f32_u32(vmovl_u16(vld1_u16(p))); }
+        // The conversion truncates, as the scalar cast does
+        static void store_int(int* p, V v) { vst1q_s32(p, vcvtq_s32_f32(v)); }
+
+        // Not vmlaq_f32, which may be fused and would round differently from the scalar code
+        static V add(V a, V b) { return vaddq_f32(a, b); }
+        static V mul(V a, V b) { return vmulq_f32(a, b); }
+        static V div(V a, V b)
+        {
+#if defined(__aarch64__)
+            return vdivq_f32(a, b);
+#else
+            // ARMv7 has no vector division; keep the exact quotient of the scalar code
+            float x[4], y[4];
+            vst1q_f32(x, a);
+            vst1q_f32(y, b);
+            for (int k = 0; k < 4; ++k)
+                x[k] /= y[k];
+            return vld1q_f32(x);
+#endif
+        }
+    };
+    typedef align_kernels<neon_ops> kernels;
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::align_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool align_simd_supported()
+    {
+#ifdef ALIGN_NEON
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t align_project_simd(const uint16_t* depth, const float* ray_x, const float* ray_y, size_t count,
+                              const align_projection& p, int* other_x, int* other_y)
+    {
+        if (use_avx2())
+            return avx2::align_project(depth, ray_x, ray_y, count, p, other_x, other_y);
+#ifdef ALIGN_NEON
+        return kernels::project(depth, ray_x, ray_y, count, p, other_x, other_y);
+#else
+        return 0;
+#endif
+    }
+}
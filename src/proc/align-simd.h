@@ -0,0 +1,120 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized projection of depth pixels onto another image, for the align processing block
+
+#pragma once
+
+#include "../include/librealsense2/h/rs_sensor.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    struct align_projection
+    {
+        rs2_intrinsics other;           // The image the depth pixels are projected onto
+        rs2_extrinsics depth_to_other;
+        float depth_scale;
+    };
+
+    // Whether a SIMD implementation is available for the running CPU
+    bool align_simd_supported();
+
+    // For the leading pixels of the given range, compute the pixel of the other image onto which the
+    // point at ray * depth_scale * depth lands, rounded as align does: static_cast<int>(p + 0.5f). The
+    // rays are points at a depth of 1, as rs2_deproject_pixel_to_point returns them, and the result is
+    // the same as deprojecting, transforming and projecting each point with rsutil.h.
+    // Return the number of pixels processed; the rest is left to the caller, and so are all of them
+    // when the distortion model of the other image is not vectorized (only the Brown-Conrady models are)
+    size_t align_project_simd(const uint16_t* depth, const float* ray_x, const float* ray_y, size_t count,
+                              const align_projection& p, int* other_x, int* other_y);
+
+    namespace avx2
+    {
+        // Implemented in align-avx.cpp. align_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool align_built();
+        size_t align_project(const uint16_t* depth, const float* ray_x, const float* ray_y, size_t count,
+                             const align_projection& p, int* other_x, int* other_y);
+    }
+
+    // rs2_transform_point_to_point and rs2_project_point_to_pixel, for vectors of L points. The
+    // operations are those of the scalar code, in the same order and without fused multiply-adds,
+    // so that the rounding of the results is the same.
+    //
+    // SIMD must provide float vectors V of L lanes, with:
+    //  - set1, load of L floats and of L uint16 values, and store_int of L ints truncated from V,
+    //  - add, mul, div
+    template<class SIMD>
+    struct align_kernels
+    {
+        typedef typename SIMD::V V;
+
+        static size_t project(const uint16_t* depth, const float* ray_x, const float* ray_y, size_t count,
+                              const align_projection& p, int* other_x, int* other_y)
+        {
+            switch (p.other.model)
+            {
+            case RS2_DISTORTION_NONE: return project<RS2_DISTORTION_NONE>(depth, ray_x, ray_y, count, p, other_x, other_y);
+            // rs2_project_point_to_pixel applies the same (forward) distortion for both
+            case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+            case RS2_DISTORTION_INVERSE_BROWN_CONRADY: return project<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(depth, ray_x, ray_y, count, p, other_x, other_y);
+            case RS2_DISTORTION_BROWN_CONRADY: return project<RS2_DISTORTION_BROWN_CONRADY>(depth, ray_x, ray_y, count, p, other_x, other_y);
+            default: return 0;
+            }
+        }
+
+        template<rs2_distortion MODEL>
+        static size_t project(const uint16_t* depth, const float* ray_x, const float* ray_y, size_t count,
+                              const align_projection& p, int* other_x, int* other_y)
+        {
+            const float* r = p.depth_to_other.rotation;
+            const float* t = p.depth_to_other.translation;
+            const float* c = p.other.coeffs;
+            const V r0 = SIMD::set1(r[0]), r1 = SIMD::set1(r[1]), r2 = SIMD::set1(r[2]);
+            const V r3 = SIMD::set1(r[3]), r4 = SIMD::set1(r[4]), r5 = SIMD::set1(r[5]);
+            const V r6 = SIMD::set1(r[6]), r7 = SIMD::set1(r[7]), r8 = SIMD::set1(r[8]);
+            const V t0 = SIMD::set1(t[0]), t1 = SIMD::set1(t[1]), t2 = SIMD::set1(t[2]);
+            const V k0 = SIMD::set1(c[0]), k1 = SIMD::set1(c[1]), k4 = SIMD::set1(c[4]);
+            const V two_p0 = SIMD::set1(2 * c[2]), two_p1 = SIMD::set1(2 * c[3]);
+            const V p0 = SIMD::set1(c[2]), p1 = SIMD::set1(c[3]);
+            const V one = SIMD::set1(1.f), two = SIMD::set1(2.f), half = SIMD::set1(0.5f);
+            const V fx = SIMD::set1(p.other.fx), fy = SIMD::set1(p.other.fy);
+            const V ppx = SIMD::set1(p.other.ppx), ppy = SIMD::set1(p.other.ppy);
+            const V scale = SIMD::set1(p.depth_scale);
+
+            size_t i = 0;
+            for (; i + SIMD::L <= count; i += SIMD::L)
+            {
+                const V z = SIMD::mul(scale, SIMD::load(depth + i));
+                const V px = SIMD::mul(z, SIMD::load(ray_x + i));
+                const V py = SIMD::mul(z, SIMD::load(ray_y + i));
+
+                const V qx = SIMD::add(SIMD::add(SIMD::add(SIMD::mul(r0, px), SIMD::mul(r3, py)), SIMD::mul(r6, z)), t0);
+                const V qy = SIMD::add(SIMD::add(SIMD::add(SIMD::mul(r1, px), SIMD::mul(r4, py)), SIMD::mul(r7, z)), t1);
+                const V qz = SIMD::add(SIMD::add(SIMD::add(SIMD::mul(r2, px), SIMD::mul(r5, py)), SIMD::mul(r8, z)), t2);
+
+                V x = SIMD::div(qx, qz), y = SIMD::div(qy, qz);
+                if (MODEL != RS2_DISTORTION_NONE)
+                {
+                    const V rr = SIMD::add(SIMD::mul(x, x), SIMD::mul(y, y));
+                    const V f = SIMD::add(SIMD::add(SIMD::add(one, SIMD::mul(k0, rr)), SIMD::mul(SIMD::mul(k1, rr), rr)),
+                                          SIMD::mul(SIMD::mul(SIMD::mul(k4, rr), rr), rr));
+                    // Brown-Conrady computes the tangential terms from the undistorted point
+                    const V xf = SIMD::mul(x, f), yf = SIMD::mul(y, f);
+                    const V tx = MODEL == RS2_DISTORTION_BROWN_CONRADY ? x : xf;
+                    const V ty = MODEL == RS2_DISTORTION_BROWN_CONRADY ? y : yf;
+                    x = SIMD::add(SIMD::add(xf, SIMD::mul(SIMD::mul(two_p0, tx), ty)),
+                                  SIMD::mul(p1, SIMD::add(rr, SIMD::mul(SIMD::mul(two, tx), tx))));
+                    y = SIMD::add(SIMD::add(yf, SIMD::mul(SIMD::mul(two_p1, tx), ty)),
+                                  SIMD::mul(p0, SIMD::add(rr, SIMD::mul(SIMD::mul(two, ty), ty))));
+                }
+
+                SIMD::store_int(other_x + i, SIMD::add(SIMD::add(SIMD::mul(x, fx), ppx), half));
+                SIMD::store_int(other_y + i, SIMD::add(SIMD::add(SIMD::mul(y, fy), ppy), half));
+            }
+            return i;
+        }
+    };
+}
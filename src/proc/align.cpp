@@ -9,61 +9,111 @@
 #include "proc/synthetic-stream.h"
 #include "environment.h"
 #include "align.h"
+#include "align-simd.h"
 #include "stream.h"
 
 namespace librealsense
 {
     template<int N> struct bytes { byte b[N]; };
 
-    template<class GET_DEPTH, class TRANSFER_PIXEL>
-    void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
-        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
+    static bool same_intrinsics(const rs2_intrinsics& a, const rs2_intrinsics& b)
     {
-        // Iterate over the pixels of the depth image
-#pragma omp parallel for schedule(dynamic)
-        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        return a.width == b.width && a.height == b.height && a.ppx == b.ppx && a.ppy == b.ppy &&
+            a.fx == b.fx && a.fy == b.fy && a.model == b.model && std::equal(a.coeffs, a.coeffs + 5, b.coeffs);
+    }
+
+    align::align(rs2_stream to_stream) : align(to_stream, "Align")
+    {
+#ifdef _OPENMP
+        // OpenMP builds have always aligned on all the cores
+        register_processing_threads_option(processing_thread_pool::max_threads());
+#else
+        register_processing_threads_option();
+#endif
+    }
+
+    // Map the corners of each depth pixel onto the other image, and keep the rectangles that fall
+    // inside it. Pixels with the value of zero are skipped: we have no depth data, so we will not
+    // write anything into our aligned images
+    void align::project_depth(const uint16_t* z_pixels, float z_scale, const rs2_intrinsics& depth_intrin,
+        const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin)
+    {
+        auto& c = _projection;
+        const int width = depth_intrin.width, height = depth_intrin.height;
+        const size_t corners = size_t(width + 1) * (height + 1);
+        if (c.ray_x.size() != corners || !same_intrinsics(c.depth_intrin, depth_intrin))
         {
-            int depth_pixel_index = depth_y * depth_intrin.width;
-            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+            c.depth_intrin = depth_intrin;
+            c.ray_x.resize(corners);
+            c.ray_y.resize(corners);
+            for (int y = 0, i = 0; y <= height; ++y)
             {
-                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-                if (float depth = get_depth(depth_pixel_index))
+                for (int x = 0; x <= width; ++x, ++i)
                 {
-                    // Map the top-left corner of the depth pixel onto the other image
-                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    // Map the bottom-right corner of the depth pixel onto the other image
-                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
-                        continue;
+                    float pixel[2] = { x - 0.5f, y - 0.5f }, point[3];
+                    rs2_deproject_pixel_to_point(point, &depth_intrin, pixel, 1.f);
+                    c.ray_x[i] = point[0];
+                    c.ray_y[i] = point[1];
+                }
+            }
+            for (int k = 0; k < 2; ++k)
+            {
+                c.other_x[k].resize(size_t(width) * height);
+                c.other_y[k].resize(size_t(width) * height);
+            }
+            c.first_row.resize(height);
+            c.last_row.resize(height);
+        }
 
-                    // Transfer between the depth pixels and the pixels inside the rectangle on the other image
-                    for (int y = other_y0; y <= other_y1; ++y)
+        align_projection params;
+        params.other = other_intrin;
+        params.depth_to_other = depth_to_other;
+        params.depth_scale = z_scale;
+
+        parallel_for(height, 1, [&](size_t first, size_t last)
+        {
+            for (size_t y = first; y < last; ++y)
+            {
+                const size_t row = y * width;
+                int first_row = other_intrin.height, last_row = -1;
+
+                // The top-left corners of the row are the corners of row y, and the bottom-right ones those of row y + 1
+                for (int k = 0; k < 2; ++k)
+                {
+                    const size_t corner = (y + k) * (width + 1) + k;
+                    size_t x = align_project_simd(z_pixels + row, &c.ray_x[corner], &c.ray_y[corner], width, params,
+                                                  &c.other_x[k][row], &c.other_y[k][row]);
+                    for (; x < size_t(width); ++x)
                     {
-                        for (int x = other_x0; x <= other_x1; ++x)
+                        if (const float depth = z_scale * z_pixels[row + x])
                         {
-                            transfer_pixel(depth_pixel_index, y * other_intrin.width + x);
+                            float depth_point[3] = { depth * c.ray_x[corner + x], depth * c.ray_y[corner + x], depth };
+                            float other_point[3], other_pixel[2];
+                            rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
+                            rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                            c.other_x[k][row + x] = static_cast<int>(other_pixel[0] + 0.5f);
+                            c.other_y[k][row + x] = static_cast<int>(other_pixel[1] + 0.5f);
                         }
                     }
                 }
+
+                for (size_t i = row; i < row + width; ++i)
+                {
+                    if (!(z_scale * z_pixels[i]) || c.other_x[0][i] < 0 || c.other_y[0][i] < 0 ||
+                        c.other_x[1][i] >= other_intrin.width || c.other_y[1][i] >= other_intrin.height)
+                    {
+                        c.other_x[0][i] = -1;
+                        continue;
+                    }
+                    first_row = std::min(first_row, c.other_y[0][i]);
+                    last_row = std::max(last_row, c.other_y[1][i]);
+                }
+                c.first_row[y] = first_row;
+                c.last_row[y] = last_row;
             }
-        }
+        });
     }
 
-    align::align(rs2_stream to_stream) : align(to_stream, "Align")
-    {}
-
     void align::align_z_to_other(rs2::video_frame& aligned, 
         const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale)
     {
@@ -80,48 +130,60 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto out_z = (uint16_t *)(aligned_data);
 
-        align_images(z_intrin, z_to_other, other_intrin,
-            [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
+        project_depth(z_pixels, z_scale, z_intrin, z_to_other, other_intrin);
+
+        // Several depth pixels may cover the same pixel of the other image, which keeps the closest
+        // one. Each thread owns a band of rows of the aligned image, and clips the rectangles to it
+        const auto& c = _projection;
+        parallel_for(other_intrin.height, 1, [&](size_t first, size_t last)
         {
-            out_z[other_pixel_index] = out_z[other_pixel_index] ?
-                std::min((int)out_z[other_pixel_index], (int)z_pixels[z_pixel_index]) :
-                z_pixels[z_pixel_index];
+            const int band_first = int(first), band_last = int(last) - 1;
+            for (int depth_y = 0; depth_y < z_intrin.height; ++depth_y)
+            {
+                if (c.last_row[depth_y] < band_first || c.first_row[depth_y] > band_last)
+                    continue;
+
+                const int row = depth_y * z_intrin.width;
+                for (int depth_pixel_index = row; depth_pixel_index < row + z_intrin.width; ++depth_pixel_index)
+                {
+                    if (c.other_x[0][depth_pixel_index] < 0)
+                        continue;
+
+                    const uint16_t z = z_pixels[depth_pixel_index];
+                    const int y0 = std::max(c.other_y[0][depth_pixel_index], band_first);
+                    const int y1 = std::min(c.other_y[1][depth_pixel_index], band_last);
+                    for (int y = y0; y <= y1; ++y)
+                    {
+                        for (int x = c.other_x[0][depth_pixel_index]; x <= c.other_x[1][depth_pixel_index]; ++x)
+                        {
+                            auto& out = out_z[y * other_intrin.width + x];
+                            out = out ? std::min(out, z) : z;
+                        }
+                    }
+                }
+            }
         });
     }
 
-    template<int N, class GET_DEPTH>
-    void align_other_to_depth_bytes(byte* other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels)
+    // Each depth pixel takes the last pixel of its rectangle on the other image
+    template<int N>
+    void align::transfer_other_to_depth(byte* aligned_data, const byte* other_pixels, const rs2_intrinsics& depth_intrin, const rs2_intrinsics& other_intrin)
     {
         auto in_other = (const bytes<N> *)(other_pixels);
-        auto out_other = (bytes<N> *)(other_aligned_to_depth);
-        align_images(depth_intrin, depth_to_other, other_intrin, get_depth,
-            [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
-    }
-
-    template<class GET_DEPTH>
-    void align_other_to_depth(byte* other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const byte* other_pixels, rs2_format other_format)
-    {
-        switch (other_format)
+        auto out_other = (bytes<N> *)(aligned_data);
+        const auto& c = _projection;
+        parallel_for(depth_intrin.height, 1, [&](size_t first, size_t last)
         {
-        case RS2_FORMAT_Y8:
-            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        case RS2_FORMAT_Y16:
-        case RS2_FORMAT_Z16:
-            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        case RS2_FORMAT_RGB8:
-        case RS2_FORMAT_BGR8:
-            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        case RS2_FORMAT_RGBA8:
-        case RS2_FORMAT_BGRA8:
-            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
-            break;
-        default:
-            assert(false); // NOTE: rs2_align_other_to_depth_bytes<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
-        }
+            for (size_t depth_pixel_index = first * depth_intrin.width; depth_pixel_index < last * depth_intrin.width; ++depth_pixel_index)
+            {
+                if (c.other_x[0][depth_pixel_index] < 0)
+                    continue;
+
+                for (int y = c.other_y[0][depth_pixel_index]; y <= c.other_y[1][depth_pixel_index]; ++y)
+                    for (int x = c.other_x[0][depth_pixel_index]; x <= c.other_x[1][depth_pixel_index]; ++x)
+                        out_other[depth_pixel_index] = in_other[y * other_intrin.width + x];
+            }
+        });
     }
 
     void align::align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale)
@@ -140,8 +202,28 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto other_pixels = reinterpret_cast<const byte*>(other.get_data());
 
-        align_other_to_depth(aligned_data, [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format());
+        project_depth(z_pixels, z_scale, z_intrin, z_to_other, other_intrin);
+
+        switch (other_profile.format())
+        {
+        case RS2_FORMAT_Y8:
+            transfer_other_to_depth<1>(aligned_data, other_pixels, z_intrin, other_intrin);
+            break;
+        case RS2_FORMAT_Y16:
+        case RS2_FORMAT_Z16:
+            transfer_other_to_depth<2>(aligned_data, other_pixels, z_intrin, other_intrin);
+            break;
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+            transfer_other_to_depth<3>(aligned_data, other_pixels, z_intrin, other_intrin);
+            break;
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_BGRA8:
+            transfer_other_to_depth<4>(aligned_data, other_pixels, z_intrin, other_intrin);
+            break;
+        default:
+            assert(false); // NOTE: transfer_other_to_depth<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
+        }
     }
 
     std::shared_ptr<rs2::video_stream_profile> align::create_aligned_profile(
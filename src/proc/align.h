@@ -5,6 +5,7 @@
 
 #include <map>
 #include <utility>
+#include <vector>
 #include "core/processing.h"
 #include "proc/synthetic-stream.h"
 #include "image.h"
@@ -52,5 +53,21 @@ namespace librealsense
     private:
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
         void align_frames(rs2::video_frame& aligned, const rs2::video_frame& from, const rs2::video_frame& to);
+
+        void project_depth(const uint16_t* z_pixels, float z_scale, const rs2_intrinsics& depth_intrin,
+                           const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin);
+        template<int N>
+        void transfer_other_to_depth(byte* aligned_data, const byte* other_pixels, const rs2_intrinsics& depth_intrin, const rs2_intrinsics& other_intrin);
+
+        // The rays through the corners of the depth pixels, computed once per depth intrinsics, and the
+        // rectangles of the other image covered by each depth pixel of the current frame
+        struct projection_cache
+        {
+            rs2_intrinsics depth_intrin{};
+            std::vector<float> ray_x, ray_y;        // (width + 1) x (height + 1) corners, at a depth of 1
+            std::vector<int> other_x[2], other_y[2];// Top-left and bottom-right corners; other_x[0] is -1 to skip the pixel
+            std::vector<int> first_row, last_row;   // The rows of the other image covered by each depth row
+        };
+        projection_cache _projection;
     };
 }
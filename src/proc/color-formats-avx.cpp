@@ -0,0 +1,170 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "color-formats-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        // The offsets of the components in a 4-byte macropixel (two pixels sharing U and V)
+        template<bool UYVY>
+        struct macropixel
+        {
+            static const int y0 = UYVY ? 1 : 0, u = UYVY ? 0 : 1, y1 = UYVY ? 3 : 2, v = UYVY ? 2 : 3;
+        };
+
+        // A shuffle of the 8 pixels of each 128-bit lane, where 'bytes' gives the destination bytes of each
+        // pixel (which take the component at the even and odd offset of the pixel, or zero for -1)
+        static __m256i pixel_shuffle(int bytes, int even_offset, int odd_offset, int component_byte)
+        {
+            int8_t m[32];
+            for (int lane = 0; lane < 2; ++lane)
+            {
+                for (int i = 0; i < 16; ++i)
+                    m[lane * 16 + i] = -1;
+                for (int p = 0; p < 16 / bytes; ++p)
+                    m[lane * 16 + p * bytes + component_byte] = int8_t(4 * (p / 2) + (p % 2 ? odd_offset : even_offset));
+            }
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m));
+        }
+
+        static __m256i weights(int16_t a, int16_t b)
+        {
+            return _mm256_set1_epi32(int(uint32_t(uint16_t(a)) | (uint32_t(uint16_t(b)) << 16)));
+        }
+
+        // a * weight_a + b * weight_b for int16 pixels, as int32: pixels 0-3 and 8-11 in lo, 4-7 and 12-15 in hi
+        struct sums
+        {
+            __m256i lo, hi;
+
+            sums(__m256i a, __m256i b, __m256i w)
+                : lo(_mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w)),
+                  hi(_mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w)) {}
+
+            sums& operator+=(const sums& s)
+            {
+                lo = _mm256_add_epi32(lo, s.lo);
+                hi = _mm256_add_epi32(hi, s.hi);
+                return *this;
+            }
+
+            // >> 8, back to int16 pixels in order. Clamping happens when packing to bytes
+            __m256i shift() const
+            {
+                return _mm256_packs_epi32(_mm256_srai_epi32(lo, 8), _mm256_srai_epi32(hi, 8));
+            }
+        };
+
+        template<bool UYVY, rs2_format FORMAT>
+        static size_t unpack(uint8_t* dst, const uint8_t* src, size_t count)
+        {
+            typedef macropixel<UYVY> mp;
+            const __m256i y8 = pixel_shuffle(1, mp::y0, mp::y1, 0);
+            const __m256i y16 = pixel_shuffle(2, mp::y0, mp::y1, 1);
+            const __m256i y = pixel_shuffle(2, mp::y0, mp::y1, 0);
+            const __m256i u = pixel_shuffle(2, mp::u, mp::u, 0);
+            const __m256i v = pixel_shuffle(2, mp::v, mp::v, 0);
+            const __m256i one = _mm256_set1_epi16(1);
+            const __m256i round = _mm256_set1_epi16(128);   // with 'one', adds 128 to sums
+            const __m256i w_r = weights(298, 409), w_gd = weights(298, -100), w_ge = weights(-208, 128), w_b = weights(298, 516);
+            const __m256i pair_bytes = _mm256_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15,
+                                                        0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+            const __m256i alpha = _mm256_set1_epi16(255);
+
+            size_t i = 0;
+            for (; i + UNPACK_YUV_BLOCK <= count; i += UNPACK_YUV_BLOCK)
+            {
+                // 16 pixels, 8 in each 128-bit lane
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 2 * i));
+
+                if (FORMAT == RS2_FORMAT_Y8)
+                {
+                    const __m256i out = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(s, y8), _MM_SHUFFLE(3, 1, 2, 0));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(out));
+                    continue;
+                }
+                if (FORMAT == RS2_FORMAT_Y16)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * i), _mm256_shuffle_epi8(s, y16));
+                    continue;
+                }
+
+                const __m256i c = _mm256_sub_epi16(_mm256_shuffle_epi8(s, y), _mm256_set1_epi16(16));
+                const __m256i d = _mm256_sub_epi16(_mm256_shuffle_epi8(s, u), _mm256_set1_epi16(128));
+                const __m256i e = _mm256_sub_epi16(_mm256_shuffle_epi8(s, v), _mm256_set1_epi16(128));
+
+                sums r(c, e, w_r), g(c, d, w_gd), b(c, d, w_b);
+                r += sums(one, round, weights(0, 1));
+                g += sums(e, one, w_ge);
+                b += sums(one, round, weights(0, 1));
+
+                const bool rgb = FORMAT == RS2_FORMAT_RGB8 || FORMAT == RS2_FORMAT_RGBA8;
+                const __m256i first = rgb ? r.shift() : b.shift();
+                const __m256i third = rgb ? b.shift() : r.shift();
+
+                // Bytes of each lane: first and g, then third and alpha, of the pixels in order; then whole pixels
+                const __m256i fg = _mm256_shuffle_epi8(_mm256_packus_epi16(first, g.shift()), pair_bytes);
+                const __m256i ta = _mm256_shuffle_epi8(_mm256_packus_epi16(third, alpha), pair_bytes);
+                const __m256i q0 = _mm256_unpacklo_epi16(fg, ta);    // Pixels 0-3 and 8-11
+                const __m256i q1 = _mm256_unpackhi_epi16(fg, ta);    // Pixels 4-7 and 12-15
+
+                if (FORMAT == RS2_FORMAT_RGBA8 || FORMAT == RS2_FORMAT_BGRA8)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4 * i), _mm256_permute2x128_si256(q0, q1, 0x20));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4 * i + 32), _mm256_permute2x128_si256(q0, q1, 0x31));
+                }
+                else
+                {
+                    // Shuffle the triples to the start and end of each register, and align them as the SSSE3 code does
+                    const __m128i p0 = _mm_shuffle_epi8(_mm256_castsi256_si128(q0), _mm_setr_epi8(3, 7, 11, 15, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14));
+                    const __m128i p1 = _mm_shuffle_epi8(_mm256_castsi256_si128(q1), _mm_setr_epi8(0, 1, 2, 4, 3, 7, 11, 15, 5, 6, 8, 9, 10, 12, 13, 14));
+                    const __m128i p2 = _mm_shuffle_epi8(_mm256_extracti128_si256(q0, 1), _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 3, 7, 11, 15, 10, 12, 13, 14));
+                    const __m128i p3 = _mm_shuffle_epi8(_mm256_extracti128_si256(q1, 1), _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 3, 7, 11, 15));
+                    auto out = reinterpret_cast<__m128i*>(dst + 3 * i);
+                    _mm_storeu_si128(out, _mm_alignr_epi8(p1, p0, 4));
+                    _mm_storeu_si128(out + 1, _mm_alignr_epi8(p2, p1, 8));
+                    _mm_storeu_si128(out + 2, _mm_alignr_epi8(p3, p2, 12));
+                }
+            }
+            return i;
+        }
+
+        template<bool UYVY>
+        static size_t unpack(rs2_format dst_format, uint8_t* dst, const uint8_t* src, size_t count)
+        {
+            switch (dst_format)
+            {
+            case RS2_FORMAT_Y8: return unpack<UYVY, RS2_FORMAT_Y8>(dst, src, count);
+            case RS2_FORMAT_Y16: return unpack<UYVY, RS2_FORMAT_Y16>(dst, src, count);
+            case RS2_FORMAT_RGB8: return unpack<UYVY, RS2_FORMAT_RGB8>(dst, src, count);
+            case RS2_FORMAT_BGR8: return unpack<UYVY, RS2_FORMAT_BGR8>(dst, src, count);
+            case RS2_FORMAT_RGBA8: return unpack<UYVY, RS2_FORMAT_RGBA8>(dst, src, count);
+            case RS2_FORMAT_BGRA8: return unpack<UYVY, RS2_FORMAT_BGRA8>(dst, src, count);
+            default: return 0;
+            }
+        }
+
+        bool unpack_yuv_built() { return true; }
+
+        size_t unpack_yuv(rs2_format src_format, rs2_format dst_format, uint8_t* dst, const uint8_t* src, size_t count)
+        {
+            switch (src_format)
+            {
+            case RS2_FORMAT_YUYV: return unpack<false>(dst_format, dst, src, count);
+            case RS2_FORMAT_UYVY: return unpack<true>(dst_format, dst, src, count);
+            default: return 0;
+            }
+        }
+#else
+        bool unpack_yuv_built() { return false; }
+        size_t unpack_yuv(rs2_format, rs2_format, uint8_t*, const uint8_t*, size_t) { return 0; }
+#endif
+    }
+}
@@ -2,15 +2,13 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 
 #include "color-formats-converter.h"
+#include "color-formats-simd.h"
+#include "simd-support.h"
 
 #include "option.h"
 #include "image-avx.h"
 #include "image.h"
 
-#define STB_IMAGE_STATIC
-#define STB_IMAGE_IMPLEMENTATION
-#include "../third-party/stb_image.h"
-
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
 #endif
@@ -18,32 +16,6 @@
 #include <tmmintrin.h> // For SSSE3 intrinsics
 #endif
 
-#if defined (ANDROID) || (defined (__linux__) && !defined (__x86_64__))
-
-bool has_avx() { return false; }
-
-#else
-
-#ifdef _WIN32
-#include <intrin.h>
-#define cpuid(info, x)    __cpuidex(info, x, 0)
-#else
-#include <cpuid.h>
-void cpuid(int info[4], int info_type) {
-    __cpuid_count(info_type, 0, info[0], info[1], info[2], info[3]);
-}
-#endif
-
-bool has_avx()
-{
-    int info[4];
-    cpuid(info, 0);
-    cpuid(info, 0x80000000);
-    return (info[2] & ((int)1 << 28)) != 0;
-}
-
-#endif
-
 namespace librealsense 
 {
     /////////////////////////////
@@ -59,8 +31,11 @@ namespace librealsense
         rscuda::unpack_yuy2_cuda<FORMAT>(d, s, n);
         return;
 #endif
+        // The AVX2 and NEON kernels cover all the formats, and n is a multiple of their block
+        if (unpack_yuv_simd_supported() && unpack_yuv_simd(RS2_FORMAT_YUYV, FORMAT, d[0], s, n) == size_t(n))
+            return;
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
+        static bool do_avx = avx2_supported();
 #ifdef __AVX2__
 
         if (do_avx)
@@ -392,6 +367,8 @@ namespace librealsense
     {
         auto n = width * height;
         assert(n % 16 == 0); // All currently supported color resolutions are multiples of 16 pixels. Could easily extend support to other resolutions by copying final n<16 pixels into a zero-padded buffer and recursively calling self for final iteration.
+        if (unpack_yuv_simd_supported() && unpack_yuv_simd(RS2_FORMAT_UYVY, FORMAT, d[0], s, n) == size_t(n))
+            return;
 #ifdef __SSSE3__
         auto src = reinterpret_cast<const __m128i *>(s);
         auto dst = reinterpret_cast<__m128i *>(d[0]);
@@ -652,17 +629,10 @@ namespace librealsense
     /////////////////////////////
     // MJPEG unpacking routines //
     /////////////////////////////
-    void unpack_mjpeg(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
+    void unpack_mjpeg(mjpeg_decoder& decoder, byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
     {
-        int w, h, bpp;
-        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, false);
-        if (uncompressed_rgb)
-        {
-            auto uncompressed_size = w * h * bpp;
-            librealsense::copy(dest[0], uncompressed_rgb, uncompressed_size);
-            stbi_image_free(uncompressed_rgb);
-        }
-        else
+        // input_size is the size of the compressed data when the frame reports it, and actual_size that of dest
+        if (!decoder.decode(source, input_size ? input_size : actual_size, dest[0], actual_size))
             LOG_ERROR("jpeg decode failed");
     }
 
@@ -692,9 +662,170 @@ namespace librealsense
         unpack_uyvyc(_target_format, _target_stream, dest, source, width, height, actual_size);
     }
 
+    mjpeg_converter::mjpeg_converter(const char* name, rs2_format target_format) :
+        color_converter(name, target_format)
+    {
+        auto threads = std::make_shared<ptr_option<int>>(1, processing_thread_pool::max_threads(), 1, 1,
+            &_decode_threads_option, "Number of threads decoding frames concurrently, 1 decodes them on the calling thread");
+        threads->on_set([this](float val)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            while (_workers.size() < size_t(val) && val > 1)
+                _workers.emplace_back(new decode_worker());
+            _decode_threads = static_cast<int>(val);
+        });
+        register_option(RS2_OPTION_PROCESSING_THREADS, threads);
+
+        auto on_frame = [this](rs2::frame f, const rs2::frame_source& source)
+        {
+            this->on_frame(std::move(f), source);
+        };
+        processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(
+            new rs2::frame_processor_callback<decltype(on_frame)>(on_frame)));
+    }
+
+    mjpeg_converter::~mjpeg_converter()
+    {
+        // Wait for the frames being decoded, and drop the queued ones
+        _workers.clear();
+    }
+
+    void mjpeg_converter::on_frame(rs2::frame f, const rs2::frame_source& source)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+
+        // Framesets are decoded on the calling thread, and frames that are not decoded are passed on,
+        // in order with the others
+        auto frames = f.as<rs2::frameset>();
+        bool to_decode = !frames && should_process(f);
+        size_t threads = to_decode ? std::min(size_t(_decode_threads.load()), _workers.size()) : 0;
+        uint64_t sequence;
+        {
+            std::lock_guard<std::mutex> lock(_delivery_mutex);
+            // Up to two frames per thread, so that a decoder picks the next one as soon as it is done
+            if (threads > 1 && _in_flight >= 2 * threads)
+            {
+                LOG_DEBUG("MJPEG decoding is behind, frame " << f.get_frame_number() << " dropped");
+                return;
+            }
+            sequence = _next_sequence++;
+            ++_in_flight;
+        }
+
+        rs2::frame result;
+        try
+        {
+            if (frames)
+            {
+                result = decode_frameset(source, frames);
+            }
+            else if (!to_decode)
+            {
+                result = f;
+            }
+            else
+            {
+                result = prepare_frame(source, f);
+                if (threads > 1)
+                {
+                    auto worker = _workers[sequence % threads].get();
+                    worker->thread.invoke([this, worker, sequence, f, result](dispatcher::cancellable_timer) mutable
+                    {
+                        decode(f, result, worker->decoder);
+                        deliver(sequence, result);
+                    });
+                    return;
+                }
+                decode(f, result, _decoder);
+            }
+        }
+        catch (...)
+        {
+            // Give up the turn of the frame, or the frames after it would never be delivered
+            lock.unlock();
+            deliver(sequence, rs2::frame());
+            throw;
+        }
+
+        lock.unlock();
+        deliver(sequence, result);
+    }
+
+    rs2::frame mjpeg_converter::decode_frameset(const rs2::frame_source& source, const rs2::frameset& frames)
+    {
+        // The frames of the set that are processed replace theirs, as generic_processing_block does
+        std::vector<rs2::frame> results;
+        for (auto&& f : frames)
+        {
+            if (!f || !should_process(f))
+                continue;
+            auto result = prepare_frame(source, f);
+            decode(f, result, _decoder);
+            results.push_back(result);
+        }
+        return prepare_output(source, frames, results);
+    }
+
+    void mjpeg_converter::decode(const rs2::frame& f, rs2::frame& result, mjpeg_decoder& decoder)
+    {
+        // Does not throw: the frame is delivered whether or not it decodes, or the frames after it would wait forever
+        try
+        {
+            auto vf = result.as<rs2::video_frame>();
+            int width = vf.get_width();
+            int height = vf.get_height();
+            int raw_size = 0;
+            if (f.supports_frame_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE))
+                raw_size = static_cast<int>(f.get_frame_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE));
+            if (!raw_size)
+                raw_size = static_cast<int>(f.get_data_size());
+            byte* planes[1] = { (byte*)result.get_data() };
+            unpack_mjpeg(decoder, planes, static_cast<const byte*>(f.get_data()), width, height, height * width * _target_bpp, raw_size);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("MJPEG decoding failed: " << e.what());
+        }
+    }
+
+    void mjpeg_converter::deliver(uint64_t sequence, rs2::frame result)
+    {
+        std::unique_lock<std::mutex> lock(_delivery_mutex);
+        _decoded[sequence] = std::move(result);
+
+        // A single thread hands frames on at a time, without holding the lock, so that the frames completed
+        // meanwhile on other threads are queued and delivered after them, by that thread
+        if (_delivering)
+            return;
+        _delivering = true;
+        for (auto it = _decoded.find(_next_delivery); it != _decoded.end(); it = _decoded.find(_next_delivery))
+        {
+            auto next = std::move(it->second);
+            _decoded.erase(it);
+            ++_next_delivery;
+            --_in_flight;
+
+            lock.unlock();
+            if (auto ptr = (frame_interface*)next.get())
+            {
+                ptr->acquire();
+                try
+                {
+                    _source_wrapper.frame_ready(frame_holder(ptr));
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Exception was thrown while delivering a decoded frame: " << e.what());
+                }
+            }
+            lock.lock();
+        }
+        _delivering = false;
+    }
+
     void mjpeg_converter::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+        unpack_mjpeg(_decoder, dest, source, width, height, actual_size, input_size);
     }
 
     void bgr_to_rgb::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
@@ -4,6 +4,11 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "mjpeg-decoder.h"
+#include "concurrency.h"
+
+#include <limits>
+#include <map>
 
 namespace librealsense
 {
@@ -38,16 +43,45 @@ namespace librealsense
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
     };
 
+    // Decodes on the calling thread by default. With RS2_OPTION_PROCESSING_THREADS above 1, frames
+    // are decoded concurrently by that many threads, and delivered in the order they arrived
     class LRS_EXTENSION_API mjpeg_converter : public color_converter
     {
     public:
         mjpeg_converter(rs2_format target_format) :
             mjpeg_converter("MJPEG Converter", target_format) {};
+        ~mjpeg_converter();
 
     protected:
-        mjpeg_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+        mjpeg_converter(const char* name, rs2_format target_format);
         void process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size) override;
+
+    private:
+        struct decode_worker
+        {
+            mjpeg_decoder decoder;
+            dispatcher thread;      // Stopped before the decoder is destroyed
+
+            decode_worker() : thread(std::numeric_limits<unsigned int>::max()) { thread.start(); }
+        };
+
+        void on_frame(rs2::frame f, const rs2::frame_source& source);
+        void decode(const rs2::frame& f, rs2::frame& result, mjpeg_decoder& decoder);
+        rs2::frame decode_frameset(const rs2::frame_source& source, const rs2::frameset& frames);
+        // Delivers the frames that are next in arrival order, from whichever thread completes them
+        void deliver(uint64_t sequence, rs2::frame result);
+
+        mjpeg_decoder _decoder;     // Of the calling thread
+        int _decode_threads_option = 1;         // set and queried through the option
+        std::atomic<int> _decode_threads{ 1 };  // read on the frame thread
+        std::vector<std::unique_ptr<decode_worker>> _workers;   // Added as the option grows, and kept
+
+        std::mutex _delivery_mutex;
+        std::map<uint64_t, rs2::frame> _decoded;     // Completed ahead of their turn
+        uint64_t _next_sequence = 0;
+        uint64_t _next_delivery = 0;
+        size_t _in_flight = 0;
+        bool _delivering = false;   // A thread is handing frames on, and delivers those completed meanwhile
     };
 
     class LRS_EXTENSION_API bgr_to_rgb : public color_converter
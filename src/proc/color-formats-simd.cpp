@@ -0,0 +1,147 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "color-formats-simd.h"
+#include "simd-support.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define UNPACK_YUV_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+#ifdef UNPACK_YUV_NEON
+    namespace neon
+    {
+        // clamp((298 * c + chroma) >> 8) for 8 pixels, where chroma holds the terms shared by a pair of pixels
+        static uint8x8_t channel(int16x8_t c, int32x4_t chroma_low, int32x4_t chroma_high)
+        {
+            const int32x4_t low = vshrq_n_s32(vmlal_n_s16(chroma_low, vget_low_s16(c), 298), 8);
+            const int32x4_t high = vshrq_n_s32(vmlal_n_s16(chroma_high, vget_high_s16(c), 298), 8);
+            return vqmovun_s16(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+        }
+
+        static int16x8_t widen(uint8x8_t v, int16_t offset)
+        {
+            return vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v)), vdupq_n_s16(offset));
+        }
+
+        // The channel of the even and odd pixels, interleaved back into pixel order
+        static uint8x16_t interleave(uint8x8_t even, uint8x8_t odd)
+        {
+            const uint8x8x2_t zipped = vzip_u8(even, odd);
+            return vcombine_u8(zipped.val[0], zipped.val[1]);
+        }
+
+        template<bool UYVY, rs2_format FORMAT>
+        static size_t unpack(uint8_t* dst, const uint8_t* src, size_t count)
+        {
+            size_t i = 0;
+            for (; i + UNPACK_YUV_BLOCK <= count; i += UNPACK_YUV_BLOCK)
+            {
+                // 8 macropixels, split into their 4 components
+                const uint8x8x4_t s = vld4_u8(src + 2 * i);
+                const uint8x8_t y_even = s.val[UYVY ? 1 : 0], u = s.val[UYVY ? 0 : 1];
+                const uint8x8_t y_odd = s.val[UYVY ? 3 : 2], v = s.val[UYVY ? 2 : 3];
+
+                if (FORMAT == RS2_FORMAT_Y8)
+                {
+                    const uint8x8x2_t out = { { y_even, y_odd } };
+                    vst2_u8(dst + i, out);
+                    continue;
+                }
+                if (FORMAT == RS2_FORMAT_Y16)
+                {
+                    const uint8x8_t zero = vdup_n_u8(0);
+                    const uint8x8x4_t out = { { zero, y_even, zero, y_odd } };
+                    vst4_u8(dst + 2 * i, out);
+                    continue;
+                }
+
+                const int16x8_t d = widen(u, 128), e = widen(v, 128);
+                const int16x4_t d_low = vget_low_s16(d), d_high = vget_high_s16(d);
+                const int16x4_t e_low = vget_low_s16(e), e_high = vget_high_s16(e);
+                const int32x4_t round = vdupq_n_s32(128);
+                const int32x4_t r_low = vmlal_n_s16(round, e_low, 409), r_high = vmlal_n_s16(round, e_high, 409);
+                const int32x4_t g_low = vmlal_n_s16(vmlal_n_s16(round, d_low, -100), e_low, -208);
+                const int32x4_t g_high = vmlal_n_s16(vmlal_n_s16(round, d_high, -100), e_high, -208);
+                const int32x4_t b_low = vmlal_n_s16(round, d_low, 516), b_high = vmlal_n_s16(round, d_high, 516);
+
+                const int16x8_t c_even = widen(y_even, 16), c_odd = widen(y_odd, 16);
+                const uint8x16_t r = interleave(channel(c_even, r_low, r_high), channel(c_odd, r_low, r_high));
+                const uint8x16_t g = interleave(channel(c_even, g_low, g_high), channel(c_odd, g_low, g_high));
+                const uint8x16_t b = interleave(channel(c_even, b_low, b_high), channel(c_odd, b_low, b_high));
+
+                if (FORMAT == RS2_FORMAT_RGB8)
+                {
+                    const uint8x16x3_t out = { { r, g, b } };
+                    vst3q_u8(dst + 3 * i, out);
+                }
+                if (FORMAT == RS2_FORMAT_BGR8)
+                {
+                    const uint8x16x3_t out = { { b, g, r } };
+                    vst3q_u8(dst + 3 * i, out);
+                }
+                if (FORMAT == RS2_FORMAT_RGBA8)
+                {
+                    const uint8x16x4_t out = { { r, g, b, vdupq_n_u8(255) } };
+                    vst4q_u8(dst + 4 * i, out);
+                }
+                if (FORMAT == RS2_FORMAT_BGRA8)
+                {
+                    const uint8x16x4_t out = { { b, g, r, vdupq_n_u8(255) } };
+                    vst4q_u8(dst + 4 * i, out);
+                }
+            }
+            return i;
+        }
+
+        template<bool UYVY>
+        static size_t unpack(rs2_format dst_format, uint8_t* dst, const uint8_t* src, size_t count)
+        {
+            switch (dst_format)
+            {
+            case RS2_FORMAT_Y8: return unpack<UYVY, RS2_FORMAT_Y8>(dst, src, count);
+            case RS2_FORMAT_Y16: return unpack<UYVY, RS2_FORMAT_Y16>(dst, src, count);
+            case RS2_FORMAT_RGB8: return unpack<UYVY, RS2_FORMAT_RGB8>(dst, src, count);
+            case RS2_FORMAT_BGR8: return unpack<UYVY, RS2_FORMAT_BGR8>(dst, src, count);
+            case RS2_FORMAT_RGBA8: return unpack<UYVY, RS2_FORMAT_RGBA8>(dst, src, count);
+            case RS2_FORMAT_BGRA8: return unpack<UYVY, RS2_FORMAT_BGRA8>(dst, src, count);
+            default: return 0;
+            }
+        }
+    }
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::unpack_yuv_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool unpack_yuv_simd_supported()
+    {
+#ifdef UNPACK_YUV_NEON
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t unpack_yuv_simd(rs2_format src_format, rs2_format dst_format, uint8_t* dst, const uint8_t* src, size_t count)
+    {
+        if (use_avx2())
+            return avx2::unpack_yuv(src_format, dst_format, dst, src, count);
+#ifdef UNPACK_YUV_NEON
+        switch (src_format)
+        {
+        case RS2_FORMAT_YUYV: return neon::unpack<false>(dst_format, dst, src, count);
+        case RS2_FORMAT_UYVY: return neon::unpack<true>(dst_format, dst, src, count);
+        default: return 0;
+        }
+#else
+        return 0;
+#endif
+    }
+}
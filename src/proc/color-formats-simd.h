@@ -0,0 +1,36 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized unpacking of YUY2 (RS2_FORMAT_YUYV) and UYVY pixels
+
+#pragma once
+
+#include "../include/librealsense2/h/rs_sensor.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Whether a SIMD implementation is available for the running CPU
+    bool unpack_yuv_simd_supported();
+
+    // Unpack the leading pixels of YUYV or UYVY data into RGB8, BGR8, RGBA8, BGRA8, Y8 or Y16, with the
+    // output of the scalar code of unpack_yuy2 and unpack_uyvy:
+    //     r = clamp((298 * (y - 16) + 409 * (v - 128) + 128) >> 8)
+    //     g = clamp((298 * (y - 16) - 100 * (u - 128) - 208 * (v - 128) + 128) >> 8)
+    //     b = clamp((298 * (y - 16) + 516 * (u - 128) + 128) >> 8)
+    // and y, or y << 8, for the luminance formats. Return the number of pixels processed, a multiple
+    // of UNPACK_YUV_BLOCK; the rest is left to the caller, and so are all of them for other formats
+    size_t unpack_yuv_simd(rs2_format src_format, rs2_format dst_format, uint8_t* dst, const uint8_t* src, size_t count);
+
+    // Pixels handled by a single iteration of the kernels: 32 bytes of YUYV or UYVY
+    const size_t UNPACK_YUV_BLOCK = 16;
+
+    namespace avx2
+    {
+        // Implemented in color-formats-avx.cpp. unpack_yuv_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool unpack_yuv_built();
+        size_t unpack_yuv(rs2_format src_format, rs2_format dst_format, uint8_t* dst, const uint8_t* src, size_t count);
+    }
+}
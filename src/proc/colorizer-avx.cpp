@@ -0,0 +1,41 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "colorizer-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        bool colorizer_built() { return true; }
+
+        size_t colorize_lut(uint8_t* rgb, const uint16_t* depth, const uint32_t* lut, size_t count)
+        {
+            // The RGB bytes of each 4 colors, packed at the start of each 128-bit lane
+            const __m256i pack = _mm256_setr_epi8(
+                0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+            // Each lane is stored as 16 bytes of which 12 are colors, so the last store of a block
+            // runs 4 bytes into the pixels of the next one
+            size_t i = 0;
+            for (; i + 10 <= count; i += 8)
+            {
+                const __m256i index = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(depth + i)));
+                const __m256i colors = _mm256_shuffle_epi8(_mm256_i32gather_epi32(reinterpret_cast<const int*>(lut), index, 4), pack);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb + i * 3), _mm256_castsi256_si128(colors));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb + i * 3 + 12), _mm256_extracti128_si256(colors, 1));
+            }
+            return i;
+        }
+#else
+        bool colorizer_built() { return false; }
+        size_t colorize_lut(uint8_t*, const uint16_t*, const uint32_t*, size_t) { return 0; }
+#endif
+    }
+}
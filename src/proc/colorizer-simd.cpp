@@ -0,0 +1,28 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "colorizer-simd.h"
+#include "simd-support.h"
+
+namespace librealsense
+{
+    // There is no NEON gather: on ARM the table is applied by the scalar code of the colorizer
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::colorizer_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool colorizer_simd_supported()
+    {
+        return use_avx2();
+    }
+
+    size_t colorize_lut_simd(uint8_t* rgb, const uint16_t* depth, const uint32_t* lut, size_t count)
+    {
+        if (use_avx2())
+            return avx2::colorize_lut(rgb, depth, lut, count);
+        return 0;
+    }
+}
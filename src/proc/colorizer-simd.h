@@ -0,0 +1,27 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized coloring of depth through a lookup table, for the colorizer
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Whether a SIMD implementation is available for the running CPU
+    bool colorizer_simd_supported();
+
+    // Color 'count' depth pixels into RGB8, through a table of the 0x10000 depth values colors, each
+    // packed as R | G << 8 | B << 16.
+    // Return the number of leading pixels colored, the rest being left to the caller
+    size_t colorize_lut_simd(uint8_t* rgb, const uint16_t* depth, const uint32_t* lut, size_t count);
+
+    namespace avx2
+    {
+        // Implemented in colorizer-avx.cpp. colorizer_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool colorizer_built();
+        size_t colorize_lut(uint8_t* rgb, const uint16_t* depth, const uint32_t* lut, size_t count);
+    }
+}
@@ -9,6 +9,7 @@
 #include "environment.h"
 #include "option.h"
 #include "colorizer.h"
+#include "colorizer-simd.h"
 #include "disparity-transform.h"
 
 namespace librealsense
@@ -220,6 +221,65 @@ namespace librealsense
 
         auto hist_opt = std::make_shared<ptr_option<bool>>(false, true, true, true, &_equalize, "Perform histogram equalization");
         register_option(RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, hist_opt);
+        register_processing_threads_option();
+    }
+
+    template<typename T>
+    void colorizer::update_histogram_parallel(const T* depth_data, int w, int h)
+    {
+        // The first range of rows is counted into _hist_data, the others into the partial histograms
+        auto rows = std::max<size_t>(1, (size_t(h) + processing_threads() - 1) / processing_threads());
+        auto ranges = (size_t(h) + rows - 1) / rows;
+        if (_partial_histograms.size() < ranges - 1)
+            _partial_histograms.resize(ranges - 1, std::vector<int>(MAX_DEPTH, 0));
+
+        memset(_hist_data, 0, MAX_DEPTH * sizeof(int));
+        parallel_for(h, rows, [&](size_t first, size_t last)
+        {
+            auto range = first / rows;
+            int* hist = range ? _partial_histograms[range - 1].data() : _hist_data;
+            for (auto i = int(first) * w; i < int(last) * w; ++i)
+                hist[static_cast<int>(depth_data[i])] += 1;
+        });
+
+        // Clearing the partial histograms for the next frame as they are summed
+        if (ranges > 1)
+        {
+            parallel_for(MAX_DEPTH, 0x1000, [&](size_t first, size_t last)
+            {
+                for (size_t r = 0; r < ranges - 1; ++r)
+                {
+                    auto partial = _partial_histograms[r].data();
+                    for (auto i = first; i < last; ++i)
+                    {
+                        _hist_data[i] += partial[i];
+                        partial[i] = 0;
+                    }
+                }
+            });
+        }
+
+        for (auto i = 2; i < MAX_DEPTH; ++i) _hist_data[i] += _hist_data[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
+    }
+
+    void colorizer::make_rgb_data_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        auto lut = _depth_lut.data();
+
+        // Rows are independent
+        parallel_for(height, 1, [&](size_t first, size_t last)
+        {
+            auto count = (last - first) * width;
+            auto depth = depth_data + first * width;
+            auto rgb = rgb_data + first * width * 3;
+            for (auto i = colorize_lut_simd(rgb, depth, lut, count); i < count; ++i)
+            {
+                auto c = lut[depth[i]];
+                rgb[i * 3 + 0] = uint8_t(c);
+                rgb[i * 3 + 1] = uint8_t(c >> 8);
+                rgb[i * 3 + 2] = uint8_t(c >> 16);
+            }
+        });
     }
 
     bool colorizer::should_process(const rs2::frame& frame)
@@ -278,14 +338,23 @@ namespace librealsense
             if (depth_format == RS2_FORMAT_DISPARITY32)
             {
                 auto depth_data = reinterpret_cast<const float*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
+                update_histogram_parallel(depth_data, w, h);
                 make_rgb_data<float>(depth_data, rgb_data, w, h, coloring_function);
             }
             else if (depth_format == RS2_FORMAT_Z16)
             {
+                // Equalization colors each depth value the same way throughout the frame, through a
+                // table made for the frame when it has more pixels than the table
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_histogram_parallel(depth_data, w, h);
+                if (w * h < MAX_DEPTH)
+                    make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                else
+                {
+                    update_depth_lut(coloring_function);
+                    _fixed_depth_lut = false;
+                    make_rgb_data_lut(depth_data, rgb_data, w, h);
+                }
             }
         };
 
@@ -318,7 +387,14 @@ namespace librealsense
                     if (min >= max) return 0.f;
                     return (data * _depth_units - min) / (max - min);
                 };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                auto key = std::make_tuple(min, max, _depth_units, _map_index);
+                if (!_fixed_depth_lut || key != _depth_lut_key)
+                {
+                    update_depth_lut(coloring_function);
+                    _depth_lut_key = key;
+                    _fixed_depth_lut = true;
+                }
+                make_rgb_data_lut(depth_data, rgb_data, w, h);
             }
         };
 
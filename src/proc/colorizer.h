@@ -4,6 +4,8 @@
 #pragma once
 
 #include <map>
+#include <mutex>
+#include <tuple>
 #include <vector>
 
 namespace rs2
@@ -127,13 +129,43 @@ namespace librealsense {
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
             auto cm = _maps[_map_index];
-            for (auto i = 0; i < width*height; ++i)
+
+            // Rows are independent
+            parallel_for(height, 1, [&](size_t first, size_t last)
             {
-                auto d = depth_data[i];
-                colorize_pixel(rgb_data, i, cm, d, coloring_func);
-            }
+                for (auto i = int(first) * width; i < int(last) * width; ++i)
+                {
+                    auto d = depth_data[i];
+                    colorize_pixel(rgb_data, i, cm, d, coloring_func);
+                }
+            });
         }
 
+        // The colors of all the Z16 depth values, in _depth_lut, for make_rgb_data_lut().
+        // They are those colorize_pixel() gives
+        template<typename F>
+        void update_depth_lut(F coloring_func)
+        {
+            auto cm = _maps[_map_index];
+            _depth_lut.resize(MAX_DEPTH);
+            _depth_lut[0] = 0;
+            parallel_for(MAX_DEPTH, 0x1000, [&](size_t first, size_t last)
+            {
+                for (auto d = std::max(first, size_t(1)); d < last; ++d)
+                {
+                    auto c = cm->get(coloring_func(float(d)));
+                    _depth_lut[d] = uint32_t(uint8_t(c.x)) | uint32_t(uint8_t(c.y)) << 8 | uint32_t(uint8_t(c.z)) << 16;
+                }
+            });
+        }
+
+        void make_rgb_data_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
+        // update_histogram(), with a range of rows per thread counted into its own histogram, and the
+        // histograms summed over ranges of values at the end
+        template<typename T>
+        void update_histogram_parallel(const T* depth_data, int w, int h);
+
         template<typename T, typename F>
         void colorize_pixel(uint8_t* rgb_data, int idx, color_map* cm, T data, F coloring_func)
         {
@@ -161,6 +193,13 @@ namespace librealsense {
 
         std::vector<int> _histogram;
         int* _hist_data;
+        std::vector<std::vector<int>> _partial_histograms; // all zeros between frames
+
+        // Z16 depth colors, packed as R | G << 8 | B << 16. With a fixed range, they only change with
+        // the range, depth units and color map they were made for
+        std::vector<uint32_t> _depth_lut;
+        std::tuple<float, float, float, int> _depth_lut_key;
+        bool _fixed_depth_lut = false;
 
         int _preset = 0;
         rs2::stream_profile _target_stream_profile;
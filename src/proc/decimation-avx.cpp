@@ -0,0 +1,100 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "decimation-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        static __m256i load(const uint16_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+
+        // The pixels at each position of 16 patches side by side, one vector per position
+        template<int S>
+        static void load_patches(__m256i* v, const uint16_t* in, size_t stride)
+        {
+            alignas(32) uint16_t samples[S * S][16];
+            for (int n = 0; n < S; ++n)
+            {
+                const uint16_t* row = in + n * stride;
+                for (int lane = 0; lane < 16; ++lane)
+                    for (int m = 0; m < S; ++m)
+                        samples[n * S + m][lane] = row[lane * S + m];
+            }
+            for (int k = 0; k < S * S; ++k)
+                v[k] = _mm256_load_si256(reinterpret_cast<const __m256i*>(samples[k]));
+        }
+
+        // 2x2 patches only need the even and odd pixels of each row apart
+        template<>
+        void load_patches<2>(__m256i* v, const uint16_t* in, size_t stride)
+        {
+            const __m256i low = _mm256_set1_epi32(0xffff);
+            for (int n = 0; n < 2; ++n)
+            {
+                const __m256i a = load(in + n * stride), b = load(in + n * stride + 16);
+                const __m256i even = _mm256_packus_epi32(_mm256_and_si256(a, low), _mm256_and_si256(b, low));
+                const __m256i odd = _mm256_packus_epi32(_mm256_srli_epi32(a, 16), _mm256_srli_epi32(b, 16));
+                v[n * 2] = _mm256_permute4x64_epi64(even, 0xd8);
+                v[n * 2 + 1] = _mm256_permute4x64_epi64(odd, 0xd8);
+            }
+        }
+
+        template<int N, int PAIRS>
+        static __m256i median(__m256i* v, const uint8_t (&network)[PAIRS][2])
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i zeros = zero;
+            for (int k = 0; k < N; ++k)
+                zeros = _mm256_sub_epi16(zeros, _mm256_cmpeq_epi16(v[k], zero));
+
+            for (auto& pair : network)
+            {
+                const __m256i lo = _mm256_min_epu16(v[pair[0]], v[pair[1]]);
+                v[pair[1]] = _mm256_max_epu16(v[pair[0]], v[pair[1]]);
+                v[pair[0]] = lo;
+            }
+
+            // Zeros only ever move the median up
+            const __m256i at = _mm256_srli_epi16(_mm256_add_epi16(zeros, _mm256_set1_epi16(N - 1)), 1);
+            __m256i result = zero;
+            for (int k = (N - 1) / 2; k < N; ++k)
+                result = _mm256_or_si256(result, _mm256_and_si256(_mm256_cmpeq_epi16(at, _mm256_set1_epi16(k)), v[k]));
+            return result;
+        }
+
+        template<int S, int PAIRS>
+        static size_t median_of(uint16_t* out, const uint16_t* in, size_t stride, size_t count, const uint8_t (&network)[PAIRS][2])
+        {
+            __m256i v[S * S];
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                load_patches<S>(v, in + i * S, stride);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), median<S * S>(v, network));
+            }
+            return i;
+        }
+
+        bool decimation_built() { return true; }
+
+        size_t decimate_depth_median(uint16_t* out, const uint16_t* in, size_t stride, size_t count, size_t scale)
+        {
+            switch (scale)
+            {
+            case 2: return median_of<2>(out, in, stride, count, decimation_sort4);
+            case 3: return median_of<3>(out, in, stride, count, decimation_sort9);
+            default: return 0;
+            }
+        }
+#else
+        bool decimation_built() { return false; }
+        size_t decimate_depth_median(uint16_t*, const uint16_t*, size_t, size_t, size_t) { return 0; }
+#endif
+    }
+}
@@ -12,6 +12,7 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/decimation-filter.h"
+#include "proc/decimation-simd.h"
 
 
 #define PIX_SORT(a,b) { if ((a)>(b)) PIX_SWAP((a),(b)); }
@@ -194,6 +195,106 @@ namespace librealsense
         return PIX_MIN(p[4], p[2]);
     }
 
+    // The median of the non-zero pixels of a patch, the one below the middle for an even number of them
+    static uint16_t median_of_nonzero(const uint16_t* in, size_t stride, size_t scale, uint16_t* working_kernel)
+    {
+        auto wk_itr = working_kernel;
+        for (size_t n = 0; n < scale; ++n, in += stride)
+        {
+            for (size_t m = 0; m < scale; ++m)
+            {
+                if (in[m])
+                    *wk_itr++ = in[m];
+            }
+        }
+
+        switch (wk_itr - working_kernel)
+        {
+        case 0: return 0;
+        case 1: return working_kernel[0];
+        case 2: return PIX_MIN(working_kernel[0], working_kernel[1]);
+        case 3: return opt_med3<uint16_t>(working_kernel);
+        case 4: return opt_med4<uint16_t>(working_kernel);
+        case 5: return opt_med5<uint16_t>(working_kernel);
+        case 6: return opt_med6<uint16_t>(working_kernel);
+        case 7: return opt_med7<uint16_t>(working_kernel);
+        case 8: return opt_med8<uint16_t>(working_kernel);
+        default: return opt_med9<uint16_t>(working_kernel);
+        }
+    }
+
+    // The sums of 'rows' rows, 'stride' values apart, over their first 'width' values.
+    // Summing whole rows before the patches keeps the inner loops over contiguous values, which vectorize
+    template<class T>
+    static void sum_rows(const T* in, size_t stride, size_t rows, size_t width, int* sums)
+    {
+        std::fill(sums, sums + width, 0);
+        for (size_t n = 0; n < rows; ++n, in += stride)
+        {
+            for (size_t x = 0; x < width; ++x)
+                sums[x] += in[x];
+        }
+    }
+
+    // The number of non-zero values the rows add to their sums
+    static void count_nonzero_rows(const uint16_t* in, size_t stride, size_t rows, size_t width, int* counts)
+    {
+        std::fill(counts, counts + width, 0);
+        for (size_t n = 0; n < rows; ++n, in += stride)
+        {
+            for (size_t x = 0; x < width; ++x)
+                counts[x] += (in[x] != 0);
+        }
+    }
+
+    // The mean of each 'SCALE' x 'SCALE' patch of pixels of 'channels' values, channel by channel,
+    // for output rows [first, last), with the padded columns zeroed. The scale is a template
+    // parameter so that the patch loops unroll and the division turns into a multiplication
+    template<class T, size_t SCALE>
+    static void decimate_mean(const T* in, T* out, size_t width_in, size_t channels,
+        size_t real_width, size_t padded_width, size_t first, size_t last)
+    {
+        const size_t patch_size = SCALE * SCALE;
+        std::vector<int> sums(real_width * SCALE * channels);
+        for (size_t j = first; j < last; ++j)
+        {
+            sum_rows(in + j * SCALE * width_in * channels, width_in * channels, SCALE, sums.size(), sums.data());
+
+            T* q = out + j * padded_width * channels;
+            const int* p = sums.data();
+            for (size_t i = 0; i < real_width; ++i, p += SCALE * channels)
+            {
+                for (size_t k = 0; k < channels; ++k)
+                {
+                    int sum = 0;
+                    for (size_t m = 0; m < SCALE; ++m)
+                        sum += p[m * channels + k];
+                    *q++ = (T)(sum / patch_size);
+                }
+            }
+
+            // Fill-in the padded colums with zeros
+            std::fill(q, out + (j + 1) * padded_width * channels, T(0));
+        }
+    }
+
+    template<class T>
+    static void decimate_mean(const T* in, T* out, size_t width_in, size_t channels, size_t scale,
+        size_t real_width, size_t padded_width, size_t first, size_t last)
+    {
+        switch (scale)
+        {
+        case 1: decimate_mean<T, 1>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        case 2: decimate_mean<T, 2>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        case 3: decimate_mean<T, 3>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        case 4: decimate_mean<T, 4>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        case 5: decimate_mean<T, 5>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        case 6: decimate_mean<T, 6>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        case 7: decimate_mean<T, 7>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        default: decimate_mean<T, 8>(in, out, width_in, channels, real_width, padded_width, first, last); break;
+        }
+    }
+
     const uint8_t decimation_min_val = 1;
     const uint8_t decimation_max_val = 8;    // Decimation levels according to the reference design
     const uint8_t decimation_default_val = 2;
@@ -239,6 +340,7 @@ namespace librealsense
         });
 
         register_option(RS2_OPTION_FILTER_MAGNITUDE, decimation_control);
+        register_processing_threads_option();
     }
 
     rs2::frame decimation_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -275,6 +377,19 @@ namespace librealsense
         return f;
     }
 
+    rs2::stream_profile decimation_filter::get_depth_output_profile(const rs2::frame& f)
+    {
+        update_output_profile(f);
+        return _target_stream_profile;
+    }
+
+    void decimation_filter::decimate_depth_frame(const rs2::video_frame& f, uint16_t* out)
+    {
+        // decimate_depth() pads the columns but not the rows
+        decimate_depth(static_cast<const uint16_t*>(f.get_data()), out, f.get_width(), f.get_height(), _patch_size);
+        std::fill(out + size_t(_real_height) * _padded_width, out + size_t(_padded_height) * _padded_width, uint16_t(0));
+    }
+
     void  decimation_filter::update_output_profile(const rs2::frame& f)
     {
         if (_options_changed || f.get_profile().get() != _source_stream_profile.get())
@@ -357,132 +472,52 @@ namespace librealsense
     void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
     {
-        // Use median filtering
-        std::vector<uint16_t> working_kernel(_kernel_size);
-        auto wk_begin = working_kernel.data();
-        auto wk_itr = wk_begin;
-        std::vector<uint16_t*> pixel_raws(scale);
-        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in);
-
-        if (scale == 2 || scale == 3)
+        // Output rows are independent. Patches of 2x2 and 3x3 pixels take the median of their
+        // non-zero pixels, the larger ones their mean
+        const bool median = (scale == 2 || scale == 3);
+        parallel_for(_real_height, 1, [&](size_t first, size_t last)
         {
-            for (int j = 0; j < _real_height; j++)
+            std::vector<uint16_t> working_kernel(scale * scale);
+            std::vector<int> sums, counts;
+            if (!median)
             {
-                uint16_t *p{};
-                // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
+                sums.resize(_real_width * scale);
+                counts.resize(_real_width * scale);
+            }
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+            for (size_t j = first; j < last; ++j)
+            {
+                const uint16_t* in = frame_data_in + j * scale * width_in;
+                uint16_t* out = frame_data_out + j * _padded_width;
+                if (median)
                 {
-                    wk_itr = wk_begin;
-                    // extract data the kernel to process
-                    for (size_t n = 0; n < scale; ++n)
-                    {
-                        p = pixel_raws[n] + chunk_offset;
-                        for (size_t m = 0; m < scale; ++m)
-                        {
-                            if (*(p + m))
-                                *wk_itr++ = *(p + m);
-                        }
-                    }
-
-                    // For even-size kernels pick the member one below the middle
-                    auto ks = (int)(wk_itr - wk_begin);
-                    if (ks == 0)
-                        *frame_data_out++ = 0;
-                    else
-                    {
-                        switch (ks)
-                        {
-                        case 1:
-                            *frame_data_out++ = working_kernel[0];
-                            break;
-                        case 2:
-                            *frame_data_out++ = PIX_MIN(working_kernel[0], working_kernel[1]);
-                            break;
-                        case 3:
-                            *frame_data_out++ = opt_med3<uint16_t>(working_kernel.data());
-                            break;
-                        case 4:
-                            *frame_data_out++ = opt_med4<uint16_t>(working_kernel.data());
-                            break;
-                        case 5:
-                            *frame_data_out++ = opt_med5<uint16_t>(working_kernel.data());
-                            break;
-                        case 6:
-                            *frame_data_out++ = opt_med6<uint16_t>(working_kernel.data());
-                            break;
-                        case 7:
-                            *frame_data_out++ = opt_med7<uint16_t>(working_kernel.data());
-                            break;
-                        case 8:
-                            *frame_data_out++ = opt_med8<uint16_t>(working_kernel.data());
-                            break;
-                        case 9:
-                            *frame_data_out++ = opt_med9<uint16_t>(working_kernel.data());
-                            break;
-                        }
-                    }
-
-                    chunk_offset += scale;
+                    for (size_t i = decimate_depth_median_simd(out, in, width_in, _real_width, scale); i < _real_width; ++i)
+                        out[i] = median_of_nonzero(in + i * scale, width_in, scale, working_kernel.data());
                 }
-
-                // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
-                    *frame_data_out++ = 0;
-
-                // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
-            }
-        }
-        else
-        {
-            for (int j = 0; j < _real_height; j++)
-            {
-                uint16_t *p{};
-                // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
-
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                else
                 {
-                    int sum = 0;
-                    int counter = 0;
-
-                    // extract data the kernel to process
-                    for (size_t n = 0; n < scale; ++n)
+                    sum_rows(in, width_in, scale, sums.size(), sums.data());
+                    count_nonzero_rows(in, width_in, scale, counts.size(), counts.data());
+                    for (size_t i = 0; i < _real_width; ++i)
                     {
-                        p = pixel_raws[n] + chunk_offset;
-                        for (size_t m = 0; m < scale; ++m)
+                        int sum = 0;
+                        int counter = 0;
+                        for (size_t m = i * scale; m < (i + 1) * scale; ++m)
                         {
-                            if (*(p + m))
-                            {
-                                sum += p[m];
-                                ++counter;
-                            }
+                            sum += sums[m];
+                            counter += counts[m];
                         }
+                        out[i] = (counter == 0 ? 0 : sum / counter);
                     }
-
-                    *frame_data_out++ = (counter == 0 ? 0 : sum / counter);
-                    chunk_offset += scale;
                 }
 
                 // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
-                    *frame_data_out++ = 0;
-
-                // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
+                std::fill(out + _real_width, out + _padded_width, uint16_t(0));
             }
-        }
+        });
 
         // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
-        {
-            for (auto u = 0; u < _padded_width; ++u)
-                *frame_data_out++ = 0;
-        }
+        std::fill(frame_data_out + _real_height * _padded_width, frame_data_out + _padded_height * _padded_width, uint16_t(0));
     }
 
     void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
@@ -667,167 +702,32 @@ namespace librealsense
 
         case RS2_FORMAT_RGB8:
         case RS2_FORMAT_BGR8:
-        {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;;
-
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < _real_width; ++i)
-                {
-                    for (int k = 0; k < 3; ++k)
-                    {
-                        p = from + scale * (j * width_in + i) * 3 + k;
-                        sum = 0;
-                        for (int n = 0; n < scale; ++n)
-                        {
-                            for (int m = 0; m < scale; ++m)
-                                sum += p[m * 3];
-
-                            p += width_in * 3;
-                        }
-
-                        *q++ = (uint8_t)(sum / patch_size);
-                    }
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-        }
-        break;
-
         case RS2_FORMAT_RGBA8:
         case RS2_FORMAT_BGRA8:
-        {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;
-
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < _real_width; ++i)
-                {
-                    for (int k = 0; k < 4; ++k)
-                    {
-                        p = from + scale * (j * width_in + i) * 4 + k;
-                        sum = 0;
-                        for (int n = 0; n < scale; ++n)
-                        {
-                            for (int m = 0; m < scale; ++m)
-                                sum += p[m * 4];
-
-                            p += width_in * 4;
-                        }
-
-                        *q++ = (uint8_t)(sum / patch_size);
-                    }
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                {
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                    *q++ = 0;
-                }
-            }
-        }
-        break;
-
         case RS2_FORMAT_Y8:
-        {
-            uint8_t* from = (uint8_t*)frame_data_in;
-            uint8_t* p = nullptr;
-            uint8_t* q = (uint8_t*)frame_data_out;
-
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < _real_width; ++i)
-                {
-                    p = from + scale * (j * width_in + i);
-                    sum = 0;
-                    for (int n = 0; n < scale; ++n)
-                    {
-                        for (int m = 0; m < scale; ++m)
-                            sum += p[m];
-
-                        p += width_in;
-                    }
-
-                    *q++ = (uint8_t)(sum / patch_size);
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                    *q++ = 0;
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
-            {
-                for (int i = 0; i < _padded_width; ++i)
-                    *q++ = 0;
-            }
-        }
-        break;
-
         case RS2_FORMAT_Y16:
         {
-            uint16_t* from = (uint16_t*)frame_data_in;
-            uint16_t* p = nullptr;
-            uint16_t* q = (uint16_t*)frame_data_out;
-
-            for (int j = 0; j < _real_height; ++j)
-            {
-                for (int i = 0; i < _real_width; ++i)
-                {
-                    p = from + scale * (j * width_in + i);
-                    sum = 0;
-                    for (int n = 0; n < scale; ++n)
-                    {
-                        for (int m = 0; m < scale; ++m)
-                            sum += p[m];
-
-                        p += width_in;
-                    }
-
-                    *q++ = (uint16_t)(sum / patch_size);
-                }
-
-                for (int i = _real_width; i < _padded_width; ++i)
-                    *q++ = 0;
-            }
-
-            for (int j = _real_height; j < _padded_height; ++j)
+            // The mean of each patch, channel by channel. Output rows are independent
+            size_t channels = 1;
+            if (format == RS2_FORMAT_RGB8 || format == RS2_FORMAT_BGR8)
+                channels = 3;
+            else if (format == RS2_FORMAT_RGBA8 || format == RS2_FORMAT_BGRA8)
+                channels = 4;
+            const size_t value_size = (format == RS2_FORMAT_Y16) ? sizeof(uint16_t) : sizeof(uint8_t);
+
+            parallel_for(_real_height, 1, [&](size_t first, size_t last)
             {
-                for (int i = 0; i < _padded_width; ++i)
-                    *q++ = 0;
-            }
+                if (format == RS2_FORMAT_Y16)
+                    decimate_mean(static_cast<const uint16_t*>(frame_data_in), static_cast<uint16_t*>(frame_data_out),
+                        width_in, channels, scale, _real_width, _padded_width, first, last);
+                else
+                    decimate_mean(static_cast<const uint8_t*>(frame_data_in), static_cast<uint8_t*>(frame_data_out),
+                        width_in, channels, scale, _real_width, _padded_width, first, last);
+            });
+
+            // Fill-in the padded rows with zeros
+            const size_t row_size = _padded_width * channels * value_size;
+            memset(static_cast<uint8_t*>(frame_data_out) + _real_height * row_size, 0, (_padded_height - _real_height) * row_size);
         }
         break;
 
@@ -836,4 +736,3 @@ namespace librealsense
         }
     }
 }
-
@@ -15,6 +15,13 @@ namespace librealsense
     public:
         decimation_filter();
 
+        // Decimating depth into a frame allocated by the caller, for fused_depth_filters: the output
+        // profile for the depth frame f, the padded size of that output, and the decimation of f into it
+        rs2::stream_profile get_depth_output_profile(const rs2::frame& f);
+        size_t get_padded_width() const { return _padded_width; }
+        size_t get_padded_height() const { return _padded_height; }
+        void decimate_depth_frame(const rs2::video_frame& f, uint16_t* out);
+
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source, rs2_extension tgt_type);
 
@@ -0,0 +1,103 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "decimation-simd.h"
+#include "simd-support.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DECIMATION_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+#ifdef DECIMATION_NEON
+    namespace neon
+    {
+        // The pixels at each position of 8 patches side by side, one vector per position
+        static void load_patches(uint16x8_t* v, const uint16_t* in, size_t stride, size_t scale)
+        {
+            for (size_t n = 0; n < scale; ++n)
+            {
+                if (scale == 2)
+                {
+                    const uint16x8x2_t row = vld2q_u16(in + n * stride);
+                    v[n * 2] = row.val[0];
+                    v[n * 2 + 1] = row.val[1];
+                }
+                else
+                {
+                    const uint16x8x3_t row = vld3q_u16(in + n * stride);
+                    v[n * 3] = row.val[0];
+                    v[n * 3 + 1] = row.val[1];
+                    v[n * 3 + 2] = row.val[2];
+                }
+            }
+        }
+
+        template<int N, int PAIRS>
+        static uint16x8_t median(uint16x8_t* v, const uint8_t (&network)[PAIRS][2])
+        {
+            const uint16x8_t zero = vdupq_n_u16(0);
+            uint16x8_t zeros = zero;
+            for (int k = 0; k < N; ++k)
+                zeros = vsubq_u16(zeros, vceqq_u16(v[k], zero));
+
+            for (auto& pair : network)
+            {
+                const uint16x8_t lo = vminq_u16(v[pair[0]], v[pair[1]]);
+                v[pair[1]] = vmaxq_u16(v[pair[0]], v[pair[1]]);
+                v[pair[0]] = lo;
+            }
+
+            // Zeros only ever move the median up
+            const uint16x8_t at = vshrq_n_u16(vaddq_u16(zeros, vdupq_n_u16(N - 1)), 1);
+            uint16x8_t result = zero;
+            for (int k = (N - 1) / 2; k < N; ++k)
+                result = vbslq_u16(vceqq_u16(at, vdupq_n_u16(k)), v[k], result);
+            return result;
+        }
+
+        static size_t decimate_depth_median(uint16_t* out, const uint16_t* in, size_t stride, size_t count, size_t scale)
+        {
+            if (scale != 2 && scale != 3)
+                return 0;
+
+            uint16x8_t v[9];
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                load_patches(v, in + i * scale, stride, scale);
+                vst1q_u16(out + i, scale == 2 ? median<4>(v, decimation_sort4) : median<9>(v, decimation_sort9));
+            }
+            return i;
+        }
+    }
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::decimation_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool decimation_simd_supported()
+    {
+#ifdef DECIMATION_NEON
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t decimate_depth_median_simd(uint16_t* out, const uint16_t* in, size_t stride, size_t count, size_t scale)
+    {
+        if (use_avx2())
+            return avx2::decimate_depth_median(out, in, stride, count, scale);
+#ifdef DECIMATION_NEON
+        return neon::decimate_depth_median(out, in, stride, count, scale);
+#else
+        return 0;
+#endif
+    }
+}
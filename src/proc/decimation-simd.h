@@ -0,0 +1,36 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized median decimation of depth, for the decimation filter
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Sorting networks of the 4 and 9 pixels of 2x2 and 3x3 patches, as pairs of positions to order
+    static const uint8_t decimation_sort4[][2] = { {0,1},{2,3},{0,2},{1,3},{1,2} };
+    static const uint8_t decimation_sort9[][2] = {
+        {0,3},{1,7},{2,5},{4,8},{0,7},{2,4},{3,8},{5,6},{0,2},{1,3},{4,5},{7,8},{1,4},
+        {3,6},{5,7},{0,1},{2,4},{3,5},{6,8},{2,3},{4,5},{6,7},{1,2},{3,4},{5,6} };
+
+    // Whether a SIMD implementation is available for the running CPU
+    bool decimation_simd_supported();
+
+    // The median of the non-zero pixels of each 'scale' x 'scale' patch of depth, for scales 2 and 3: the
+    // lower of the two middle ones for an even number of them, and zero when there are none.
+    // 'count' patches are taken side by side from the 'scale' rows starting at 'in', 'stride' pixels apart.
+    // Each patch is sorted whole, zeros first, so that the median is the pixel at position
+    // (pixels + zeros - 1) / 2 of its sorted patch.
+    // Return the number of leading patches done, the rest being left to the caller
+    size_t decimate_depth_median_simd(uint16_t* out, const uint16_t* in, size_t stride, size_t count, size_t scale);
+
+    namespace avx2
+    {
+        // Implemented in decimation-avx.cpp. decimation_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool decimation_built();
+        size_t decimate_depth_median(uint16_t* out, const uint16_t* in, size_t stride, size_t count, size_t scale);
+    }
+}
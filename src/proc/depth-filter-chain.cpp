@@ -0,0 +1,167 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../include/librealsense2/hpp/rs_sensor.hpp"
+#include "../include/librealsense2/hpp/rs_processing.hpp"
+
+#include "option.h"
+#include "context.h"
+#include "core/video.h"
+#include "proc/depth-filter-chain.h"
+#include "proc/decimation-filter.h"
+#include "proc/spatial-filter.h"
+#include "proc/temporal-filter.h"
+
+namespace librealsense
+{
+    fused_depth_filters::fused_depth_filters(std::shared_ptr<decimation_filter> decimation,
+        std::shared_ptr<disparity_transform> depth_to_disparity,
+        std::shared_ptr<spatial_filter> spatial,
+        std::shared_ptr<temporal_filter> temporal,
+        std::shared_ptr<disparity_transform> disparity_to_depth)
+        : generic_processing_block("Fused Depth Filters"),
+        _decimation(decimation),
+        _depth_to_disparity(depth_to_disparity),
+        _spatial(spatial),
+        _temporal(temporal),
+        _disparity_to_depth(disparity_to_depth)
+    {
+    }
+
+    std::vector<std::unique_lock<std::mutex>> fused_depth_filters::lock_filters()
+    {
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.emplace_back(_decimation->processing_mutex(), std::defer_lock);
+        locks.emplace_back(_depth_to_disparity->processing_mutex(), std::defer_lock);
+        locks.emplace_back(_spatial->processing_mutex(), std::defer_lock);
+        locks.emplace_back(_temporal->processing_mutex(), std::defer_lock);
+        locks.emplace_back(_disparity_to_depth->processing_mutex(), std::defer_lock);
+        std::lock(locks[0], locks[1], locks[2], locks[3], locks[4]);
+        return locks;
+    }
+
+    bool fused_depth_filters::should_process(const rs2::frame& frame)
+    {
+        if (!frame || frame.is<rs2::frameset>())
+            return false;
+
+        auto locks = lock_filters();
+        return _decimation->accepts(frame) || _depth_to_disparity->accepts(frame) ||
+            _spatial->accepts(frame) || _temporal->accepts(frame) || _disparity_to_depth->accepts(frame);
+    }
+
+    rs2::frame fused_depth_filters::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        auto locks = lock_filters();
+
+        if (can_fuse(f))
+            return process_fused(source, f);
+
+        return process_chained(source, f);
+    }
+
+    bool fused_depth_filters::can_fuse(const rs2::frame& f)
+    {
+        auto profile = f.get_profile();
+        if (profile.stream_type() != RS2_STREAM_DEPTH || profile.format() != RS2_FORMAT_Z16 || f.is<rs2::disparity_frame>())
+            return false;
+
+        // The spatial and temporal filters accept the disparity frame iff they accept the depth one
+        if (!_decimation->accepts(f) || !_depth_to_disparity->accepts(f) ||
+            !_spatial->accepts(f) || !_temporal->accepts(f))
+            return false;
+
+        auto decimated = _decimation->get_depth_output_profile(f);
+        if (decimated.get() != _decimated_profile.get())
+        {
+            _decimated_profile = decimated;
+
+            // The disparity blocks would compute the conversion for the decimated frame
+            _disparity_info = disparity_info::update_info_from_frame(f, _decimated_profile);
+
+            _target_stream_profile = _decimated_profile.clone(RS2_STREAM_DEPTH, 0, RS2_FORMAT_Z16);
+            auto src_vspi = dynamic_cast<video_stream_profile_interface*>(_decimated_profile.get()->profile);
+            auto tgt_vspi = dynamic_cast<video_stream_profile_interface*>(_target_stream_profile.get()->profile);
+            rs2_intrinsics src_intrin = src_vspi->get_intrinsics();
+
+            tgt_vspi->set_intrinsics([src_intrin]() { return src_intrin; });
+            tgt_vspi->set_dims(src_intrin.width, src_intrin.height);
+        }
+
+        return _disparity_info.stereoscopic_depth;
+    }
+
+    rs2::frame fused_depth_filters::process_fused(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        const size_t width = _decimation->get_padded_width();
+        const size_t height = _decimation->get_padded_height();
+
+        auto tgt = source.allocate_video_frame(_target_stream_profile, f, sizeof(uint16_t), int(width), int(height),
+            int(width * sizeof(uint16_t)), RS2_EXTENSION_DEPTH_FRAME);
+        if (!tgt)
+            return tgt;
+        auto depth = static_cast<uint16_t*>(const_cast<void*>(tgt.get_data()));
+
+        _decimation->decimate_depth_frame(f.as<rs2::video_frame>(), depth);
+
+        // The blocks below are configured here for the decimated disparity frame, and reconfigure
+        // themselves on the next frame they process in the regular flow
+        _disparity.resize(width * height);
+        _depth_to_disparity->convert_buffer<uint16_t, float>(depth, _disparity.data(), width, height, _disparity_info.d2d_convert_factor);
+        _spatial->smooth_disparity(_disparity.data(), width, height);
+        // The temporal history carries over from the previous frame when it is of the same size
+        _temporal->smooth_disparity(_disparity.data(), width, height);
+        _disparity_to_depth->convert_buffer<float, uint16_t>(_disparity.data(), depth, width, height, _disparity_info.d2d_convert_factor);
+
+        return tgt;
+    }
+
+    rs2::frame fused_depth_filters::process_chained(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        rs2::frame res = f;
+        chain(*_decimation, source, res);
+        chain(*_depth_to_disparity, source, res);
+        chain(*_spatial, source, res);
+        chain(*_temporal, source, res);
+        chain(*_disparity_to_depth, source, res);
+
+        // Let the generic block pass the input through when no filter applied
+        return res.get() == f.get() ? rs2::frame() : res;
+    }
+
+    depth_filter_chain::depth_filter_chain()
+        : composite_processing_block("Depth Filter Chain")
+    {
+        auto decimation = std::make_shared<decimation_filter>();
+        auto depth_to_disparity = std::make_shared<disparity_transform>(true);
+        auto spatial = std::make_shared<spatial_filter>();
+        auto temporal = std::make_shared<temporal_filter>();
+        auto disparity_to_depth = std::make_shared<disparity_transform>(false);
+
+        add(decimation);
+        add(depth_to_disparity);
+        add(spatial);
+        add(temporal);
+        add(disparity_to_depth);
+
+        _fused = std::make_shared<fused_depth_filters>(decimation, depth_to_disparity, spatial, temporal, disparity_to_depth);
+        update_info(RS2_CAMERA_INFO_NAME, "Depth Filter Chain");
+    }
+
+    void depth_filter_chain::set_output_callback(frame_callback_ptr callback)
+    {
+        // The filter blocks are not invoked, only the fused block publishes frames
+        _fused->set_output_callback(callback);
+    }
+
+    void depth_filter_chain::invoke(frame_holder frames)
+    {
+        _fused->invoke(std::move(frames));
+    }
+
+    void depth_filter_chain::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        processing_block::set_frame_allocator(allocator);
+        _fused->set_frame_allocator(allocator);
+    }
+}
@@ -0,0 +1,79 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include "disparity-transform.h"
+
+namespace librealsense
+{
+    class decimation_filter;
+    class spatial_filter;
+    class temporal_filter;
+
+    // Runs the recommended depth post-processing sequence - decimation, depth to disparity, spatial,
+    // temporal and disparity to depth - on a stereo depth frame as a single step. The decimated frame
+    // is converted into a disparity buffer reused from frame to frame, filtered in place, and written
+    // back to the only frame allocated, so that the intermediate frames of the chained blocks are
+    // neither allocated nor copied.
+    // Every stage runs the kernel of the filter block it replaces, with that block's options and
+    // state, so the output matches the chained blocks. Frames that the fused path does not cover
+    // (non-stereo sensors, other streams and formats) go through the blocks one after the other
+    class fused_depth_filters : public generic_processing_block
+    {
+    public:
+        fused_depth_filters(std::shared_ptr<decimation_filter> decimation,
+            std::shared_ptr<disparity_transform> depth_to_disparity,
+            std::shared_ptr<spatial_filter> spatial,
+            std::shared_ptr<temporal_filter> temporal,
+            std::shared_ptr<disparity_transform> disparity_to_depth);
+
+    protected:
+        bool should_process(const rs2::frame& frame) override;
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        // The state of the filter blocks is shared with their own frame callbacks and options
+        std::vector<std::unique_lock<std::mutex>> lock_filters();
+
+        bool can_fuse(const rs2::frame& f);
+        rs2::frame process_fused(const rs2::frame_source& source, const rs2::frame& f);
+        rs2::frame process_chained(const rs2::frame_source& source, const rs2::frame& f);
+
+        template<typename T>
+        void chain(T& filter, const rs2::frame_source& source, rs2::frame& f)
+        {
+            if (filter.accepts(f))
+                if (auto res = filter.process_step(source, f))
+                    f = res;
+        }
+
+        std::shared_ptr<decimation_filter>      _decimation;
+        std::shared_ptr<disparity_transform>    _depth_to_disparity;
+        std::shared_ptr<spatial_filter>         _spatial;
+        std::shared_ptr<temporal_filter>        _temporal;
+        std::shared_ptr<disparity_transform>    _disparity_to_depth;
+
+        rs2::stream_profile     _decimated_profile;     // The output profile of the decimation block
+        rs2::stream_profile     _target_stream_profile;
+        disparity_info::info    _disparity_info;
+        std::vector<float>      _disparity;             // Scratch disparity frame, at the decimated size
+    };
+
+    // The standard depth post-processing chain as a single processing block.
+    // The filter blocks are kept in the composite for their options, which are exposed and
+    // propagated as by composite_processing_block, while frames are processed by fused_depth_filters
+    class depth_filter_chain : public composite_processing_block
+    {
+    public:
+        depth_filter_chain();
+
+        void set_output_callback(frame_callback_ptr callback) override;
+        void invoke(frame_holder frames) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
+
+    private:
+        std::shared_ptr<fused_depth_filters> _fused;
+    };
+}
@@ -37,6 +37,7 @@ namespace librealsense
         });
 
         unregister_option(RS2_OPTION_FRAMES_QUEUE_SIZE);
+        register_processing_threads_option();
 
         on_set_mode(_transform_to_disparity);
     }
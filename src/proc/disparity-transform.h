@@ -27,24 +27,40 @@ namespace librealsense
             static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
             static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
 
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
             bool fp = (std::is_floating_point<Tin>::value);
             const float round = fp ? 0.5f : 0.f;
 
-            float input{};
             //TODO SSE optimize
-            for (auto i = 0; i < _height; i++)
-                for (auto j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
+            parallel_for(_height, 1, [&](size_t first, size_t last)
+            {
+                auto in = reinterpret_cast<const Tin*>(in_data) + first * _width;
+                auto out = reinterpret_cast<Tout*>(out_data) + first * _width;
+
+                float input{};
+                for (auto i = first; i < last; i++)
+                    for (auto j = 0; j < _width; j++)
+                    {
+                        input = *in;
+                        if (std::isnormal(input))
+                            *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
+                        else
+                            *out++ = 0;
+                        in++;
+                    }
+            });
+        }
+
+    public:
+        // Converting a buffer of the caller, for fused_depth_filters. The block configures itself
+        // again on the next frame it processes
+        template<typename Tin, typename Tout>
+        void convert_buffer(const void* in_data, void* out_data, size_t width, size_t height, float d2d_convert_factor)
+        {
+            _source_stream_profile = rs2::stream_profile();
+            _width = width;
+            _height = height;
+            _d2d_convert_factor = d2d_convert_factor;
+            convert<Tin, Tout>(in_data, out_data);
         }
 
     private:
@@ -75,6 +91,13 @@ namespace librealsense
         };
 
         static info update_info_from_frame(const rs2::frame& f)
+        {
+            return update_info_from_frame(f, f.get_profile());
+        }
+
+        // The conversion factor is computed for the intrinsics of 'profile', which may differ from
+        // those of the frame when the frame is to be resized (see depth_filter_chain)
+        static info update_info_from_frame(const rs2::frame& f, const rs2::stream_profile& profile)
         {
             // Check if the new frame originated from stereo-based depth sensor
             // and retrieve the stereo baseline parameter that will be used in transformations
@@ -107,7 +130,7 @@ namespace librealsense
 
             if (info.stereoscopic_depth)
             {
-                auto vp = f.get_profile().as<rs2::video_stream_profile>();
+                auto vp = profile.as<rs2::video_stream_profile>();
                 auto focal_lenght_mm = vp.get_intrinsics().fx;
                 const uint8_t fractional_bits = 5;
                 const uint8_t fractions = 1 << fractional_bits;
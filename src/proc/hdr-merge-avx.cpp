@@ -0,0 +1,88 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "hdr-merge-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        static __m256i load(const uint16_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static __m256i load(const uint8_t* p) { return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+
+        // Pixels that are non-zero, and whose infrared value is within the range: those clamped to
+        // [under + 1, over - 1] are left unchanged
+        struct trusted
+        {
+            __m256i low, high;
+
+            trusted(hdr_ir_range range)
+                : low(_mm256_set1_epi16(int16_t(range.under_saturated + 1))),
+                  high(_mm256_set1_epi16(int16_t(range.over_saturated - 1))) {}
+
+            __m256i operator()(__m256i d, __m256i ir) const
+            {
+                const __m256i in_range = _mm256_cmpeq_epi16(_mm256_max_epu16(_mm256_min_epu16(ir, high), low), ir);
+                return _mm256_andnot_si256(_mm256_cmpeq_epi16(d, _mm256_setzero_si256()), in_range);
+            }
+        };
+
+        template<class IR>
+        static size_t merge_ir(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                               const IR* ir0, const IR* ir1, size_t count, hdr_ir_range range)
+        {
+            if (range.under_saturated + 1 > range.over_saturated - 1)
+                return 0;
+
+            const trusted is_trusted(range);
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m256i a = load(d0 + i), b = load(d1 + i);
+                const __m256i use_a = is_trusted(a, load(ir0 + i));
+                const __m256i use_b = _mm256_andnot_si256(use_a, is_trusted(b, load(ir1 + i)));
+                const __m256i merged = _mm256_or_si256(_mm256_and_si256(a, use_a), _mm256_and_si256(b, use_b));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), merged);
+            }
+            return i;
+        }
+
+        bool hdr_merge_built() { return true; }
+
+        size_t hdr_merge_depth(uint16_t* out, const uint16_t* d0, const uint16_t* d1, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                // Zero pixels of the first exposure take the pixel of the second, which may be zero too
+                const __m256i a = load(d0 + i), b = load(d1 + i);
+                const __m256i use_b = _mm256_cmpeq_epi16(a, _mm256_setzero_si256());
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_or_si256(a, _mm256_and_si256(b, use_b)));
+            }
+            return i;
+        }
+
+        size_t hdr_merge_ir(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                            const uint8_t* ir0, const uint8_t* ir1, size_t count, hdr_ir_range range)
+        {
+            return merge_ir(out, d0, d1, ir0, ir1, count, range);
+        }
+
+        size_t hdr_merge_ir(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                            const uint16_t* ir0, const uint16_t* ir1, size_t count, hdr_ir_range range)
+        {
+            return merge_ir(out, d0, d1, ir0, ir1, count, range);
+        }
+#else
+        bool hdr_merge_built() { return false; }
+        size_t hdr_merge_depth(uint16_t*, const uint16_t*, const uint16_t*, size_t) { return 0; }
+        size_t hdr_merge_ir(uint16_t*, const uint16_t*, const uint16_t*, const uint8_t*, const uint8_t*, size_t, hdr_ir_range) { return 0; }
+        size_t hdr_merge_ir(uint16_t*, const uint16_t*, const uint16_t*, const uint16_t*, const uint16_t*, size_t, hdr_ir_range) { return 0; }
+#endif
+    }
+}
@@ -0,0 +1,110 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "hdr-merge-simd.h"
+#include "simd-support.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define HDR_MERGE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+#ifdef HDR_MERGE_NEON
+    namespace neon
+    {
+        static uint16x8_t load(const uint16_t* p) { return vld1q_u16(p); }
+        static uint16x8_t load(const uint8_t* p) { return vmovl_u8(vld1_u8(p)); }
+
+        // Pixels that are non-zero, and whose infrared value is within the range
+        static uint16x8_t trusted(uint16x8_t d, uint16x8_t ir, uint16x8_t low, uint16x8_t high)
+        {
+            const uint16x8_t in_range = vandq_u16(vcgeq_u16(ir, low), vcleq_u16(ir, high));
+            return vandq_u16(vtstq_u16(d, d), in_range);
+        }
+
+        template<class IR>
+        static size_t merge_ir(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                               const IR* ir0, const IR* ir1, size_t count, hdr_ir_range range)
+        {
+            if (range.under_saturated + 1 > range.over_saturated - 1)
+                return 0;
+
+            const uint16x8_t low = vdupq_n_u16(uint16_t(range.under_saturated + 1));
+            const uint16x8_t high = vdupq_n_u16(uint16_t(range.over_saturated - 1));
+            const uint16x8_t zero = vdupq_n_u16(0);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const uint16x8_t a = load(d0 + i), b = load(d1 + i);
+                const uint16x8_t use_a = trusted(a, load(ir0 + i), low, high);
+                const uint16x8_t use_b = trusted(b, load(ir1 + i), low, high);
+                vst1q_u16(out + i, vbslq_u16(use_a, a, vbslq_u16(use_b, b, zero)));
+            }
+            return i;
+        }
+
+        static size_t merge_depth(uint16_t* out, const uint16_t* d0, const uint16_t* d1, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const uint16x8_t a = load(d0 + i), b = load(d1 + i);
+                vst1q_u16(out + i, vbslq_u16(vtstq_u16(a, a), a, b));
+            }
+            return i;
+        }
+    }
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::hdr_merge_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool hdr_merge_simd_supported()
+    {
+#ifdef HDR_MERGE_NEON
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t hdr_merge_depth_simd(uint16_t* out, const uint16_t* d0, const uint16_t* d1, size_t count)
+    {
+        if (use_avx2())
+            return avx2::hdr_merge_depth(out, d0, d1, count);
+#ifdef HDR_MERGE_NEON
+        return neon::merge_depth(out, d0, d1, count);
+#else
+        return 0;
+#endif
+    }
+
+    size_t hdr_merge_ir_simd(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                             const uint8_t* ir0, const uint8_t* ir1, size_t count, hdr_ir_range range)
+    {
+        if (use_avx2())
+            return avx2::hdr_merge_ir(out, d0, d1, ir0, ir1, count, range);
+#ifdef HDR_MERGE_NEON
+        return neon::merge_ir(out, d0, d1, ir0, ir1, count, range);
+#else
+        return 0;
+#endif
+    }
+
+    size_t hdr_merge_ir_simd(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                             const uint16_t* ir0, const uint16_t* ir1, size_t count, hdr_ir_range range)
+    {
+        if (use_avx2())
+            return avx2::hdr_merge_ir(out, d0, d1, ir0, ir1, count, range);
+#ifdef HDR_MERGE_NEON
+        return neon::merge_ir(out, d0, d1, ir0, ir1, count, range);
+#else
+        return 0;
+#endif
+    }
+}
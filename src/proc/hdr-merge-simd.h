@@ -0,0 +1,43 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized merging of the depth of the two exposures of an HDR sequence
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // The range of infrared values, exclusive of both ends, in which the depth of a pixel is trusted
+    struct hdr_ir_range
+    {
+        int under_saturated;
+        int over_saturated;
+    };
+
+    // Whether a SIMD implementation is available for the running CPU
+    bool hdr_merge_simd_supported();
+
+    // Merge the leading pixels of the depth of two exposures, as hdr_merge does in scalar code: each
+    // output pixel is the first non-zero depth pixel, in exposure order, whose infrared pixel is within
+    // the range (every pixel is, for the merge of depth only), or 0 when there is none.
+    // Return the number of pixels processed; the rest is left to the caller
+    size_t hdr_merge_depth_simd(uint16_t* out, const uint16_t* d0, const uint16_t* d1, size_t count);
+    size_t hdr_merge_ir_simd(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                             const uint8_t* ir0, const uint8_t* ir1, size_t count, hdr_ir_range range);
+    size_t hdr_merge_ir_simd(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                             const uint16_t* ir0, const uint16_t* ir1, size_t count, hdr_ir_range range);
+
+    namespace avx2
+    {
+        // Implemented in hdr-merge-avx.cpp. hdr_merge_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool hdr_merge_built();
+        size_t hdr_merge_depth(uint16_t* out, const uint16_t* d0, const uint16_t* d1, size_t count);
+        size_t hdr_merge_ir(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                            const uint8_t* ir0, const uint8_t* ir1, size_t count, hdr_ir_range range);
+        size_t hdr_merge_ir(uint16_t* out, const uint16_t* d0, const uint16_t* d1,
+                            const uint16_t* ir0, const uint16_t* ir1, size_t count, hdr_ir_range range);
+    }
+}
@@ -63,55 +63,44 @@ namespace librealsense
     {
         // steps:
         // 1. get depth frame from incoming frameset
-        // 2. add the frameset to vector of framesets
-        // 3. check if size of this vector is at least 2 (if not - return latest merge frame)
-        // 4. pop out both framesets from the vector
-        // 5. apply merge algo
-        // 6. save merge frame as latest merge frame
-        // 7. return the merge frame
+        // 2. keep the frameset of the first exposure of the sequence, until the second one arrives
+        // 3. as soon as the second one arrives, apply merge algo to both
+        // 4. save merge frame as latest merge frame
+        // 5. return the merge frame
 
         // 1. get depth frame from incoming frameset
         auto fs = f.as<rs2::frameset>();
         auto depth_frame = fs.get_depth_frame();
-
-        // 2. add the frameset to vector of framesets
         auto depth_seq_id = depth_frame.get_frame_metadata(RS2_FRAME_METADATA_SEQUENCE_ID);
 
-        // condition added to ensure that frames are saved in the right order
-        // to prevent for example the saving of frame with sequence id 1 before
-        // saving frame of sequence id 0
-        // so that the merging with be deterministic - always done with frame n and n+1
-        // with frame n as basis
-        if (_framesets.size() == depth_seq_id)
-        {
-            _framesets[depth_seq_id] = fs;
-        }
-
         // discard merged frame if not relevant
         discard_depth_merged_frame_if_needed(f);
 
-        // 3. check if size of this vector is at least 2 (if not - return latest merge frame)
-        if (_framesets.size() >= 2)
+        // 2. merging is always done with frames n and n+1, with frame n as basis: a later first
+        // exposure replaces the one kept, and a second exposure without a first one is ignored
+        if (depth_seq_id == 0)
         {
-            // 4. pop out both framesets from the vector
-            rs2::frameset fs_0 = _framesets[0];
-            rs2::frameset fs_1 = _framesets[1];
-            _framesets.clear();
+            _first_exposure = fs;
+        }
+        else if (depth_seq_id == 1 && _first_exposure)
+        {
+            rs2::frameset first_fs = _first_exposure;
+            _first_exposure = rs2::frameset();
 
             bool use_ir = false;
-            if (check_frames_mergeability(fs_0, fs_1, use_ir))
+            if (check_frames_mergeability(first_fs, fs, use_ir))
             {
-                // 5. apply merge algo
-                rs2::frame new_frame = merging_algorithm(source, fs_0, fs_1, use_ir);
+                // 3. apply merge algo
+                rs2::frame new_frame = merging_algorithm(source, first_fs, fs, use_ir);
                 if (new_frame)
                 {
-                    // 6. save merge frame as latest merge frame
+                    // 4. save merge frame as latest merge frame
                     _depth_merged_frame = new_frame;
                 }
             }
         }
 
-        // 7. return the merge frame
+        // 5. return the merge frame
         if (_depth_merged_frame)
             return _depth_merged_frame;
 
@@ -196,8 +185,7 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-
+            // Every pixel is written by the merge
             int width_height_product = width * height;
 
             if (use_ir)
@@ -227,7 +215,9 @@ namespace librealsense
 
     void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const
     {
-        for (int i = 0; i < width_height_prod; i++)
+        int i = static_cast<int>(hdr_merge_depth_simd(new_data, d0, d1, width_height_prod));
+
+        for (; i < width_height_prod; i++)
         {
             if (d0[i])
                 new_data[i] = d0[i];
@@ -6,6 +6,7 @@ Copyright(c) 2020 Intel Corporation. All Rights Reserved. */
 
 #include "synthetic-stream.h"
 #include "option.h"
+#include "hdr-merge-simd.h"
 
 namespace librealsense
 {
@@ -46,7 +47,7 @@ namespace librealsense
 
         unsigned long long _previous_depth_frame_counter;
         int _frames_without_requested_metadata_counter;
-        std::map<int, rs2::frameset> _framesets;
+        rs2::frameset _first_exposure; // Waiting for the second exposure of its sequence
         rs2::frame _depth_merged_frame;
     };
     MAP_EXTENSION(RS2_EXTENSION_HDR_MERGE, librealsense::hdr_merge);
@@ -60,7 +61,12 @@ namespace librealsense
 
         auto format = first_ir.get_profile().format();
 
-        for (int i = 0; i < width_height_prod; i++)
+        hdr_ir_range range = format == RS2_FORMAT_Y8 ?
+            hdr_ir_range{ IR_UNDER_SATURATED_VALUE_Y8, IR_OVER_SATURATED_VALUE_Y8 } :
+            hdr_ir_range{ IR_UNDER_SATURATED_VALUE_Y16, IR_OVER_SATURATED_VALUE_Y16 };
+        int i = static_cast<int>(hdr_merge_ir_simd(new_data, d0, d1, i0, i1, width_height_prod, range));
+
+        for (; i < width_height_prod; i++)
         {
             if (is_infrared_valid<T>(i0[i], format) && d0[i])
                 new_data[i] = d0[i];
@@ -0,0 +1,99 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "hole-filling-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        static __m256i load(const uint16_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static void store(uint16_t* p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+        // Pixel i takes pixel i - K, across the 128-bit lanes; the first K pixels take zero
+        template<int K>
+        static __m256i shift_in(__m256i v)
+        {
+            return _mm256_alignr_epi8(v, _mm256_permute2x128_si256(v, v, 0x08), 16 - 2 * K);
+        }
+
+        // Holes take the pixel K to their left, when it is not a hole itself
+        template<int K>
+        static __m256i propagate(__m256i v)
+        {
+            const __m256i holes = _mm256_cmpeq_epi16(v, _mm256_setzero_si256());
+            return _mm256_or_si256(v, _mm256_and_si256(holes, shift_in<K>(v)));
+        }
+
+        bool hole_filling_built() { return true; }
+
+        size_t hole_fill_left(uint16_t* row, size_t width)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            size_t i = 1;
+            for (; i + 16 <= width; i += 16)
+            {
+                __m256i v = load(row + i);
+                const __m256i holes = _mm256_cmpeq_epi16(v, zero);
+                if (_mm256_testz_si256(holes, holes))
+                    continue;
+
+                // Each pixel takes the last non-hole of the block up to it, then the holes
+                // left at the start of the block take the pixel before the block
+                v = propagate<8>(propagate<4>(propagate<2>(propagate<1>(v))));
+                const __m256i left = _mm256_set1_epi16(int16_t(row[i - 1]));
+                store(row + i, _mm256_or_si256(v, _mm256_and_si256(_mm256_cmpeq_epi16(v, zero), left)));
+            }
+            return i;
+        }
+
+        size_t hole_fill_around(uint16_t* row, const uint16_t* above, const uint16_t* below, size_t width, bool farest)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            uint16_t around[16];
+            size_t i = 1;
+            for (; i + 16 <= width; i += 16)
+            {
+                const __m256i holes = _mm256_cmpeq_epi16(load(row + i), zero);
+                if (_mm256_testz_si256(holes, holes))
+                    continue;
+
+                // The pixels above and below, which do not depend on the pixels of the row
+                const __m256i a = load(above + i), al = load(above + i - 1);
+                const __m256i b = load(below + i), bl = load(below + i - 1);
+                if (farest)
+                    store(around, _mm256_max_epu16(_mm256_max_epu16(a, al), _mm256_max_epu16(bl, b)));
+                else
+                {
+                    // Holes other than the one above do not count: they are made the largest value
+                    auto non_hole = [&](__m256i v) { return _mm256_or_si256(v, _mm256_cmpeq_epi16(v, zero)); };
+                    store(around, _mm256_min_epu16(_mm256_min_epu16(a, non_hole(al)), _mm256_min_epu16(non_hole(bl), non_hole(b))));
+                }
+
+                // The pixel on the left is only known once it is filled
+                for (size_t k = 0; k < 16; ++k)
+                {
+                    uint16_t& p = row[i + k];
+                    if (p)
+                        continue;
+                    const uint16_t left = row[i + k - 1];
+                    if (farest)
+                        p = left > around[k] ? left : around[k];
+                    else
+                        p = left && left < around[k] ? left : around[k];
+                }
+            }
+            return i;
+        }
+#else
+        bool hole_filling_built() { return false; }
+        size_t hole_fill_left(uint16_t*, size_t) { return 1; }
+        size_t hole_fill_around(uint16_t*, const uint16_t*, const uint16_t*, size_t, bool) { return 1; }
+#endif
+    }
+}
@@ -3,6 +3,8 @@
 // Enhancing the input video frame by filling missing data.
 #pragma once
 
+#include "hole-filling-simd.h"
+
 namespace librealsense
 {
     enum holes_filling_types : uint8_t
@@ -27,7 +29,6 @@ namespace librealsense
         template<typename T>
         void apply_hole_filling(void * image_data)
         {
-            bool fp = (std::is_floating_point<T>::value);
             T* data = reinterpret_cast<T*>(image_data);
 
             // Select and apply the appropriate hole filling method
@@ -37,10 +38,10 @@ namespace librealsense
                 holes_fill_left(data, _width, _height, _stride);
                 break;
             case hf_farest_from_around:
-                holes_fill_farest(data, _width, _height, _stride);
+                holes_fill_around<T, hf_farest_from_around>(data, _width, _height, _stride);
                 break;
             case hf_nearest_from_around:
-                holes_fill_nearest(data, _width, _height, _stride);
+                holes_fill_around<T, hf_nearest_from_around>(data, _width, _height, _stride);
                 break;
             default:
                 throw invalid_value_exception(to_string()
@@ -48,112 +49,54 @@ namespace librealsense
             }
         }
 
-        // Implementations of the hole-filling methods
+        // Implementations of the hole-filling methods, specialized on the pixel type and mode.
+        // Depth rows go through the SIMD kernels first, which leave the end of the row to the scalar code
         template<typename T>
         inline void holes_fill_left(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
-            T* p = image_data;
-
-            for (int j = 0; j < height; ++j)
+            // Rows are independent
+            parallel_for(height, 1, [&](size_t first, size_t last)
             {
-                ++p;
-                for (int i = 1; i < width; ++i)
+                for (size_t j = first; j < last; ++j)
                 {
-                    if (empty(p))
-                        *p = *(p - 1);
-                    ++p;
+                    T* row = image_data + j * width;
+                    for (size_t i = hole_fill_left_simd(row, width); i < width; ++i)
+                    {
+                        if (is_hole(row[i]))
+                            row[i] = row[i - 1];
+                    }
                 }
-            }
+            });
         }
 
-        template<typename T>
-        inline void holes_fill_farest(T* image_data, size_t width, size_t height, size_t stride)
+        template<typename T, holes_filling_types MODE>
+        inline void holes_fill_around(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
-            T tmp = 0;
-            T * p = image_data + width;
-            T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            // Holes are filled from the row above once filled, so rows are processed in order
+            for (size_t j = 1; j + 1 < height; ++j)
             {
-                ++p;
-                for (int i = 1; i < width; ++i)
+                T* row = image_data + j * width;
+                const T* above = row - width;
+                const T* below = row + width;
+                for (size_t i = hole_fill_around_simd(row, above, below, width, MODE == hf_farest_from_around); i < width; ++i)
                 {
-                    if (empty(p))
-                    {
-                        tmp = *(p - width);
-
-                        q = p - width - 1;
-                        if (*q > tmp)
-                            tmp = *q;
-
-                        q = p - 1;
-                        if (*q > tmp)
-                            tmp = *q;
-
-                        q = p + width - 1;
-                        if (*q > tmp)
-                            tmp = *q;
-
-                        q = p + width;
-                        if (*q > tmp)
-                            tmp = *q;
-
-                        *p = tmp;
-                    }
-
-                    p++;
+                    if (is_hole(row[i]))
+                        row[i] = fill_from_around<T, MODE>(row, above, below, i);
                 }
             }
         }
 
-        template<typename T>
-        inline void holes_fill_nearest(T* image_data, size_t width, size_t height, size_t stride)
+        // The farest of the pixels around, or the nearest of the non-hole ones when the pixel above is not a hole
+        template<typename T, holes_filling_types MODE>
+        static T fill_from_around(const T* row, const T* above, const T* below, size_t i)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
-            T tmp = 0;
-            T * p = image_data + width;
-            T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            T tmp = above[i];
+            for (T v : { above[i - 1], row[i - 1], below[i - 1], below[i] })
             {
-                ++p;
-                for (int i = 1; i < width; ++i)
-                {
-                    if (empty(p))
-                    {
-                        tmp = *(p - width);
-
-                        q = p - width - 1;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
-
-                        q = p - 1;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
-
-                        q = p + width - 1;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
-
-                        q = p + width;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
-
-                        *p = tmp;
-                    }
-
-                    p++;
-                }
+                if (MODE == hf_farest_from_around ? v > tmp : !is_hole(v) && v < tmp)
+                    tmp = v;
             }
+            return tmp;
         }
 
     private:
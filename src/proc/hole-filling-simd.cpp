@@ -0,0 +1,121 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "hole-filling-simd.h"
+#include "simd-support.h"
+
+// The horizontal reductions used to skip blocks without holes are AArch64 only
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define HOLE_FILLING_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+#ifdef HOLE_FILLING_NEON
+    namespace neon
+    {
+        // Holes take the pixel K to their left, when it is not a hole itself
+        template<int K>
+        static uint16x8_t propagate(uint16x8_t v)
+        {
+            const uint16x8_t holes = vceqq_u16(v, vdupq_n_u16(0));
+            return vorrq_u16(v, vandq_u16(holes, vextq_u16(vdupq_n_u16(0), v, 8 - K)));
+        }
+
+        static size_t fill_left(uint16_t* row, size_t width)
+        {
+            const uint16x8_t zero = vdupq_n_u16(0);
+            size_t i = 1;
+            for (; i + 8 <= width; i += 8)
+            {
+                uint16x8_t v = vld1q_u16(row + i);
+                if (!vmaxvq_u16(vceqq_u16(v, zero)))
+                    continue;
+
+                // Each pixel takes the last non-hole of the block up to it, then the holes
+                // left at the start of the block take the pixel before the block
+                v = propagate<4>(propagate<2>(propagate<1>(v)));
+                const uint16x8_t left = vdupq_n_u16(row[i - 1]);
+                vst1q_u16(row + i, vbslq_u16(vceqq_u16(v, zero), left, v));
+            }
+            return i;
+        }
+
+        static size_t fill_around(uint16_t* row, const uint16_t* above, const uint16_t* below, size_t width, bool farest)
+        {
+            const uint16x8_t zero = vdupq_n_u16(0);
+            uint16_t around[8];
+            size_t i = 1;
+            for (; i + 8 <= width; i += 8)
+            {
+                if (!vmaxvq_u16(vceqq_u16(vld1q_u16(row + i), zero)))
+                    continue;
+
+                // The pixels above and below, which do not depend on the pixels of the row
+                const uint16x8_t a = vld1q_u16(above + i), al = vld1q_u16(above + i - 1);
+                const uint16x8_t b = vld1q_u16(below + i), bl = vld1q_u16(below + i - 1);
+                if (farest)
+                    vst1q_u16(around, vmaxq_u16(vmaxq_u16(a, al), vmaxq_u16(bl, b)));
+                else
+                {
+                    // Holes other than the one above do not count: they are made the largest value
+                    auto non_hole = [&](uint16x8_t v) { return vorrq_u16(v, vceqq_u16(v, zero)); };
+                    vst1q_u16(around, vminq_u16(vminq_u16(a, non_hole(al)), vminq_u16(non_hole(bl), non_hole(b))));
+                }
+
+                // The pixel on the left is only known once it is filled
+                for (size_t k = 0; k < 8; ++k)
+                {
+                    uint16_t& p = row[i + k];
+                    if (p)
+                        continue;
+                    const uint16_t left = row[i + k - 1];
+                    if (farest)
+                        p = left > around[k] ? left : around[k];
+                    else
+                        p = left && left < around[k] ? left : around[k];
+                }
+            }
+            return i;
+        }
+    }
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::hole_filling_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool hole_filling_simd_supported()
+    {
+#ifdef HOLE_FILLING_NEON
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t hole_fill_left_simd(uint16_t* row, size_t width)
+    {
+        if (use_avx2())
+            return avx2::hole_fill_left(row, width);
+#ifdef HOLE_FILLING_NEON
+        return neon::fill_left(row, width);
+#else
+        return 1;
+#endif
+    }
+
+    size_t hole_fill_around_simd(uint16_t* row, const uint16_t* above, const uint16_t* below, size_t width, bool farest)
+    {
+        if (use_avx2())
+            return avx2::hole_fill_around(row, above, below, width, farest);
+#ifdef HOLE_FILLING_NEON
+        return neon::fill_around(row, above, below, width, farest);
+#else
+        return 1;
+#endif
+    }
+}
@@ -0,0 +1,46 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized hole filling of depth rows, for the hole-filling filter
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace librealsense
+{
+    // Holes are zero pixels; for floating point pixels, those whose bits are all zero
+    inline bool is_hole(uint16_t v) { return !v; }
+    inline bool is_hole(float v)
+    {
+        uint32_t bits;
+        memcpy(&bits, &v, sizeof(bits));
+        return !bits;
+    }
+
+    // Whether a SIMD implementation is available for the running CPU
+    bool hole_filling_simd_supported();
+
+    // Fill the holes of the leading pixels of a row, from its second pixel on, as the hole-filling filter
+    // does in scalar code:
+    //  - from the left: each hole takes the value of the pixel on its left, once filled
+    //  - from around: each hole takes the farest (largest) or the nearest (smallest non-zero) value of the
+    //    pixels above and below it, to their left and on its left, once filled; the nearest is only
+    //    taken when the pixel above is not a hole
+    // Return the index of the first pixel left to the caller, which is 1 when nothing was processed.
+    // Disparity rows are all left to the caller
+    size_t hole_fill_left_simd(uint16_t* row, size_t width);
+    size_t hole_fill_around_simd(uint16_t* row, const uint16_t* above, const uint16_t* below, size_t width, bool farest);
+    inline size_t hole_fill_left_simd(float*, size_t) { return 1; }
+    inline size_t hole_fill_around_simd(float*, const float*, const float*, size_t, bool) { return 1; }
+
+    namespace avx2
+    {
+        // Implemented in hole-filling-avx.cpp. hole_filling_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool hole_filling_built();
+        size_t hole_fill_left(uint16_t* row, size_t width);
+        size_t hole_fill_around(uint16_t* row, const uint16_t* above, const uint16_t* below, size_t width, bool farest);
+    }
+}
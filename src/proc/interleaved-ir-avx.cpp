@@ -0,0 +1,90 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "interleaved-ir-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        static __m256i load(const uint8_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static void store(void* p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+        // Two 16-byte loads, into the low and the high 128-bit lanes
+        static __m256i load2(const uint8_t* low, const uint8_t* high)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(low))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(high)), 1);
+        }
+
+        // 10-bit data in 16 bits, as the scalar conversion does
+        static __m256i scale_10_to_16(__m256i v)
+        {
+            return _mm256_or_si256(_mm256_slli_epi16(v, 6), _mm256_srli_epi16(v, 4));
+        }
+
+        bool interleaved_ir_built() { return true; }
+
+        size_t unpack_y8i(uint8_t* left, uint8_t* right, const uint8_t* source, size_t count)
+        {
+            // Left bytes, then right bytes, of each 128-bit lane
+            const __m256i split = _mm256_setr_epi8(
+                0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+            size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                // Left, then right, 16 pixels of each load
+                const __m256i a = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(load(source + i * 2), split), 0xd8);
+                const __m256i b = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(load(source + i * 2 + 32), split), 0xd8);
+                store(left + i, _mm256_permute2x128_si256(a, b, 0x20));
+                store(right + i, _mm256_permute2x128_si256(a, b, 0x31));
+            }
+            return i;
+        }
+
+        size_t unpack_y12i(uint16_t* left, uint16_t* right, const uint8_t* source, size_t count)
+        {
+            // Each lane takes 8 pixels, from two loads 8 bytes apart: the first has the first 4
+            // pixels in its first 12 bytes, the second the last 4 in its last 12 bytes
+            const __m256i right_first = _mm256_setr_epi8(
+                0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1,
+                0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m256i right_last = _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14,
+                -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14);
+            const __m256i left_first = _mm256_setr_epi8(
+                1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1,
+                1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m256i left_last = _mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15,
+                -1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15);
+            const __m256i low_12 = _mm256_set1_epi16(0x0fff);
+
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const uint8_t* p = source + i * 3;
+                const __m256i first = load2(p, p + 24);
+                const __m256i last = load2(p + 8, p + 32);
+
+                const __m256i r = _mm256_or_si256(_mm256_shuffle_epi8(first, right_first), _mm256_shuffle_epi8(last, right_last));
+                const __m256i l = _mm256_or_si256(_mm256_shuffle_epi8(first, left_first), _mm256_shuffle_epi8(last, left_last));
+                store(left + i, scale_10_to_16(_mm256_srli_epi16(l, 4)));
+                store(right + i, scale_10_to_16(_mm256_and_si256(r, low_12)));
+            }
+            return i;
+        }
+#else
+        bool interleaved_ir_built() { return false; }
+        size_t unpack_y8i(uint8_t*, uint8_t*, const uint8_t*, size_t) { return 0; }
+        size_t unpack_y12i(uint16_t*, uint16_t*, const uint8_t*, size_t) { return 0; }
+#endif
+    }
+}
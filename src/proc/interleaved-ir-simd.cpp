@@ -0,0 +1,156 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "interleaved-ir-simd.h"
+#include "simd-support.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define INTERLEAVED_IR_NEON
+#include <arm_neon.h>
+#elif defined(__SSSE3__)
+#define INTERLEAVED_IR_SSSE3
+#include <tmmintrin.h>
+#endif
+
+namespace librealsense
+{
+#ifdef INTERLEAVED_IR_NEON
+    namespace neon
+    {
+        // 10-bit data in 16 bits, as the scalar conversion does
+        static uint16x8_t scale_10_to_16(uint16x8_t v)
+        {
+            return vorrq_u16(vshlq_n_u16(v, 6), vshrq_n_u16(v, 4));
+        }
+
+        static size_t unpack_y8i(uint8_t* left, uint8_t* right, const uint8_t* source, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const uint8x16x2_t p = vld2q_u8(source + i * 2);
+                vst1q_u8(left + i, p.val[0]);
+                vst1q_u8(right + i, p.val[1]);
+            }
+            return i;
+        }
+
+        static size_t unpack_y12i(uint16_t* left, uint16_t* right, const uint8_t* source, size_t count)
+        {
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                // The 3 bytes of each pixel apart: right low 8 bits, right high 4 bits and left low 4 bits, left high 8 bits
+                const uint8x16x3_t p = vld3q_u8(source + i * 3);
+                const uint8x16_t right_high = vandq_u8(p.val[1], vdupq_n_u8(0x0f));
+                const uint8x16_t left_low = vshrq_n_u8(p.val[1], 4);
+
+                const uint16x8_t r0 = vorrq_u16(vmovl_u8(vget_low_u8(p.val[0])), vshll_n_u8(vget_low_u8(right_high), 8));
+                const uint16x8_t r1 = vorrq_u16(vmovl_u8(vget_high_u8(p.val[0])), vshll_n_u8(vget_high_u8(right_high), 8));
+                const uint16x8_t l0 = vorrq_u16(vmovl_u8(vget_low_u8(left_low)), vshll_n_u8(vget_low_u8(p.val[2]), 4));
+                const uint16x8_t l1 = vorrq_u16(vmovl_u8(vget_high_u8(left_low)), vshll_n_u8(vget_high_u8(p.val[2]), 4));
+                vst1q_u16(left + i, scale_10_to_16(l0));
+                vst1q_u16(left + i + 8, scale_10_to_16(l1));
+                vst1q_u16(right + i, scale_10_to_16(r0));
+                vst1q_u16(right + i + 8, scale_10_to_16(r1));
+            }
+            return i;
+        }
+    }
+#endif
+
+#ifdef INTERLEAVED_IR_SSSE3
+    namespace ssse3
+    {
+        static __m128i load(const uint8_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        static void store(void* p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+        // 10-bit data in 16 bits, as the scalar conversion does
+        static __m128i scale_10_to_16(__m128i v)
+        {
+            return _mm_or_si128(_mm_slli_epi16(v, 6), _mm_srli_epi16(v, 4));
+        }
+
+        static size_t unpack_y8i(uint8_t* left, uint8_t* right, const uint8_t* source, size_t count)
+        {
+            // Left bytes, then right bytes
+            const __m128i split = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+            size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i a = _mm_shuffle_epi8(load(source + i * 2), split);
+                const __m128i b = _mm_shuffle_epi8(load(source + i * 2 + 16), split);
+                store(left + i, _mm_unpacklo_epi64(a, b));
+                store(right + i, _mm_unpackhi_epi64(a, b));
+            }
+            return i;
+        }
+
+        static size_t unpack_y12i(uint16_t* left, uint16_t* right, const uint8_t* source, size_t count)
+        {
+            // 8 pixels from two loads 8 bytes apart: the first has the first 4 pixels in its
+            // first 12 bytes, the second the last 4 in its last 12 bytes
+            const __m128i right_first = _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m128i right_last = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 7, 8, 10, 11, 13, 14);
+            const __m128i left_first = _mm_setr_epi8(1, 2, 4, 5, 7, 8, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1);
+            const __m128i left_last = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 5, 6, 8, 9, 11, 12, 14, 15);
+            const __m128i low_12 = _mm_set1_epi16(0x0fff);
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i first = load(source + i * 3);
+                const __m128i last = load(source + i * 3 + 8);
+
+                const __m128i r = _mm_or_si128(_mm_shuffle_epi8(first, right_first), _mm_shuffle_epi8(last, right_last));
+                const __m128i l = _mm_or_si128(_mm_shuffle_epi8(first, left_first), _mm_shuffle_epi8(last, left_last));
+                store(left + i, scale_10_to_16(_mm_srli_epi16(l, 4)));
+                store(right + i, scale_10_to_16(_mm_and_si128(r, low_12)));
+            }
+            return i;
+        }
+    }
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::interleaved_ir_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool interleaved_ir_simd_supported()
+    {
+#if defined(INTERLEAVED_IR_NEON) || defined(INTERLEAVED_IR_SSSE3)
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t unpack_y8i_simd(uint8_t* left, uint8_t* right, const uint8_t* source, size_t count)
+    {
+        if (use_avx2())
+            return avx2::unpack_y8i(left, right, source, count);
+#if defined(INTERLEAVED_IR_NEON)
+        return neon::unpack_y8i(left, right, source, count);
+#elif defined(INTERLEAVED_IR_SSSE3)
+        return ssse3::unpack_y8i(left, right, source, count);
+#else
+        return 0;
+#endif
+    }
+
+    size_t unpack_y12i_simd(uint16_t* left, uint16_t* right, const uint8_t* source, size_t count)
+    {
+        if (use_avx2())
+            return avx2::unpack_y12i(left, right, source, count);
+#if defined(INTERLEAVED_IR_NEON)
+        return neon::unpack_y12i(left, right, source, count);
+#elif defined(INTERLEAVED_IR_SSSE3)
+        return ssse3::unpack_y12i(left, right, source, count);
+#else
+        return 0;
+#endif
+    }
+}
@@ -0,0 +1,32 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized de-interleaving of left/right infrared, for the Y8I and Y12I converters
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Whether a SIMD implementation is available for the running CPU
+    bool interleaved_ir_simd_supported();
+
+    // Split 'count' Y8I pixels, a left byte and a right byte each, into the left and right Y8 images
+    // Return the number of leading pixels done, the rest being left to the caller
+    size_t unpack_y8i_simd(uint8_t* left, uint8_t* right, const uint8_t* source, size_t count);
+
+    // Split 'count' Y12I pixels, two 12-bit values packed in 3 bytes each (right in the low bits), into
+    // the left and right Y16 images, scaled as unpack_y16_y16_from_y12i_10 does: (v << 6 | v >> 4) in 16 bits
+    // Return the number of leading pixels done, the rest being left to the caller
+    size_t unpack_y12i_simd(uint16_t* left, uint16_t* right, const uint8_t* source, size_t count);
+
+    namespace avx2
+    {
+        // Implemented in interleaved-ir-avx.cpp. interleaved_ir_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool interleaved_ir_built();
+        size_t unpack_y8i(uint8_t* left, uint8_t* right, const uint8_t* source, size_t count);
+        size_t unpack_y12i(uint16_t* left, uint16_t* right, const uint8_t* source, size_t count);
+    }
+}
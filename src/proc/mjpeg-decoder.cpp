@@ -0,0 +1,181 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "mjpeg-decoder.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef RS2_USE_TURBOJPEG
+
+#include <turbojpeg.h>
+
+namespace librealsense
+{
+    struct mjpeg_decoder::impl
+    {
+        tjhandle handle;
+
+        impl() : handle(tjInitDecompress()) {}
+        ~impl() { if (handle) tjDestroy(handle); }
+
+        bool decode(const unsigned char* source, int size, unsigned char* dest, int dest_size)
+        {
+            int width, height, subsampling, colorspace;
+            if (!handle || tjDecompressHeader3(handle, source, size, &width, &height, &subsampling, &colorspace) != 0)
+                return false;
+            if (width * height * tjPixelSize[TJPF_RGB] > dest_size)
+                return false;
+            // Straight into the frame, with no intermediate buffer
+            return tjDecompress2(handle, source, size, dest, width, 0, height, TJPF_RGB, 0) == 0;
+        }
+    };
+}
+
+#else
+
+namespace librealsense
+{
+    namespace
+    {
+        // Memory that stb_image allocates while decoding, kept by the decoder for the next frames.
+        // The frames of a stream are all of the same size, so that after the first one the
+        // allocations of a decode are all found in the cache
+        class decode_scratch
+        {
+        public:
+            ~decode_scratch()
+            {
+                for (auto&& block : _free)
+                    std::free(block);
+            }
+
+            void* allocate(size_t size)
+            {
+                // The smallest cached block that fits, unless it wastes more than it holds
+                auto best = _free.end();
+                for (auto it = _free.begin(); it != _free.end(); ++it)
+                {
+                    auto block_size = (*it)->size;
+                    if (block_size >= size && block_size <= 2 * size && (best == _free.end() || block_size < (*best)->size))
+                        best = it;
+                }
+                if (best != _free.end())
+                {
+                    auto block = *best;
+                    _free.erase(best);
+                    return block + 1;
+                }
+                return new_block(size);
+            }
+
+            void release(void* p)
+            {
+                if (_free.size() == max_cached_blocks)
+                {
+                    std::free(_free.front());
+                    _free.erase(_free.begin());
+                }
+                _free.push_back(header(p));
+            }
+
+            struct alignas(16) block_header
+            {
+                size_t size;
+            };
+
+            static block_header* header(void* p) { return static_cast<block_header*>(p) - 1; }
+
+            static void* new_block(size_t size)
+            {
+                auto block = static_cast<block_header*>(std::malloc(sizeof(block_header) + size));
+                if (!block)
+                    return nullptr;
+                block->size = size;
+                return block + 1;
+            }
+
+        private:
+            static const size_t max_cached_blocks = 16;
+            std::vector<block_header*> _free;
+        };
+
+        // The scratch memory of the decoder running on this thread, if any. Blocks allocated with it
+        // may be freed without it, and the other way around: they are all allocated with malloc
+        thread_local decode_scratch* current_scratch = nullptr;
+
+        void* scratch_malloc(size_t size)
+        {
+            return current_scratch ? current_scratch->allocate(size) : decode_scratch::new_block(size);
+        }
+
+        void scratch_free(void* p)
+        {
+            if (!p)
+                return;
+            if (current_scratch)
+                current_scratch->release(p);
+            else
+                std::free(decode_scratch::header(p));
+        }
+
+        void* scratch_realloc(void* p, size_t size)
+        {
+            if (!p)
+                return scratch_malloc(size);
+            auto old_size = decode_scratch::header(p)->size;
+            if (size <= old_size)
+                return p;
+            auto larger = scratch_malloc(size);
+            if (larger)
+            {
+                std::memcpy(larger, p, old_size);
+                scratch_free(p);
+            }
+            return larger;
+        }
+    }
+}
+
+#define STBI_MALLOC(size) librealsense::scratch_malloc(size)
+#define STBI_REALLOC(p, size) librealsense::scratch_realloc(p, size)
+#define STBI_FREE(p) librealsense::scratch_free(p)
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "../third-party/stb_image.h"
+
+namespace librealsense
+{
+    struct mjpeg_decoder::impl
+    {
+        decode_scratch scratch;
+
+        bool decode(const unsigned char* source, int size, unsigned char* dest, int dest_size)
+        {
+            current_scratch = &scratch;
+            int width, height, bpp;
+            auto uncompressed_rgb = stbi_load_from_memory(source, size, &width, &height, &bpp, 3);
+            bool decoded = uncompressed_rgb && width * height * 3 <= dest_size;
+            if (decoded)
+                std::memcpy(dest, uncompressed_rgb, width * height * 3);
+            stbi_image_free(uncompressed_rgb);
+            current_scratch = nullptr;
+            return decoded;
+        }
+    };
+}
+
+#endif
+
+namespace librealsense
+{
+    mjpeg_decoder::mjpeg_decoder() : _impl(new impl()) {}
+
+    mjpeg_decoder::~mjpeg_decoder() = default;
+
+    bool mjpeg_decoder::decode(const unsigned char* source, int size, unsigned char* dest, int dest_size)
+    {
+        return _impl->decode(source, size, dest, dest_size);
+    }
+}
@@ -0,0 +1,27 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <memory>
+
+namespace librealsense
+{
+    // Decodes MJPEG frames into RGB8, with libjpeg-turbo when the library is built with
+    // BUILD_WITH_LIBJPEG_TURBO and with stb_image otherwise. A decoder keeps its state and
+    // scratch memory from one frame to the next, and is used by one thread at a time.
+    class mjpeg_decoder
+    {
+    public:
+        mjpeg_decoder();
+        ~mjpeg_decoder();
+
+        // Decode 'size' bytes of JPEG data into dest, which holds dest_size bytes. Return false,
+        // leaving dest as is, when the data cannot be decoded or the image does not fit
+        bool decode(const unsigned char* source, int size, unsigned char* dest, int dest_size);
+
+    private:
+        struct impl;
+        std::unique_ptr<impl> _impl;
+    };
+}
@@ -0,0 +1,250 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "multi-device-syncer.h"
+#include "global_timestamp_reader.h"
+#include "option.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace librealsense
+{
+    // A stream that has not sent a frame for this long is left out of the sets
+    const double INACTIVE_STREAM_MS = 1000.;
+    // Number of sets the drift of the offsets to the reference device is estimated over
+    const size_t OFFSET_DRIFT_WINDOW = 300;
+    // Weight of the last offset in the smoothed one
+    const double OFFSET_SMOOTHING = 0.1;
+
+    multi_device_syncer::multi_device_syncer()
+        : processing_block("Multi-Device Syncer"), _tolerance(8.f), _queue_size(4), _latest_time(0)
+    {
+        register_option(RS2_OPTION_SYNC_TOLERANCE, std::make_shared<ptr_option<float>>(0.f, 100.f, 0.5f, 8.f, &_tolerance,
+            "Max difference in milliseconds between the host-clock timestamps of the frames of a set"));
+        register_option(RS2_OPTION_SYNC_QUEUE_SIZE, std::make_shared<ptr_option<int>>(1, 32, 1, 4, &_queue_size,
+            "Max number of frames buffered per stream while waiting for the other streams"));
+
+        auto f = [&](frame_holder frame, synthetic_source_interface* source)
+        {
+            std::vector<frame_holder> sets;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                add_frame(std::move(frame));
+                match(sets);
+            }
+
+            for (auto&& set : sets)
+                get_source().frame_ready(std::move(set));
+        };
+
+        set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(
+            new internal_frame_processor_callback<decltype(f)>(f)));
+    }
+
+    std::shared_ptr<multi_device_syncer::device_clock> multi_device_syncer::get_device_clock(frame_interface* f)
+    {
+        device_interface* dev = nullptr;
+        if (auto sensor = f->get_sensor())
+            dev = &sensor->get_device();
+
+        auto it = _devices.find(dev);
+        if (it != _devices.end())
+            return it->second;
+
+        auto clock = std::make_shared<device_clock>();
+        if (dev)
+        {
+            if (dev->supports_info(RS2_CAMERA_INFO_SERIAL_NUMBER))
+                clock->serial_number = dev->get_info(RS2_CAMERA_INFO_SERIAL_NUMBER);
+            if (auto global_time = As<global_time_interface>(dev))
+                clock->keeper = global_time->get_time_diff_keeper();
+        }
+        _devices[dev] = clock;
+        _device_order.push_back(clock);
+        return clock;
+    }
+
+    double multi_device_syncer::to_host_time(frame_interface* f, device_clock& clock) const
+    {
+        auto timestamp = f->get_frame_timestamp();
+        clock.on_host_clock = true;
+        switch (f->get_frame_timestamp_domain())
+        {
+        case RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME:
+        case RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME:
+            return timestamp;
+        case RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK:
+            if (auto keeper = clock.keeper.lock())
+            {
+                bool is_ready = false;
+                auto host_time = keeper->map_system_hw_time(timestamp, is_ready);
+                if (is_ready)
+                    return host_time;
+            }
+            break;
+        default:
+            break;
+        }
+        clock.on_host_clock = false;
+        return f->get_frame_system_time();
+    }
+
+    void multi_device_syncer::add_frame(frame_holder f)
+    {
+        if (auto composite = dynamic_cast<composite_frame*>(f.frame))
+        {
+            for (size_t i = 0; i < composite->get_embedded_frames_count(); i++)
+            {
+                auto embedded = composite->get_frame(static_cast<int>(i));
+                embedded->acquire();
+                add_frame(frame_holder(embedded));
+            }
+            return;
+        }
+
+        auto clock = get_device_clock(f.frame);
+        auto time = to_host_time(f.frame, *clock);
+        auto& stream = _streams[f->get_stream()->get_unique_id()];
+        stream.device = clock;
+        stream.last_time = time;
+        stream.frames.emplace_back(time, std::move(f));
+        while (stream.frames.size() > size_t(_queue_size))
+        {
+            stream.frames.pop_front();
+            ++clock->frames_dropped;
+        }
+
+        _latest_time = std::max(_latest_time, time);
+        for (auto it = _streams.begin(); it != _streams.end();)
+        {
+            if (it->second.last_time < _latest_time - INACTIVE_STREAM_MS)
+            {
+                LOG_DEBUG("Multi-device syncer: stream " << it->first << " is inactive");
+                it->second.device->frames_dropped += it->second.frames.size();
+                it = _streams.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    void multi_device_syncer::match(std::vector<frame_holder>& sets)
+    {
+        while (!_streams.empty())
+        {
+            auto earliest = std::numeric_limits<double>::max();
+            auto latest = std::numeric_limits<double>::lowest();
+            for (auto&& stream : _streams)
+            {
+                if (stream.second.frames.empty())
+                    return;
+                earliest = std::min(earliest, stream.second.frames.front().first);
+                latest = std::max(latest, stream.second.frames.front().first);
+            }
+
+            if (latest - earliest > _tolerance)
+            {
+                // The frames of each stream are in time order, so the heads further than the tolerance
+                // from the latest one can no longer be part of a set. There is at least the earliest one
+                for (auto&& stream : _streams)
+                {
+                    if (stream.second.frames.front().first < latest - _tolerance)
+                    {
+                        stream.second.frames.pop_front();
+                        ++stream.second.device->frames_dropped;
+                    }
+                }
+                continue;
+            }
+
+            std::vector<frame_holder> set;
+            std::map<device_clock*, std::pair<double, int>> times;
+            for (auto&& stream : _streams)
+            {
+                auto& head = stream.second.frames.front();
+                auto& time = times[stream.second.device.get()];
+                time.first += head.first;
+                ++time.second;
+                set.push_back(std::move(head.second));
+                stream.second.frames.pop_front();
+            }
+            update_offsets(times);
+
+            frame_holder composite = get_source().allocate_composite_frame(std::move(set));
+            if (composite)
+                sets.push_back(std::move(composite));
+        }
+    }
+
+    void multi_device_syncer::update_offsets(const std::map<device_clock*, std::pair<double, int>>& times)
+    {
+        for (auto&& time : times)
+            time.first->frames_matched += time.second.second;
+
+        auto reference = times.find(_device_order.front().get());
+        if (reference == times.end())
+            return;
+        auto reference_time = reference->second.first / reference->second.second;
+
+        for (auto&& time : times)
+        {
+            auto& clock = *time.first;
+            auto offset = time.second.first / time.second.second - reference_time;
+            clock.offset = clock.offsets.empty() ? offset : clock.offset + OFFSET_SMOOTHING * (offset - clock.offset);
+            clock.offsets.emplace_back(reference_time, offset);
+            if (clock.offsets.size() > OFFSET_DRIFT_WINDOW)
+                clock.offsets.pop_front();
+        }
+    }
+
+    // Slope of the linear regression of the offsets over time
+    static double offset_drift(const std::deque<std::pair<double, double>>& offsets)
+    {
+        if (offsets.size() < 2)
+            return 0;
+
+        double mean_time = 0, mean_offset = 0;
+        for (auto&& o : offsets)
+        {
+            mean_time += o.first;
+            mean_offset += o.second;
+        }
+        mean_time /= offsets.size();
+        mean_offset /= offsets.size();
+
+        double covariance = 0, variance = 0;
+        for (auto&& o : offsets)
+        {
+            covariance += (o.first - mean_time) * (o.second - mean_offset);
+            variance += (o.first - mean_time) * (o.first - mean_time);
+        }
+        return variance > 0 ? covariance / variance : 0;
+    }
+
+    std::vector<rs2_sync_device_metrics> multi_device_syncer::get_metrics()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        std::vector<rs2_sync_device_metrics> metrics;
+        for (auto&& clock : _device_order)
+        {
+            rs2_sync_device_metrics m{};
+            strncpy(m.serial_number, clock->serial_number.c_str(), sizeof(m.serial_number) - 1);
+            m.is_reference = clock == _device_order.front();
+            m.on_host_clock = clock->on_host_clock;
+            if (auto keeper = clock->keeper.lock())
+            {
+                bool is_ready = false;
+                m.clock_drift_ppm = keeper->get_clock_drift_ppm(is_ready);
+            }
+            m.offset_ms = clock->offset;
+            m.offset_drift_ppm = offset_drift(clock->offsets) * 1e6;
+            m.frames_matched = clock->frames_matched;
+            m.frames_dropped = clock->frames_dropped;
+            metrics.push_back(m);
+        }
+        return metrics;
+    }
+}
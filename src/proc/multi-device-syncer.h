@@ -0,0 +1,69 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    class device_interface;
+    class time_diff_keeper;
+
+    // Matches the frames of several devices into framesets, by their timestamps on the host clock:
+    //  - global time frames are already on it, mapped by the global_timestamp_reader of their sensor,
+    //    and system time frames are by definition
+    //  - hardware clock frames are mapped by the time_diff_keeper of their device, when it runs
+    //  - other frames stand for their arrival time
+    // A set holds a frame of each active stream, all within RS2_OPTION_SYNC_TOLERANCE of each other. Each
+    // stream buffers at most RS2_OPTION_SYNC_QUEUE_SIZE frames: beyond that the oldest one is dropped, as
+    // are the frames that can no longer be part of a set. Streams that stop are left out of the sets.
+    // Composite frames are split into the frames they hold.
+    class multi_device_syncer : public processing_block
+    {
+    public:
+        multi_device_syncer();
+
+        // In the order frames were first received from the devices
+        std::vector<rs2_sync_device_metrics> get_metrics();
+
+    private:
+        struct device_clock
+        {
+            std::string serial_number;
+            std::weak_ptr<time_diff_keeper> keeper;
+            bool on_host_clock = false;
+            // Offsets to the reference device in the last sets, by the time of the reference frames
+            std::deque<std::pair<double, double>> offsets;
+            double offset = 0;
+            unsigned long long frames_matched = 0;
+            unsigned long long frames_dropped = 0;
+        };
+
+        struct stream_queue
+        {
+            std::shared_ptr<device_clock> device;
+            std::deque<std::pair<double, frame_holder>> frames; // With their host-clock time
+            double last_time = 0;
+        };
+
+        void add_frame(frame_holder f);
+        std::shared_ptr<device_clock> get_device_clock(frame_interface* f);
+        double to_host_time(frame_interface* f, device_clock& clock) const;
+        void match(std::vector<frame_holder>& sets);
+        void update_offsets(const std::map<device_clock*, std::pair<double, int>>& times);
+
+        float _tolerance;
+        int _queue_size;
+        std::map<int, stream_queue> _streams;                            // By stream unique id
+        std::map<device_interface*, std::shared_ptr<device_clock>> _devices; // Null for frames without a sensor
+        std::vector<std::shared_ptr<device_clock>> _device_order;
+        double _latest_time;
+    };
+}
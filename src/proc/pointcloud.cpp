@@ -23,25 +23,64 @@
 
 namespace librealsense
 {
-    template<class MAP_DEPTH> void deproject_depth(float * points, const rs2_intrinsics & intrin, const uint16_t * depth, MAP_DEPTH map_depth)
+    static bool same_intrinsics(const rs2_intrinsics& a, const rs2_intrinsics& b)
     {
-        for (int y = 0; y < intrin.height; ++y)
+        return a.width == b.width && a.height == b.height && a.ppx == b.ppx && a.ppy == b.ppy &&
+            a.fx == b.fx && a.fy == b.fy && a.model == b.model && std::equal(a.coeffs, a.coeffs + 5, b.coeffs);
+    }
+
+    // rs2_deproject_pixel_to_point scales the point at a depth of 1 by the depth, so the
+    // vertices are the same as when deprojecting every pixel
+    void pointcloud::compute_rays(const rs2_intrinsics& intrinsics, float* x, float* y)
+    {
+        for (int h = 0; h < intrinsics.height; ++h)
         {
-            for (int x = 0; x < intrin.width; ++x)
+            for (int w = 0; w < intrinsics.width; ++w)
             {
-                const float pixel[] = { (float)x, (float)y };
-                rs2_deproject_pixel_to_point(points, &intrin, pixel, map_depth(*depth++));
-                points += 3;
+                const float pixel[] = { (float)w, (float)h };
+                float point[3];
+                rs2_deproject_pixel_to_point(point, &intrinsics, pixel, 1.f);
+                *x++ = point[0];
+                *y++ = point[1];
             }
         }
     }
 
+    void pointcloud::preprocess()
+    {
+        const size_t MAX_RAY_TABLES = 4;
+
+        auto it = std::find_if(_ray_tables.begin(), _ray_tables.end(),
+            [this](const std::shared_ptr<const ray_table>& t) { return same_intrinsics(t->intrinsics, *_depth_intrinsics); });
+        if (it == _ray_tables.end())
+        {
+            auto table = std::make_shared<ray_table>();
+            table->intrinsics = *_depth_intrinsics;
+            table->x.resize(_depth_intrinsics->width * _depth_intrinsics->height);
+            table->y.resize(_depth_intrinsics->width * _depth_intrinsics->height);
+            compute_rays(table->intrinsics, table->x.data(), table->y.data());
+
+            if (_ray_tables.size() == MAX_RAY_TABLES)
+                _ray_tables.pop_back();
+            it = _ray_tables.insert(_ray_tables.begin(), table);
+        }
+        std::rotate(_ray_tables.begin(), it, it + 1);
+        _rays = _ray_tables.front();
+    }
+
     const float3 * pointcloud::depth_to_points(rs2::points output, 
         const rs2_intrinsics &depth_intrinsics, const rs2::depth_frame& depth_frame, float depth_scale)
     {
-        auto image = output.get_vertices();
-        deproject_depth((float*)image, depth_intrinsics, (const uint16_t*)depth_frame.get_data(), [depth_scale](uint16_t z) { return depth_scale * z; });
-        return (float3*)image;
+        auto image = (float3*)output.get_vertices();
+        auto depth = (const uint16_t*)depth_frame.get_data();
+        const float* ray_x = _rays->x.data();
+        const float* ray_y = _rays->y.data();
+        for (int i = 0; i < depth_intrinsics.width * depth_intrinsics.height; ++i)
+        {
+            const float z = depth_scale * depth[i];
+            image[i] = { z * ray_x[i], z * ray_y[i], z };
+        }
+        return image;
     }
 
     float3 transform(const rs2_extrinsics *extrin, const float3 &point) { float3 p = {}; rs2_transform_point_to_point(&p.x, extrin, &point.x); return p; }
@@ -246,7 +285,37 @@ namespace librealsense
 
     rs2::points pointcloud::allocate_points(const rs2::frame_source& source, const rs2::frame& depth)
     {
-        return source.allocate_points(_output_stream, depth);
+        if (!_compact_points)
+            return source.allocate_points(_output_stream, depth);
+
+        auto prof = std::dynamic_pointer_cast<librealsense::stream_profile_interface>(
+            _output_stream.get()->profile->shared_from_this());
+        auto frame_ref = _source_wrapper.allocate_points(prof, (frame_interface*)depth.get(), RS2_EXTENSION_POINTS, true);
+        rs2::frame res { (rs2_frame*)frame_ref };
+        return res.as<rs2::points>();
+    }
+
+    // Move the vertices with depth, and their texture coordinates, to the front of the frame. The
+    // vertices only move towards the front, so this is done in place
+    void pointcloud::compact_points(librealsense::points* pframe)
+    {
+        auto vertices = pframe->get_vertices();
+        auto tex = pframe->get_texture_coordinates();
+        auto indices = pframe->get_vertex_indices();
+        const int count = _depth_intrinsics->width * _depth_intrinsics->height;
+
+        int valid = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            if (vertices[i].z)
+            {
+                vertices[valid] = vertices[i];
+                tex[valid] = tex[i];
+                indices[valid] = i;
+                ++valid;
+            }
+        }
+        pframe->set_vertex_count(valid);
     }
 
     rs2::frame pointcloud::process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth)
@@ -289,6 +358,9 @@ namespace librealsense
                 _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map, depth);
             }
         }
+
+        if (pframe->get_vertex_indices())
+            compact_points(pframe);
         return res;
     }
 
@@ -319,6 +391,10 @@ namespace librealsense
         occlusion_invalidation->set_description(1.f, "Off");
         occlusion_invalidation->set_description(2.f, "On");
         register_option(RS2_OPTION_FILTER_MAGNITUDE, occlusion_invalidation);
+
+        auto compact_opt = std::make_shared<ptr_option<bool>>(false, true, true, false, &_compact_points,
+            "Emit only the vertices with depth, with the index of their depth pixel");
+        register_option(RS2_OPTION_COMPACT_POINTS, compact_opt);
     }
 
     bool pointcloud::should_process(const rs2::frame& frame)
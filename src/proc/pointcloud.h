@@ -29,12 +29,21 @@ namespace librealsense
             const rs2_extrinsics& extr,
             float2* pixels_ptr);
         virtual rs2::points allocate_points(const rs2::frame_source& source, const rs2::frame& f);
-        virtual void preprocess() {}
+        virtual void preprocess();
         virtual bool run__occlusion_filter(const rs2_extrinsics& extr);
 
     protected:
         pointcloud(const char* name);
 
+        // The rays through the depth pixels at a depth of 1, which depth_to_points scales by the depth
+        struct ray_table
+        {
+            rs2_intrinsics intrinsics;
+            std::vector<float> x, y;
+        };
+        virtual void compute_rays(const rs2_intrinsics& intrinsics, float* x, float* y);
+        std::shared_ptr<const ray_table> _rays;     // Those of _depth_intrinsics, set by preprocess()
+
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
@@ -55,6 +64,12 @@ namespace librealsense
         void inspect_other_frame(const rs2::frame& other);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
         void set_extrinsics();
+        void compact_points(librealsense::points* points);
+
+        // Tables are kept by intrinsics, so that switching between profiles (or restarting a stream)
+        // does not compute them again. The most recently used comes first
+        std::vector<std::shared_ptr<const ray_table>> _ray_tables;
+        bool _compact_points = false;
 
         stream_filter _prev_stream_filter;
         std::shared_ptr< pointcloud > _registered_auto_calib_cb;
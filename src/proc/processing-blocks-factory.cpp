@@ -3,6 +3,7 @@
 
 #include "processing-blocks-factory.h"
 
+#include "align-simd.h"
 #include "sse/sse-align.h"
 #include "cuda/cuda-align.h"
 
@@ -19,6 +20,9 @@ namespace librealsense
 #ifdef __SSSE3__
     std::shared_ptr<librealsense::align> create_align(rs2_stream align_to)
     {
+        // The generic align is vectorized with AVX2, when the CPU supports it
+        if (align_simd_supported())
+            return std::make_shared<librealsense::align>(align_to);
         return std::make_shared<librealsense::align_sse>(align_to);
     }
 #else // No optimizations
@@ -0,0 +1,158 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "processing-thread-pool.h"
+#include "types.h"
+
+#include <algorithm>
+
+namespace librealsense
+{
+    // Chunks per participating thread: enough for the threads that finish early to take
+    // over some of the work of those that got preempted, few enough to keep the overhead low
+    static const size_t CHUNKS_PER_THREAD = 4;
+
+    std::shared_ptr<processing_thread_pool> processing_thread_pool::get()
+    {
+        static std::mutex instance_mutex;
+        static std::weak_ptr<processing_thread_pool> instance;
+
+        std::lock_guard<std::mutex> lock(instance_mutex);
+        auto pool = instance.lock();
+        if (!pool)
+        {
+            pool = std::shared_ptr<processing_thread_pool>(new processing_thread_pool());
+            instance = pool;
+        }
+        return pool;
+    }
+
+    int processing_thread_pool::max_threads()
+    {
+        return std::max(1, int(std::thread::hardware_concurrency()));
+    }
+
+    processing_thread_pool::processing_thread_pool()
+        : _stopping(false)
+    {
+    }
+
+    processing_thread_pool::~processing_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _cv.notify_all();
+
+        for (auto&& t : _workers)
+            t.join();
+    }
+
+    void processing_thread_pool::start_workers()
+    {
+        // Called with _mutex held. The calling thread of a job is one of its participants
+        auto workers = max_threads() - 1;
+        for (auto i = 0; i < workers; ++i)
+            _workers.emplace_back([this]() { run(); });
+        LOG_INFO("Processing thread pool started with " << workers << " worker threads");
+    }
+
+    void processing_thread_pool::run()
+    {
+        while (true)
+        {
+            std::shared_ptr<job> j;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+                if (_stopping)
+                    return;
+                j = _queue.front();
+                _queue.pop_front();
+            }
+            // A job may be found here after its caller already completed it; work() is then a no-op
+            j->work();
+        }
+    }
+
+    bool processing_thread_pool::job::work()
+    {
+        bool completed = false;
+        while (true)
+        {
+            auto c = next_chunk.fetch_add(1);
+            if (c >= chunks)
+                break;
+
+            try
+            {
+                auto first = c * chunk;
+                (*fn)(first, std::min(count, first + chunk));
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            if (done_chunks.fetch_add(1) + 1 == chunks)
+                completed = true;
+        }
+
+        if (completed)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_all();
+        }
+        return completed;
+    }
+
+    void processing_thread_pool::parallel_for(size_t count, size_t grain, int threads, const std::function<void(size_t, size_t)>& fn)
+    {
+        if (!count)
+            return;
+
+        threads = std::min(threads, max_threads());
+        grain = std::max<size_t>(grain, 1);
+        auto chunk = (count + threads * CHUNKS_PER_THREAD - 1) / (threads * CHUNKS_PER_THREAD);
+        chunk = (chunk + grain - 1) / grain * grain;
+        auto chunks = (count + chunk - 1) / chunk;
+        if (threads <= 1 || chunks <= 1)
+        {
+            fn(0, count);
+            return;
+        }
+
+        auto j = std::make_shared<job>();
+        j->fn = &fn;
+        j->count = count;
+        j->chunk = chunk;
+        j->chunks = chunks;
+        j->next_chunk = 0;
+        j->done_chunks = 0;
+
+        auto helpers = std::min<size_t>(threads - 1, chunks - 1);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_workers.empty())
+                start_workers();
+            for (size_t i = 0; i < helpers; ++i)
+                _queue.push_back(j);
+        }
+        if (helpers == 1)
+            _cv.notify_one();
+        else
+            _cv.notify_all();
+
+        if (!j->work())
+        {
+            std::unique_lock<std::mutex> lock(j->mutex);
+            j->done.wait(lock, [&]() { return j->done_chunks == j->chunks; });
+        }
+
+        if (j->error)
+            std::rethrow_exception(j->error);
+    }
+}
@@ -0,0 +1,68 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace librealsense
+{
+    // A pool of worker threads shared by the processing blocks of the process, used to split
+    // the work on a frame into independent ranges (of rows, columns or pixels).
+    //
+    // A parallel_for() call is a job of equally sized chunks. The calling thread works on the
+    // job along with the workers, and every participant claims the next unprocessed chunk when
+    // done with its previous one, so that a thread idle in one job helps with the others and
+    // the blocks of several cameras share the cores without one of them starving the rest.
+    class processing_thread_pool
+    {
+    public:
+        // The pool is held by every context and by the processing blocks that use it, and
+        // is destroyed with the last of them. Worker threads start on first use
+        static std::shared_ptr<processing_thread_pool> get();
+
+        ~processing_thread_pool();
+
+        // Number of threads, including the caller, that may work on a single job
+        static int max_threads();
+
+        // Calls fn(first, last) on sub-ranges covering [0, count), using up to 'threads'
+        // threads including the calling one, and returns when the whole range was processed.
+        // Ranges are multiples of 'grain' long, except for the last one. The first exception
+        // thrown by fn is rethrown here
+        void parallel_for(size_t count, size_t grain, int threads, const std::function<void(size_t, size_t)>& fn);
+
+    private:
+        struct job
+        {
+            const std::function<void(size_t, size_t)>* fn;
+            size_t count, chunk, chunks;
+            std::atomic<size_t> next_chunk;
+            std::atomic<size_t> done_chunks;
+            std::mutex mutex;
+            std::condition_variable done;
+            std::exception_ptr error;
+
+            // Processes chunks until none is left; returns true if it completed the last one
+            bool work();
+        };
+
+        processing_thread_pool();
+
+        void start_workers();
+        void run();
+
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        std::deque<std::shared_ptr<job>> _queue;
+        std::vector<std::thread> _workers;
+        bool _stopping;
+    };
+}
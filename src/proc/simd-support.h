@@ -0,0 +1,12 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+namespace librealsense
+{
+    // Whether the running CPU, and the OS, support AVX2. The *-avx.cpp sources are built with AVX2 code
+    // generation (see src/proc/CMakeLists.txt), and their kernels may only be called when this is true.
+    // This file must not be built with AVX2 code generation itself
+    bool avx2_supported();
+}
@@ -0,0 +1,79 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "spatial-filter-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        struct avx2_ops
+        {
+            typedef __m256 V;
+            static const size_t L = 8;
+
+            static V load(const float* p) { return _mm256_loadu_ps(p); }
+            static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+            static V set1(float f) { return _mm256_set1_ps(f); }
+
+            static V step(V x, V prev, V state, V alpha, V one_minus_alpha, V delta_z, V minus_delta_z)
+            {
+                const __m256i zero = _mm256_setzero_si256();
+                V valid = _mm256_and_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_castps_si256(x), zero)),
+                                        _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_castps_si256(prev), zero)));
+                V delta = _mm256_sub_ps(prev, x);
+                V smooth = _mm256_and_ps(valid, _mm256_and_ps(_mm256_cmp_ps(delta, delta_z, _CMP_LT_OQ),
+                                                              _mm256_cmp_ps(delta, minus_delta_z, _CMP_GT_OQ)));
+                V filtered = _mm256_add_ps(_mm256_mul_ps(x, alpha), _mm256_mul_ps(state, one_minus_alpha));
+                return _mm256_blendv_ps(x, filtered, smooth);
+            }
+
+            static void transpose(const float* src, size_t src_stride, float* dst, size_t dst_stride)
+            {
+                V r[8], t[8];
+                for (int i = 0; i < 8; ++i)
+                    r[i] = load(src + i * src_stride);
+
+                for (int i = 0; i < 8; i += 2)
+                {
+                    t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+                    t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+                }
+                for (int i = 0; i < 8; i += 4)
+                {
+                    r[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+                    r[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+                    r[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+                    r[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+                }
+                for (int i = 0; i < 4; ++i)
+                {
+                    store(dst + i * dst_stride, _mm256_permute2f128_ps(r[i], r[i + 4], 0x20));
+                    store(dst + (i + 4) * dst_stride, _mm256_permute2f128_ps(r[i], r[i + 4], 0x31));
+                }
+            }
+        };
+
+        bool spatial_filter_built() { return true; }
+
+        void recursive_filter_horizontal(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z, float* scratch)
+        {
+            recursive_filter_kernels<avx2_ops>::horizontal(image, width, height, stride, alpha, delta_z, scratch);
+        }
+
+        void recursive_filter_vertical(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z, float* scratch)
+        {
+            recursive_filter_kernels<avx2_ops>::vertical(image, width, height, stride, alpha, delta_z, scratch);
+        }
+#else
+        bool spatial_filter_built() { return false; }
+        void recursive_filter_horizontal(float*, size_t, size_t, size_t, float, float, float*) {}
+        void recursive_filter_vertical(float*, size_t, size_t, size_t, float, float, float*) {}
+#endif
+    }
+}
@@ -0,0 +1,124 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "spatial-filter-simd.h"
+#include "simd-support.h"
+
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPATIAL_FILTER_SSE
+#include <emmintrin.h> // SSE2 is all that the kernels use
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SPATIAL_FILTER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+#ifdef SPATIAL_FILTER_SSE
+    struct sse_ops
+    {
+        typedef __m128 V;
+        static const size_t L = 4;
+
+        static V load(const float* p) { return _mm_loadu_ps(p); }
+        static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+        static V set1(float f) { return _mm_set1_ps(f); }
+
+        static V step(V x, V prev, V state, V alpha, V one_minus_alpha, V delta_z, V minus_delta_z)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            V valid = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(_mm_castps_si128(x), zero)),
+                                 _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_castps_si128(prev), zero)));
+            V delta = _mm_sub_ps(prev, x);
+            V smooth = _mm_and_ps(valid, _mm_and_ps(_mm_cmplt_ps(delta, delta_z), _mm_cmpgt_ps(delta, minus_delta_z)));
+            V filtered = _mm_add_ps(_mm_mul_ps(x, alpha), _mm_mul_ps(state, one_minus_alpha));
+            return _mm_or_ps(_mm_and_ps(smooth, filtered), _mm_andnot_ps(smooth, x));
+        }
+
+        static void transpose(const float* src, size_t src_stride, float* dst, size_t dst_stride)
+        {
+            V r0 = load(src), r1 = load(src + src_stride), r2 = load(src + 2 * src_stride), r3 = load(src + 3 * src_stride);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            store(dst, r0);
+            store(dst + dst_stride, r1);
+            store(dst + 2 * dst_stride, r2);
+            store(dst + 3 * dst_stride, r3);
+        }
+    };
+    typedef recursive_filter_kernels<sse_ops> kernels;
+#elif defined(SPATIAL_FILTER_NEON)
+    struct neon_ops
+    {
+        typedef float32x4_t V;
+        static const size_t L = 4;
+
+        static V load(const float* p) { return vld1q_f32(p); }
+        static void store(float* p, V v) { vst1q_f32(p, v); }
+        static V set1(float f) { return vdupq_n_f32(f); }
+
+        static V step(V x, V prev, V state, V alpha, V one_minus_alpha, V delta_z, V minus_delta_z)
+        {
+            const int32x4_t zero = vdupq_n_s32(0);
+            uint32x4_t valid = vandq_u32(vcgtq_s32(vreinterpretq_s32_f32(x), zero),
+                                         vcgtq_s32(vreinterpretq_s32_f32(prev), zero));
+            V delta = vsubq_f32(prev, x);
+            uint32x4_t smooth = vandq_u32(valid, vandq_u32(vcltq_f32(delta, delta_z), vcgtq_f32(delta, minus_delta_z)));
+            // Not vmlaq_f32, which may be fused and would round differently from the scalar code
+            V filtered = vaddq_f32(vmulq_f32(x, alpha), vmulq_f32(state, one_minus_alpha));
+            return vbslq_f32(smooth, filtered, x);
+        }
+
+        static void transpose(const float* src, size_t src_stride, float* dst, size_t dst_stride)
+        {
+            float32x4x2_t r01 = vtrnq_f32(load(src), load(src + src_stride));
+            float32x4x2_t r23 = vtrnq_f32(load(src + 2 * src_stride), load(src + 3 * src_stride));
+            store(dst, vcombine_f32(vget_low_f32(r01.val[0]), vget_low_f32(r23.val[0])));
+            store(dst + dst_stride, vcombine_f32(vget_low_f32(r01.val[1]), vget_low_f32(r23.val[1])));
+            store(dst + 2 * dst_stride, vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0])));
+            store(dst + 3 * dst_stride, vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1])));
+        }
+    };
+    typedef recursive_filter_kernels<neon_ops> kernels;
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::spatial_filter_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool spatial_filter_simd_supported()
+    {
+#if defined(SPATIAL_FILTER_SSE) || defined(SPATIAL_FILTER_NEON)
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    void recursive_filter_horizontal_simd(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z)
+    {
+        std::vector<float> scratch(width * SPATIAL_FILTER_MAX_LANES);
+
+        if (use_avx2())
+            avx2::recursive_filter_horizontal(image, width, height, stride, alpha, delta_z, scratch.data());
+#if defined(SPATIAL_FILTER_SSE) || defined(SPATIAL_FILTER_NEON)
+        else
+            kernels::horizontal(image, width, height, stride, alpha, delta_z, scratch.data());
+#endif
+    }
+
+    void recursive_filter_vertical_simd(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z)
+    {
+        std::vector<float> scratch(width);
+
+        if (use_avx2())
+            avx2::recursive_filter_vertical(image, width, height, stride, alpha, delta_z, scratch.data());
+#if defined(SPATIAL_FILTER_SSE) || defined(SPATIAL_FILTER_NEON)
+        else
+            kernels::vertical(image, width, height, stride, alpha, delta_z, scratch.data());
+#endif
+    }
+}
@@ -0,0 +1,183 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized recursive passes of the spatial filter for disparity (float) data
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+namespace librealsense
+{
+    // Whether a SIMD implementation is available for the running CPU
+    bool spatial_filter_simd_supported();
+
+    // Both passes produce the same output as spatial_filter::recursive_filter_horizontal_fp and
+    // recursive_filter_vertical_fp, over a region of the image whose rows are 'stride' values
+    // apart. Rows (columns) are independent in the horizontal (vertical) pass, so that the
+    // frame can be processed in slices. The horizontal pass requires a width of at least 2,
+    // the vertical one a height of at least 2
+    void recursive_filter_horizontal_simd(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z);
+    void recursive_filter_vertical_simd(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z);
+
+    // Widest vector, in floats, of the available implementations
+    const size_t SPATIAL_FILTER_MAX_LANES = 8;
+
+    namespace avx2
+    {
+        // Implemented in spatial-filter-avx.cpp. spatial_filter_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well.
+        // Scratch memory is provided by the caller, so that no library code gets instantiated
+        // (and possibly shared with other translation units) with AVX2 instructions
+        bool spatial_filter_built();
+        void recursive_filter_horizontal(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z, float* scratch);
+        void recursive_filter_vertical(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z, float* scratch);
+    }
+
+    // The recursive filter, restated so that it can run on several independent lines at once:
+    // walking a line with original values x[k], output[0] = x[0] and
+    //     output[k] = x[k] * alpha + output[k-1] * (1 - alpha)
+    // when both x[k-1] and x[k] are valid (positive) and |x[k-1] - x[k]| < delta_z; otherwise
+    // output[k] = x[k]. The vertical pass runs on L columns at a time; the horizontal pass runs
+    // on L rows at a time, transposed in tiles into a scratch buffer of width * L values.
+    //
+    // SIMD must provide a vector type V of L floats with load/store/set1, a step() applying one
+    // element of the recursion, and transpose() of an L x L tile.
+    template<class SIMD>
+    struct recursive_filter_kernels
+    {
+        typedef typename SIMD::V V;
+        static const size_t L = SIMD::L;
+
+        struct params
+        {
+            float alpha, one_minus_alpha, delta_z;
+            V v_alpha, v_one_minus_alpha, v_delta_z, v_minus_delta_z;
+
+            params(float a, float dz)
+                : alpha(a), one_minus_alpha(1.0f - a), delta_z(dz),
+                  v_alpha(SIMD::set1(a)), v_one_minus_alpha(SIMD::set1(1.0f - a)),
+                  v_delta_z(SIMD::set1(dz)), v_minus_delta_z(SIMD::set1(-dz)) {}
+        };
+
+        static bool valid(float x)
+        {
+            int bits;
+            memcpy(&bits, &x, sizeof(bits));
+            return bits > 0;
+        }
+
+        static float step(float x, float prev, float state, const params& p)
+        {
+            if (valid(prev) && valid(x))
+            {
+                float delta = prev - x;
+                if (delta < p.delta_z && delta > -p.delta_z)
+                    return x * p.alpha + state * p.one_minus_alpha;
+            }
+            return x;
+        }
+
+        static V step(V x, V prev, V state, const params& p)
+        {
+            return SIMD::step(x, prev, state, p.v_alpha, p.v_one_minus_alpha, p.v_delta_z, p.v_minus_delta_z);
+        }
+
+        // Runs the recursion forward then backward over n vectors laid out contiguously
+        static void sweep(float* lines, size_t n, const params& p)
+        {
+            V state = SIMD::load(lines);
+            V prev = state;
+            for (size_t k = 1; k < n; ++k)
+            {
+                V x = SIMD::load(lines + k * L);
+                state = step(x, prev, state, p);
+                SIMD::store(lines + k * L, state);
+                prev = x;
+            }
+
+            state = SIMD::load(lines + (n - 1) * L);
+            prev = state;
+            for (size_t k = n - 1; k-- > 0;)
+            {
+                V x = SIMD::load(lines + k * L);
+                state = step(x, prev, state, p);
+                SIMD::store(lines + k * L, state);
+                prev = x;
+            }
+        }
+
+        // scratch holds width * L floats
+        static void horizontal(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z, float* scratch)
+        {
+            params p(alpha, delta_z);
+            const size_t full_tiles_width = width - width % L;
+
+            for (size_t v = 0; v < height; v += L)
+            {
+                float* rows = image + v * stride;
+                const size_t n_rows = height - v < L ? height - v : L;
+
+                // Gather column u of the block into scratch[u * L]. Missing rows of the last block
+                // are zeroed, i.e. invalid, and are not written back
+                if (n_rows == L)
+                {
+                    for (size_t u = 0; u < full_tiles_width; u += L)
+                        SIMD::transpose(rows + u, stride, scratch + u * L, L);
+                }
+                for (size_t u = (n_rows == L ? full_tiles_width : 0); u < width; ++u)
+                    for (size_t r = 0; r < L; ++r)
+                        scratch[u * L + r] = r < n_rows ? rows[r * stride + u] : 0.f;
+
+                sweep(scratch, width, p);
+
+                if (n_rows == L)
+                {
+                    for (size_t u = 0; u < full_tiles_width; u += L)
+                        SIMD::transpose(scratch + u * L, L, rows + u, stride);
+                }
+                for (size_t u = (n_rows == L ? full_tiles_width : 0); u < width; ++u)
+                    for (size_t r = 0; r < n_rows; ++r)
+                        rows[r * stride + u] = scratch[u * L + r];
+            }
+        }
+
+        // Walks the image row by row; 'prev' keeps the original values of the row above (below),
+        // whose filtered values are already in the image
+        static void vertical_sweep(float* image, size_t width, size_t height, ptrdiff_t row_step, float* prev, const params& p)
+        {
+            const size_t full_width = width - width % L;
+            memcpy(prev, image, width * sizeof(float));
+
+            for (size_t v = 1; v < height; ++v)
+            {
+                float* row = image + ptrdiff_t(v) * row_step;
+                const float* above = row - row_step;
+
+                size_t u = 0;
+                for (; u < full_width; u += L)
+                {
+                    V x = SIMD::load(row + u);
+                    SIMD::store(row + u, step(x, SIMD::load(prev + u), SIMD::load(above + u), p));
+                    SIMD::store(prev + u, x);
+                }
+                for (; u < width; ++u)
+                {
+                    float x = row[u];
+                    row[u] = step(x, prev[u], above[u], p);
+                    prev[u] = x;
+                }
+            }
+        }
+
+        // scratch holds width floats
+        static void vertical(float* image, size_t width, size_t height, size_t stride, float alpha, float delta_z, float* scratch)
+        {
+            params p(alpha, delta_z);
+
+            // Top to bottom, then bottom to top
+            vertical_sweep(image, width, height, ptrdiff_t(stride), scratch, p);
+            vertical_sweep(image + (height - 1) * stride, width, height, -ptrdiff_t(stride), scratch, p);
+        }
+    };
+}
@@ -10,6 +10,7 @@
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
 #include "proc/spatial-filter.h"
+#include "proc/spatial-filter-simd.h"
 
 namespace librealsense
 {
@@ -145,6 +146,7 @@ namespace librealsense
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, spatial_filter_delta);
         register_option(RS2_OPTION_FILTER_MAGNITUDE, spatial_filter_iterations);
         register_option(RS2_OPTION_HOLES_FILL, holes_filling_mode);
+        register_processing_threads_option();
     }
 
     rs2::frame spatial_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -163,6 +165,19 @@ namespace librealsense
         return tgt;
     }
 
+    void spatial_filter::smooth_disparity(float* disparity, size_t width, size_t height)
+    {
+        _source_stream_profile = rs2::stream_profile();
+        _extension_type = RS2_EXTENSION_DISPARITY_FRAME;
+        _bpp = sizeof(float);
+        _width = width;
+        _height = height;
+        _stride = width * sizeof(float);
+        _current_frm_size_pixels = width * height;
+        _spatial_edge_threshold = _spatial_delta_param;
+        dxf_smooth<float>(disparity, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+    }
+
     void  spatial_filter::update_configuration(const rs2::frame& f)
     {
         if (f.get_profile().get() != _source_stream_profile.get())
@@ -230,6 +245,16 @@ namespace librealsense
     {
         float *image = reinterpret_cast<float*>(image_data);
 
+        if (spatial_filter_simd_supported() && _width >= 2)
+        {
+            // Blocks of rows, matching the vector width
+            parallel_for(_height, SPATIAL_FILTER_MAX_LANES, [&](size_t first, size_t last)
+            {
+                recursive_filter_horizontal_simd(image + first * _width, _width, last - first, _width, alpha, deltaZ);
+            });
+            return;
+        }
+
         int v, u;
 
         for (v = 0; v < _height;) {
@@ -358,6 +383,16 @@ namespace librealsense
     {
         float *image = reinterpret_cast<float*>(image_data);
 
+        if (spatial_filter_simd_supported() && _height >= 2)
+        {
+            // Stripes of columns, of whole cache lines
+            parallel_for(_width, 64 / sizeof(float), [&](size_t first, size_t last)
+            {
+                recursive_filter_vertical_simd(image + first, last - first, _height, _width, alpha, deltaZ);
+            });
+            return;
+        }
+
         int v, u;
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
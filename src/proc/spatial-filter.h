@@ -12,6 +12,7 @@
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
+#include "hole-filling-simd.h"
 
 namespace librealsense
 {
@@ -20,6 +21,10 @@ namespace librealsense
     public:
         spatial_filter();
 
+        // Filtering a disparity buffer of the caller in place with the options of the block, for
+        // fused_depth_filters. The block configures itself again on the next frame it processes
+        void smooth_disparity(float* disparity, size_t width, size_t height);
+
     protected:
         void    update_configuration(const rs2::frame& f);
 
@@ -58,8 +63,6 @@ namespace librealsense
         template <typename T>
         void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
         {
-            size_t v{}, u{};
-
             // Handle conversions for invalid input data
             bool fp = (std::is_floating_point<T>::value);
 
@@ -70,91 +73,95 @@ namespace librealsense
             const T delta_z = static_cast<T>(deltaZ);
 
             auto image = reinterpret_cast<T*>(image_data);
-            size_t cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            // Rows are independent
+            parallel_for(_height, 1, [&](size_t first, size_t last)
             {
-                // left to right
-                T *im = image + v * _width;
-                T val0 = im[0];
-                cur_fill = 0;
+                size_t u{};
+                size_t cur_fill = 0;
 
-                for (u = 1; u < _width - 1; u++)
+                for (size_t v = first; v < last; v++)
                 {
-                    T val1 = im[1];
+                    // left to right
+                    T *im = image + v * _width;
+                    T val0 = im[0];
+                    cur_fill = 0;
 
-                    if (fabs(val0) >= valid_threshold)
+                    for (u = 1; u < _width - 1; u++)
                     {
-                        if (fabs(val1) >= valid_threshold)
-                        {
-                            cur_fill = 0;
-                            T diff = static_cast<T>(fabs(val1 - val0));
+                        T val1 = im[1];
 
-                            if (diff >= valid_threshold && diff <= delta_z)
+                        if (fabs(val0) >= valid_threshold)
+                        {
+                            if (fabs(val1) >= valid_threshold)
                             {
-                                float filtered = val1 * alpha + val0 * (1.0f - alpha);
-                                val1 = static_cast<T>(filtered + round);
-                                im[1] = val1;
+                                cur_fill = 0;
+                                T diff = static_cast<T>(fabs(val1 - val0));
+
+                                if (diff >= valid_threshold && diff <= delta_z)
+                                {
+                                    float filtered = val1 * alpha + val0 * (1.0f - alpha);
+                                    val1 = static_cast<T>(filtered + round);
+                                    im[1] = val1;
+                                }
                             }
-                        }
-                        else // Only the old value is valid - appy holes filling
-                        {
-                            if (_holes_filling_radius)
+                            else // Only the old value is valid - appy holes filling
                             {
-                                if (++cur_fill <_holes_filling_radius)
-                                    im[1] = val1 = val0;
+                                if (_holes_filling_radius)
+                                {
+                                    if (++cur_fill <_holes_filling_radius)
+                                        im[1] = val1 = val0;
+                                }
                             }
                         }
-                    }
 
-                    val0 = val1;
-                    im += 1;
-                }
-
-                // right to left
-                im = image + (v + 1) * _width - 2;  // end of row - two pixels
-                T val1 = im[1];
-                cur_fill = 0;
+                        val0 = val1;
+                        im += 1;
+                    }
 
-                for (u = _width - 1; u > 0; u--)
-                {
-                    T val0 = im[0];
+                    // right to left
+                    im = image + (v + 1) * _width - 2;  // end of row - two pixels
+                    T val1 = im[1];
+                    cur_fill = 0;
 
-                    if (val1 >= valid_threshold)
+                    for (u = _width - 1; u > 0; u--)
                     {
-                        if (val0 > valid_threshold)
-                        {
-                            cur_fill = 0;
-                            T diff = static_cast<T>(fabs(val1 - val0));
+                        T val0 = im[0];
 
-                            if (diff <= delta_z)
+                        if (val1 >= valid_threshold)
+                        {
+                            if (val0 > valid_threshold)
                             {
-                                float filtered = val0 * alpha + val1 * (1.0f - alpha);
-                                val0 = static_cast<T>(filtered + round);
-                                im[0] = val0;
+                                cur_fill = 0;
+                                T diff = static_cast<T>(fabs(val1 - val0));
+
+                                if (diff <= delta_z)
+                                {
+                                    float filtered = val0 * alpha + val1 * (1.0f - alpha);
+                                    val0 = static_cast<T>(filtered + round);
+                                    im[0] = val0;
+                                }
                             }
-                        }
-                        else // 'inertial' hole filling
-                        {
-                            if (_holes_filling_radius)
+                            else // 'inertial' hole filling
                             {
-                                if (++cur_fill <_holes_filling_radius)
-                                    im[0] = val0 = val1;
+                                if (_holes_filling_radius)
+                                {
+                                    if (++cur_fill <_holes_filling_radius)
+                                        im[0] = val0 = val1;
+                                }
                             }
                         }
-                    }
 
-                    val1 = val0;
-                    im -= 1;
+                        val1 = val0;
+                        im -= 1;
+                    }
                 }
-            }
+            });
         }
 
         template <typename T>
         void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
         {
-            size_t v{}, u{};
-
             // Handle conversions for invalid input data
             bool fp = (std::is_floating_point<T>::value);
 
@@ -166,105 +173,99 @@ namespace librealsense
 
             auto image = reinterpret_cast<T*>(image_data);
 
-            // we'll do one row at a time, top to bottom, then bottom to top
+            // we'll do one row at a time, top to bottom, then bottom to top.
+            // Columns are independent, and split into stripes of whole cache lines
+            parallel_for(_width, 64 / sizeof(T), [&](size_t first, size_t last)
+            {
+                size_t v{}, u{};
 
-            // top to bottom
+                // top to bottom
 
-            T *im = image;
-            T im0{};
-            T imw{};
-            for (v = 1; v < _height; v++)
-            {
-                for (u = 0; u < _width; u++)
+                T *im = image;
+                T im0{};
+                T imw{};
+                for (v = 1; v < _height; v++, im += _width)
                 {
-                    im0 = im[0];
-                    imw = im[_width];
-
-                    //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                    for (u = first; u < last; u++)
                     {
-                        T diff = static_cast<T>(fabs(im0 - imw));
-                        if (diff < delta_z)
+                        im0 = im[u];
+                        imw = im[u + _width];
+
+                        //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
                         {
-                            float filtered = imw * alpha + im0 * (1.f - alpha);
-                            im[_width] = static_cast<T>(filtered + round);
+                            T diff = static_cast<T>(fabs(im0 - imw));
+                            if (diff < delta_z)
+                            {
+                                float filtered = imw * alpha + im0 * (1.f - alpha);
+                                im[u + _width] = static_cast<T>(filtered + round);
+                            }
                         }
                     }
-                    im += 1;
                 }
-            }
 
-            // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
-            {
-                for (u = 0; u < _width; u++)
+                // bottom to top
+                im = image + (_height - 2) * _width;
+                for (v = 1; v < _height; v++, im -= _width)
                 {
-                    im0 = im[0];
-                    imw = im[_width];
-
-                    if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                    for (u = first; u < last; u++)
                     {
-                        T diff = static_cast<T>(fabs(im0 - imw));
-                        if (diff < delta_z)
+                        im0 = im[u];
+                        imw = im[u + _width];
+
+                        if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
                         {
-                            float filtered = im0 * alpha + imw * (1.f - alpha);
-                            im[0] = static_cast<T>(filtered + round);
+                            T diff = static_cast<T>(fabs(im0 - imw));
+                            if (diff < delta_z)
+                            {
+                                float filtered = im0 * alpha + imw * (1.f - alpha);
+                                im[u] = static_cast<T>(filtered + round);
+                            }
                         }
                     }
-                    im += 1;
                 }
-            }
+            });
         }
 
         template<typename T>
         inline void intertial_holes_fill(T* image_data)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
-            size_t cur_fill = 0;
-
-            T* p = image_data;
-            for (int j = 0; j < _height; ++j)
+            // Rows are independent
+            parallel_for(_height, 1, [&](size_t first, size_t last)
             {
-                ++p;
-                cur_fill = 0;
-
-                //Left to Right
-                for (size_t i = 1; i < _width; ++i)
+                for (size_t j = first; j < last; ++j)
                 {
-                    if (empty(p))
+                    T* row = image_data + j * _width;
+
+                    //Left to Right
+                    size_t cur_fill = 0;
+                    for (size_t i = 1; i < _width; ++i)
                     {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p - 1);
+                        if (is_hole(row[i]))
+                        {
+                            if (++cur_fill < _holes_filling_radius)
+                                row[i] = row[i - 1];
+                        }
+                        else
+                            cur_fill = 0;
                     }
-                    else
-                        cur_fill = 0;
-
-                    ++p;
-                }
 
-                --p;
-                cur_fill = 0;
-                //Right to left
-                for (size_t i = 1; i < _width; ++i)
-                {
-                    if (empty(p))
+                    //Right to left, never filling the last pixel from outside the row
+                    cur_fill = 0;
+                    for (size_t i = _width - 1; i > 0; --i)
                     {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p + 1);
+                        if (is_hole(row[i]))
+                        {
+                            if (++cur_fill < _holes_filling_radius && i + 1 < _width)
+                                row[i] = row[i + 1];
+                        }
+                        else
+                            cur_fill = 0;
                     }
-                    else
-                        cur_fill = 0;
-                    --p;
                 }
-                p += _width;
-            }
+            });
         }
 
     private:
-
         float                   _spatial_alpha_param;
         uint8_t                 _spatial_delta_param;
         uint8_t                 _spatial_iterations;
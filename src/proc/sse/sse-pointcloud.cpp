@@ -24,33 +24,30 @@ namespace librealsense
 {
     pointcloud_sse::pointcloud_sse() : pointcloud("Pointcloud (SSE3)") {}
 
-    void pointcloud_sse::preprocess()
+    void pointcloud_sse::compute_rays(const rs2_intrinsics& intrinsics, float* map_x, float* map_y)
     {
-        _pre_compute_map_x.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-        _pre_compute_map_y.resize(_depth_intrinsics->width*_depth_intrinsics->height);
-
-        for (int h = 0; h < _depth_intrinsics->height; ++h)
+        for (int h = 0; h < intrinsics.height; ++h)
         {
-            for (int w = 0; w < _depth_intrinsics->width; ++w)
+            for (int w = 0; w < intrinsics.width; ++w)
             {
                 const float pixel[] = { (float)w, (float)h };
 
-                float x = (pixel[0] - _depth_intrinsics->ppx) / _depth_intrinsics->fx;
-                float y = (pixel[1] - _depth_intrinsics->ppy) / _depth_intrinsics->fy;
+                float x = (pixel[0] - intrinsics.ppx) / intrinsics.fx;
+                float y = (pixel[1] - intrinsics.ppy) / intrinsics.fy;
 
 
-                if (_depth_intrinsics->model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
+                if (intrinsics.model == RS2_DISTORTION_INVERSE_BROWN_CONRADY)
                 {
                     float r2 = x * x + y * y;
-                    float f = 1 + _depth_intrinsics->coeffs[0] * r2 + _depth_intrinsics->coeffs[1] * r2*r2 + _depth_intrinsics->coeffs[4] * r2*r2*r2;
-                    float ux = x * f + 2 * _depth_intrinsics->coeffs[2] * x*y + _depth_intrinsics->coeffs[3] * (r2 + 2 * x*x);
-                    float uy = y * f + 2 * _depth_intrinsics->coeffs[3] * x*y + _depth_intrinsics->coeffs[2] * (r2 + 2 * y*y);
+                    float f = 1 + intrinsics.coeffs[0] * r2 + intrinsics.coeffs[1] * r2*r2 + intrinsics.coeffs[4] * r2*r2*r2;
+                    float ux = x * f + 2 * intrinsics.coeffs[2] * x*y + intrinsics.coeffs[3] * (r2 + 2 * x*x);
+                    float uy = y * f + 2 * intrinsics.coeffs[3] * x*y + intrinsics.coeffs[2] * (r2 + 2 * y*y);
                     x = ux;
                     y = uy;
                 }
 
-                _pre_compute_map_x[h*_depth_intrinsics->width + w] = x;
-                _pre_compute_map_y[h*_depth_intrinsics->width + w] = y;
+                map_x[h*intrinsics.width + w] = x;
+                map_y[h*intrinsics.width + w] = y;
             }
         }
     }
@@ -64,8 +61,8 @@ namespace librealsense
 
         auto depth_image = (const uint16_t*)depth_frame.get_data();
 
-        float* pre_compute_x = _pre_compute_map_x.data();
-        float* pre_compute_y = _pre_compute_map_y.data();
+        const float* pre_compute_x = _rays->x.data();
+        const float* pre_compute_y = _rays->y.data();
 
         uint32_t size = depth_intrinsics.height * depth_intrinsics.width;
 
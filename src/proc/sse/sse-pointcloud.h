@@ -11,7 +11,7 @@ namespace librealsense
     public:
         pointcloud_sse();
     private:
-        void preprocess() override;
+        void compute_rays(const rs2_intrinsics& intrinsics, float* x, float* y) override;
         const float3 * depth_to_points(
             rs2::points output,
             const rs2_intrinsics &depth_intrinsics, 
@@ -25,10 +25,5 @@ namespace librealsense
             const rs2_intrinsics &other_intrinsics,
             const rs2_extrinsics& extr,
             float2* pixels_ptr) override;
-
-        std::vector<float> _pre_compute_map_x;
-        std::vector<float> _pre_compute_map_y;
-
-        void pre_compute_x_y_map();
     };
 }
@@ -11,7 +11,7 @@
 namespace librealsense
 {
     syncer_process_unit::syncer_process_unit( std::initializer_list< bool_option::ptr > enable_opts )
-        : processing_block("syncer"), _matcher((new timestamp_composite_matcher({})))
+        : processing_block("syncer"), _matcher((new indexed_timestamp_composite_matcher({})))
         , _enable_opts( enable_opts.begin(), enable_opts.end() )
     {
         _matcher->set_callback([this](frame_holder f, syncronization_environment env)
@@ -26,6 +26,7 @@ namespace librealsense
             }
 
             LOG_DEBUG(ss.str());
+            f->update_frame_trace(RS2_FRAME_TRACE_STAGE_SYNCER_OUT, _source.get_time());
             env.matches.enqueue(std::move(f));
         });
 
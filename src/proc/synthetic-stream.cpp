@@ -26,6 +26,9 @@ namespace librealsense
         _source_wrapper(_source)
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option(RS2_OPTION_FRAME_POOL_WATERMARK, _source.get_pool_watermark_option());
+        register_option(RS2_OPTION_FRAME_POOL_HITS, _source.get_pool_hits_option());
+        register_option(RS2_OPTION_FRAME_POOL_MISSES, _source.get_pool_misses_option());
         register_info(RS2_CAMERA_INFO_NAME, name);
         _source.init(std::shared_ptr<metadata_parser_map>());
     }
@@ -37,6 +40,9 @@ namespace librealsense
         {
             if (_callback)
             {
+                if (f)
+                    f->update_frame_trace(RS2_FRAME_TRACE_STAGE_PROCESSING_IN, _source.get_time());
+
                 frame_interface* ptr = nullptr;
                 std::swap(f.frame, ptr);
 
@@ -99,6 +105,38 @@ namespace librealsense
         processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
     }
 
+    void generic_processing_block::register_processing_threads_option(int default_threads)
+    {
+        default_threads = std::max(1, std::min(default_threads, processing_thread_pool::max_threads()));
+        auto threads = std::make_shared<ptr_option<int>>(1, processing_thread_pool::max_threads(), 1, default_threads,
+            &_processing_threads_option, "Number of threads processing a frame, 1 processes it on the calling thread");
+        threads->on_set([this](float val)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (val > 1 && !_thread_pool)
+                _thread_pool = processing_thread_pool::get();
+            _processing_threads = static_cast<int>(val);
+        });
+        threads->set(static_cast<float>(default_threads));
+        register_option(RS2_OPTION_PROCESSING_THREADS, threads);
+    }
+
+    void generic_processing_block::parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn)
+    {
+        // Called from process_frame, with _mutex held
+        auto threads = _processing_threads.load();
+        if (threads > 1 && _thread_pool)
+            _thread_pool->parallel_for(count, grain, threads, fn);
+        else
+            fn(0, count);
+    }
+
+    int generic_processing_block::processing_threads() const
+    {
+        auto threads = _processing_threads.load();
+        return threads > 1 && _thread_pool ? std::min(threads, processing_thread_pool::max_threads()) : 1;
+    }
+
     rs2::frame generic_processing_block::prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results)
     {
         // this function prepares the processing block output frame(s) by the following heuristic:
@@ -313,10 +351,12 @@ namespace librealsense
 
     void synthetic_source::frame_ready(frame_holder result)
     {
+        if (result)
+            result->update_frame_trace(RS2_FRAME_TRACE_STAGE_PROCESSING_OUT, _actual_source.get_time());
         _actual_source.invoke_callback(std::move(result));
     }
 
-    frame_interface* synthetic_source::allocate_points(std::shared_ptr<stream_profile_interface> stream, frame_interface* original, rs2_extension frame_type)
+    frame_interface* synthetic_source::allocate_points(std::shared_ptr<stream_profile_interface> stream, frame_interface* original, rs2_extension frame_type, bool indexed)
     {
         auto vid_stream = dynamic_cast<video_stream_profile_interface*>(stream.get());
         if (vid_stream)
@@ -328,9 +368,18 @@ namespace librealsense
             data.metadata_size = 0;
             data.system_time = _actual_source.get_time();
             data.is_blocking = original->is_blocking();
+            if (auto of = dynamic_cast<frame*>(original))
+                data.trace = of->additional_data.trace;
 
-            auto res = _actual_source.alloc_frame(frame_type, vid_stream->get_width() * vid_stream->get_height() * sizeof(float) * 5, data, true);
+            auto point_size = sizeof(float) * 5 + (indexed ? sizeof(int) : 0);
+            auto res = _actual_source.alloc_frame(frame_type, vid_stream->get_width() * vid_stream->get_height() * point_size, data, true);
             if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
+            if (indexed)
+            {
+                auto pts = dynamic_cast<points*>(res);
+                if (!pts) throw invalid_value_exception("Only points frames can be indexed");
+                pts->set_indexed();
+            }
             res->set_sensor(original->get_sensor());
             res->set_stream(stream);
             return res;
@@ -547,6 +596,14 @@ namespace librealsense
         _processing_blocks.back()->set_output_callback(callback);
     }
 
+    void composite_processing_block::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        // Only the last block in the chain publishes frames to the user
+        processing_block::set_frame_allocator(allocator);
+        if (!_processing_blocks.empty())
+            _processing_blocks.back()->set_frame_allocator(allocator);
+    }
+
     void composite_processing_block::invoke(frame_holder frames)
     {
         // Invoke the first processing block.
@@ -6,6 +6,7 @@
 #include "core/processing.h"
 #include "image.h"
 #include "source.h"
+#include "processing-thread-pool.h"
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
@@ -34,7 +35,7 @@ namespace librealsense
         frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) override;
 
         frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
-            frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS) override;
+            frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS, bool indexed = false) override;
 
         void frame_ready(frame_holder result) override;
 
@@ -54,6 +55,7 @@ namespace librealsense
         void set_output_callback(frame_callback_ptr callback) override;
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
+        void set_frame_allocator(frame_allocator_ptr allocator) override { _source.set_frame_allocator(allocator); }
 
         virtual ~processing_block() { _source.flush(); }
     protected:
@@ -69,11 +71,29 @@ namespace librealsense
         generic_processing_block(const char* name);
         virtual ~generic_processing_block() { _source.flush(); }
 
+        // For blocks that run others as steps of their own processing (see fused_depth_filters),
+        // which hold processing_mutex() of those blocks while calling them
+        std::mutex& processing_mutex() { return _mutex; }
+        bool accepts(const rs2::frame& f) { return should_process(f); }
+        rs2::frame process_step(const rs2::frame_source& source, const rs2::frame& f) { return process_frame(source, f); }
+
     protected:
         virtual rs2::frame prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results);
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // Blocks whose work splits into independent ranges (of rows, columns or pixels) expose
+        // RS2_OPTION_PROCESSING_THREADS, and run that work with parallel_for(). See processing_thread_pool
+        void register_processing_threads_option(int default_threads = 1);
+        void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+        // Number of threads parallel_for() may use, including the calling one
+        int processing_threads() const;
+
+    private:
+        int _processing_threads_option = 1;         // set and queried through the option
+        std::atomic<int> _processing_threads{ 1 };  // read on the frame thread
+        std::shared_ptr<processing_thread_pool> _thread_pool;
     };
 
     struct stream_filter
@@ -251,6 +271,7 @@ namespace librealsense
         void add(std::shared_ptr<processing_block> block);
         void set_output_callback(frame_callback_ptr callback) override;
         void invoke(frame_holder frames) override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
 
     protected:
         std::vector<std::shared_ptr<processing_block>> _processing_blocks;
@@ -0,0 +1,112 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "temporal-filter-simd.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace librealsense
+{
+    namespace avx2
+    {
+#ifdef __AVX2__
+        struct avx2_ops
+        {
+            typedef __m256 V;
+            typedef __m256 M;
+            typedef __m128i B;
+            static const size_t L = 8;
+
+            static V set1(float f) { return _mm256_set1_ps(f); }
+
+            static void load(const float* p, V* v)
+            {
+                v[0] = _mm256_loadu_ps(p);
+                v[1] = _mm256_loadu_ps(p + 8);
+            }
+            static void store(float* p, const V* v)
+            {
+                _mm256_storeu_ps(p, v[0]);
+                _mm256_storeu_ps(p + 8, v[1]);
+            }
+            static void load(const uint16_t* p, V* v)
+            {
+                v[0] = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+                v[1] = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8))));
+            }
+            static void store(uint16_t* p, const V* v)
+            {
+                // packus interleaves the 128-bit lanes of its operands
+                __m256i packed = _mm256_packus_epi32(_mm256_cvttps_epi32(v[0]), _mm256_cvttps_epi32(v[1]));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+
+            static M nonzero(V v) { return _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_NEQ_UQ); }
+            static M less(V a, V b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+            static M and_(M a, M b) { return _mm256_and_ps(a, b); }
+            static V select(M m, V a, V b) { return _mm256_blendv_ps(b, a, m); }
+            static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+            static V add(V a, V b) { return _mm256_add_ps(a, b); }
+            static V abs_diff(V a, V b) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), _mm256_sub_ps(a, b)); }
+
+            static B to_bytes(const M* m)
+            {
+                __m256i words = _mm256_packs_epi32(_mm256_castps_si256(m[0]), _mm256_castps_si256(m[1]));
+                words = _mm256_permute4x64_epi64(words, _MM_SHUFFLE(3, 1, 2, 0));
+                return _mm_packs_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+            }
+            static void from_bytes(B b, M* m)
+            {
+                m[0] = _mm256_castsi256_ps(_mm256_cvtepi8_epi32(b));
+                m[1] = _mm256_castsi256_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(b, 8)));
+            }
+
+            static B load_bytes(const uint8_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+            static void store_bytes(uint8_t* p, B b) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), b); }
+            static B set1_bytes(uint8_t v) { return _mm_set1_epi8(char(v)); }
+            static B and_bytes(B a, B b) { return _mm_and_si128(a, b); }
+            static B or_bytes(B a, B b) { return _mm_or_si128(a, b); }
+            static B andnot_bytes(B a, B b) { return _mm_andnot_si128(a, b); }
+            static B select_bytes(B m, B a, B b) { return _mm_blendv_epi8(b, a, m); }
+
+            struct lut
+            {
+                __m128i low, high, bits;
+
+                explicit lut(const uint8_t* table)
+                    : low(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table))),
+                      high(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16))),
+                      bits(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128)) {}
+            };
+
+            // Byte h >> 3 of the table holds the bit of history h; pshufb looks up 16 bytes at a time
+            static B persistent(const lut& t, B history)
+            {
+                const __m128i byte_index = _mm_and_si128(_mm_srli_epi16(history, 3), _mm_set1_epi8(0x1f));
+                const __m128i in_high = _mm_cmpgt_epi8(byte_index, _mm_set1_epi8(0x0f));
+                const __m128i table_byte = _mm_blendv_epi8(_mm_shuffle_epi8(t.low, byte_index), _mm_shuffle_epi8(t.high, byte_index), in_high);
+                const __m128i bit = _mm_shuffle_epi8(t.bits, _mm_and_si128(history, _mm_set1_epi8(7)));
+                return _mm_cmpeq_epi8(_mm_and_si128(table_byte, bit), bit);
+            }
+        };
+
+        bool temporal_filter_built() { return true; }
+
+        size_t temporal_filter_smooth(uint16_t* frame, uint16_t* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p)
+        {
+            return temporal_filter_kernels<avx2_ops>::smooth(frame, last_frame, history, count, p);
+        }
+
+        size_t temporal_filter_smooth(float* frame, float* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p)
+        {
+            return temporal_filter_kernels<avx2_ops>::smooth(frame, last_frame, history, count, p);
+        }
+#else
+        bool temporal_filter_built() { return false; }
+        size_t temporal_filter_smooth(uint16_t*, uint16_t*, uint8_t*, size_t, const temporal_filter_params&) { return 0; }
+        size_t temporal_filter_smooth(float*, float*, uint8_t*, size_t, const temporal_filter_params&) { return 0; }
+#endif
+    }
+}
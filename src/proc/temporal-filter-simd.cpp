@@ -0,0 +1,153 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "temporal-filter-simd.h"
+#include "simd-support.h"
+
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TEMPORAL_FILTER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace librealsense
+{
+    temporal_filter_params::temporal_filter_params(float alpha, float one_minus_alpha, float delta_z, uint8_t mask, const uint8_t* persistence_map)
+        : alpha(alpha), one_minus_alpha(one_minus_alpha), delta_z(delta_z), mask(mask)
+    {
+        memset(persistence_bits, 0, sizeof(persistence_bits));
+        for (int h = 0; h < 256; ++h)
+            if (persistence_map[h] & mask)
+                persistence_bits[h >> 3] |= uint8_t(1 << (h & 7));
+    }
+
+#ifdef TEMPORAL_FILTER_NEON
+    struct neon_ops
+    {
+        typedef float32x4_t V;
+        typedef uint32x4_t M;
+        typedef uint8x16_t B;
+        static const size_t L = 4;
+
+        static V set1(float f) { return vdupq_n_f32(f); }
+
+        static void load(const float* p, V* v)
+        {
+            for (int k = 0; k < 4; ++k)
+                v[k] = vld1q_f32(p + 4 * k);
+        }
+        static void store(float* p, const V* v)
+        {
+            for (int k = 0; k < 4; ++k)
+                vst1q_f32(p + 4 * k, v[k]);
+        }
+        static void load(const uint16_t* p, V* v)
+        {
+            uint16x8_t low = vld1q_u16(p), high = vld1q_u16(p + 8);
+            v[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(low)));
+            v[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(low)));
+            v[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(high)));
+            v[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(high)));
+        }
+        static void store(uint16_t* p, const V* v)
+        {
+            // The conversion truncates, as the scalar cast does
+            vst1q_u16(p, vcombine_u16(vmovn_u32(vcvtq_u32_f32(v[0])), vmovn_u32(vcvtq_u32_f32(v[1]))));
+            vst1q_u16(p + 8, vcombine_u16(vmovn_u32(vcvtq_u32_f32(v[2])), vmovn_u32(vcvtq_u32_f32(v[3]))));
+        }
+
+        static M nonzero(V v) { return vmvnq_u32(vceqq_f32(v, vdupq_n_f32(0.f))); }
+        static M less(V a, V b) { return vcltq_f32(a, b); }
+        static M and_(M a, M b) { return vandq_u32(a, b); }
+        static V select(M m, V a, V b) { return vbslq_f32(m, a, b); }
+        static V mul(V a, V b) { return vmulq_f32(a, b); }
+        // Not vmlaq_f32, which may be fused and would round differently from the scalar code
+        static V add(V a, V b) { return vaddq_f32(a, b); }
+        static V abs_diff(V a, V b) { return vabsq_f32(vsubq_f32(a, b)); }
+
+        static B to_bytes(const M* m)
+        {
+            uint16x8_t low = vcombine_u16(vmovn_u32(m[0]), vmovn_u32(m[1]));
+            uint16x8_t high = vcombine_u16(vmovn_u32(m[2]), vmovn_u32(m[3]));
+            return vcombine_u8(vmovn_u16(low), vmovn_u16(high));
+        }
+        static void from_bytes(B b, M* m)
+        {
+            int16x8_t low = vmovl_s8(vget_low_s8(vreinterpretq_s8_u8(b)));
+            int16x8_t high = vmovl_s8(vget_high_s8(vreinterpretq_s8_u8(b)));
+            m[0] = vreinterpretq_u32_s32(vmovl_s16(vget_low_s16(low)));
+            m[1] = vreinterpretq_u32_s32(vmovl_s16(vget_high_s16(low)));
+            m[2] = vreinterpretq_u32_s32(vmovl_s16(vget_low_s16(high)));
+            m[3] = vreinterpretq_u32_s32(vmovl_s16(vget_high_s16(high)));
+        }
+
+        static B load_bytes(const uint8_t* p) { return vld1q_u8(p); }
+        static void store_bytes(uint8_t* p, B b) { vst1q_u8(p, b); }
+        static B set1_bytes(uint8_t v) { return vdupq_n_u8(v); }
+        static B and_bytes(B a, B b) { return vandq_u8(a, b); }
+        static B or_bytes(B a, B b) { return vorrq_u8(a, b); }
+        static B andnot_bytes(B a, B b) { return vbicq_u8(b, a); }
+        static B select_bytes(B m, B a, B b) { return vbslq_u8(m, a, b); }
+
+        struct lut
+        {
+            uint8x8x4_t table;
+
+            explicit lut(const uint8_t* bits)
+            {
+                for (int k = 0; k < 4; ++k)
+                    table.val[k] = vld1_u8(bits + 8 * k);
+            }
+        };
+
+        // Byte h >> 3 of the table holds the bit of history h
+        static B persistent(const lut& t, B history)
+        {
+            uint8x16_t byte_index = vshrq_n_u8(history, 3);
+            uint8x16_t table_byte = vcombine_u8(vtbl4_u8(t.table, vget_low_u8(byte_index)),
+                                                vtbl4_u8(t.table, vget_high_u8(byte_index)));
+            uint8x16_t bit = vshlq_u8(vdupq_n_u8(1), vreinterpretq_s8_u8(vandq_u8(history, vdupq_n_u8(7))));
+            return vtstq_u8(table_byte, bit);
+        }
+    };
+    typedef temporal_filter_kernels<neon_ops> kernels;
+#endif
+
+    static bool use_avx2()
+    {
+        static const bool do_avx2 = avx2::temporal_filter_built() && avx2_supported();
+        return do_avx2;
+    }
+
+    bool temporal_filter_simd_supported()
+    {
+#ifdef TEMPORAL_FILTER_NEON
+        return true;
+#else
+        return use_avx2();
+#endif
+    }
+
+    size_t temporal_filter_smooth_simd(uint16_t* frame, uint16_t* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p)
+    {
+        if (use_avx2())
+            return avx2::temporal_filter_smooth(frame, last_frame, history, count, p);
+#ifdef TEMPORAL_FILTER_NEON
+        return kernels::smooth(frame, last_frame, history, count, p);
+#else
+        return 0;
+#endif
+    }
+
+    size_t temporal_filter_smooth_simd(float* frame, float* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p)
+    {
+        if (use_avx2())
+            return avx2::temporal_filter_smooth(frame, last_frame, history, count, p);
+#ifdef TEMPORAL_FILTER_NEON
+        return kernels::smooth(frame, last_frame, history, count, p);
+#else
+        return 0;
+#endif
+    }
+}
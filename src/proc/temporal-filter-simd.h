@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+// Vectorized per-pixel pass of the temporal filter, for depth (uint16) and disparity (float) data
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    struct temporal_filter_params
+    {
+        float alpha, one_minus_alpha, delta_z;
+        uint8_t mask;                   // The history bit of the current frame
+        uint8_t persistence_bits[32];   // Bit h of the table is set when history h is persistent for 'mask'
+
+        temporal_filter_params(float alpha, float one_minus_alpha, float delta_z, uint8_t mask, const uint8_t* persistence_map);
+    };
+
+    // Whether a SIMD implementation is available for the running CPU
+    bool temporal_filter_simd_supported();
+
+    // Produce the same output (frame, last frame and history) as temporal_filter::temp_jw_smooth,
+    // for the leading pixels of the given range. Return the number of pixels processed, a multiple
+    // of TEMPORAL_FILTER_BLOCK; the rest is left to the caller
+    size_t temporal_filter_smooth_simd(uint16_t* frame, uint16_t* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p);
+    size_t temporal_filter_smooth_simd(float* frame, float* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p);
+
+    // Pixels handled by a single iteration of the kernels: one vector of history bytes
+    const size_t TEMPORAL_FILTER_BLOCK = 16;
+
+    namespace avx2
+    {
+        // Implemented in temporal-filter-avx.cpp. temporal_filter_built() tells whether it was built
+        // with AVX2 code generation; its kernels may only be called when avx2_supported() as well
+        bool temporal_filter_built();
+        size_t temporal_filter_smooth(uint16_t* frame, uint16_t* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p);
+        size_t temporal_filter_smooth(float* frame, float* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p);
+    }
+
+    // The temporal filter, restated with masks instead of branches. With cur and prev the pixel in
+    // the current and the last frame:
+    //     agree   = cur && prev && |cur - prev| < delta_z
+    //     persist = !cur && prev && the history is persistent for the current frame
+    //     frame   = agree ? alpha * cur + (1 - alpha) * prev : persist ? prev : cur
+    //     last    = agree ? frame : cur ? cur : prev
+    //     history = cur ? (agree ? history | mask : mask) : history & ~mask
+    // Pixels are computed as floats (uint16 values are exact) in vectors of L lanes, and the history
+    // of a block of TEMPORAL_FILTER_BLOCK pixels is held in a vector of bytes, where the persistence
+    // of each pixel is looked up in the 256-bit persistence_bits table with byte shuffles.
+    //
+    // SIMD must provide float vectors V of L lanes, lane masks M and byte vectors B, with:
+    //  - load/store of BLOCK / L vectors from uint16 and float pixels (uint16 stores truncate),
+    //    load_bytes/store_bytes,
+    //  - nonzero, less, and_, select (lanes of M), mul, add, abs_diff (lanes of V),
+    //  - to_bytes(M[]) narrowing BLOCK lane masks to byte masks, and from_bytes widening them back,
+    //  - set1_bytes, and_bytes, or_bytes, andnot_bytes(a, b) = ~a & b, select_bytes,
+    //  - lut built from persistence_bits, and persistent(lut, history) returning a byte mask
+    template<class SIMD>
+    struct temporal_filter_kernels
+    {
+        typedef typename SIMD::V V;
+        typedef typename SIMD::M M;
+        typedef typename SIMD::B B;
+        static const size_t K = TEMPORAL_FILTER_BLOCK / SIMD::L;
+
+        template<typename T>
+        static size_t smooth(T* frame, T* last_frame, uint8_t* history, size_t count, const temporal_filter_params& p)
+        {
+            const V alpha = SIMD::set1(p.alpha);
+            const V one_minus_alpha = SIMD::set1(p.one_minus_alpha);
+            const V delta_z = SIMD::set1(p.delta_z);
+            const B mask = SIMD::set1_bytes(p.mask);
+            const typename SIMD::lut lut(p.persistence_bits);
+
+            size_t i = 0;
+            for (; i + TEMPORAL_FILTER_BLOCK <= count; i += TEMPORAL_FILTER_BLOCK)
+            {
+                V cur[K], prev[K], filtered[K], out[K], last[K];
+                M cur_valid[K], prev_valid[K], agree[K], persist[K];
+
+                SIMD::load(frame + i, cur);
+                SIMD::load(last_frame + i, prev);
+                for (size_t k = 0; k < K; ++k)
+                {
+                    cur_valid[k] = SIMD::nonzero(cur[k]);
+                    prev_valid[k] = SIMD::nonzero(prev[k]);
+                    agree[k] = SIMD::and_(SIMD::and_(cur_valid[k], prev_valid[k]),
+                                          SIMD::less(SIMD::abs_diff(cur[k], prev[k]), delta_z));
+                    filtered[k] = SIMD::add(SIMD::mul(alpha, cur[k]), SIMD::mul(one_minus_alpha, prev[k]));
+                }
+
+                B hist = SIMD::load_bytes(history + i);
+                B cur_valid_bytes = SIMD::to_bytes(cur_valid);
+                B persist_bytes = SIMD::andnot_bytes(cur_valid_bytes,
+                    SIMD::and_bytes(SIMD::to_bytes(prev_valid), SIMD::persistent(lut, hist)));
+                hist = SIMD::select_bytes(cur_valid_bytes,
+                    SIMD::select_bytes(SIMD::to_bytes(agree), SIMD::or_bytes(hist, mask), mask),
+                    SIMD::andnot_bytes(mask, hist));
+                SIMD::store_bytes(history + i, hist);
+
+                SIMD::from_bytes(persist_bytes, persist);
+                for (size_t k = 0; k < K; ++k)
+                {
+                    out[k] = SIMD::select(agree[k], filtered[k], SIMD::select(persist[k], prev[k], cur[k]));
+                    last[k] = SIMD::select(agree[k], filtered[k], SIMD::select(cur_valid[k], cur[k], prev[k]));
+                }
+                SIMD::store(frame + i, out);
+                SIMD::store(last_frame + i, last);
+            }
+            return i;
+        }
+    };
+}
@@ -102,6 +102,7 @@ namespace librealsense
 
         register_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, temporal_filter_alpha);
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, temporal_filter_delta);
+        register_processing_threads_option();
 
         on_set_persistence_control(_persistence_param);
         on_set_delta(_delta_param);
@@ -122,6 +123,27 @@ namespace librealsense
         return tgt;
     }
 
+    void temporal_filter::smooth_disparity(float* disparity, size_t width, size_t height)
+    {
+        _source_stream_profile = rs2::stream_profile();
+        if (_extension_type != RS2_EXTENSION_DISPARITY_FRAME || _width != width ||
+            _height != height || _last_frame.size() != width * height * sizeof(float))
+        {
+            _extension_type = RS2_EXTENSION_DISPARITY_FRAME;
+            _bpp = sizeof(float);
+            _width = width;
+            _height = height;
+            _stride = width * sizeof(float);
+            _current_frm_size_pixels = width * height;
+
+            _last_frame.clear();
+            _last_frame.resize(width * height * sizeof(float));
+
+            _history.clear();
+            _history.resize(width * height * sizeof(float));
+        }
+        temp_jw_smooth<float>(disparity, _last_frame.data(), _history.data());
+    }
 
     void temporal_filter::on_set_persistence_control(uint8_t val)
     {
@@ -3,6 +3,7 @@
 
 #pragma once
 #include "types.h"
+#include "temporal-filter-simd.h"
 
 namespace librealsense
 {
@@ -13,6 +14,11 @@ namespace librealsense
     public:
         temporal_filter();
 
+        // Filtering a disparity buffer of the caller in place, for fused_depth_filters. The history carries
+        // over from the previous call when of the same size, and the block configures itself again on
+        // the next frame it processes
+        void smooth_disparity(float* disparity, size_t width, size_t height);
+
     protected:
         void    update_configuration(const rs2::frame& f);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
@@ -33,52 +39,62 @@ namespace librealsense
 
             unsigned char mask = 1 << _cur_frame_index;
 
-            // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
+            const bool simd = temporal_filter_simd_supported();
+            const temporal_filter_params simd_params(_alpha_param, _one_minus_alpha, delta_z, mask, _persistence_map.data());
+
+            // pass one -- go through image and update all. Pixels are independent
+            parallel_for(_height, 1, [&](size_t first, size_t last)
             {
-                T cur_val = frame[i];
-                T prev_val = _last_frame[i];
+                size_t i = first * _width;
+                if (simd)
+                    i += temporal_filter_smooth_simd(frame + i, _last_frame + i, history + i, (last - first) * _width, simd_params);
 
-                if (cur_val)
+                for (; i < last * _width; i++)
                 {
-                    if (!prev_val)
+                    T cur_val = frame[i];
+                    T prev_val = _last_frame[i];
+
+                    if (cur_val)
                     {
-                        _last_frame[i] = cur_val;
-                        history[i] = mask;
-                    }
-                    else
-                    {  // old and new val
-                        T diff = static_cast<T>(fabs(cur_val - prev_val));
-
-                        if (diff < delta_z)
-                        {  // old and new val agree
-                            history[i] |= mask;
-                            float filtered = _alpha_param * cur_val + _one_minus_alpha * prev_val;
-                            T result = static_cast<T>(filtered);
-                            frame[i] = result;
-                            _last_frame[i] = result;
-                        }
-                        else
+                        if (!prev_val)
                         {
                             _last_frame[i] = cur_val;
                             history[i] = mask;
                         }
+                        else
+                        {  // old and new val
+                            T diff = static_cast<T>(fabs(cur_val - prev_val));
+
+                            if (diff < delta_z)
+                            {  // old and new val agree
+                                history[i] |= mask;
+                                float filtered = _alpha_param * cur_val + _one_minus_alpha * prev_val;
+                                T result = static_cast<T>(filtered);
+                                frame[i] = result;
+                                _last_frame[i] = result;
+                            }
+                            else
+                            {
+                                _last_frame[i] = cur_val;
+                                history[i] = mask;
+                            }
+                        }
                     }
-                }
-                else
-                {  // no cur_val
-                    if (prev_val)
-                    { // only case we can help
-                        unsigned char hist = history[i];
-                        unsigned char classification = _persistence_map[hist];
-                        if (classification & mask)
-                        { // we have had enough samples lately
-                            frame[i] = prev_val;
+                    else
+                    {  // no cur_val
+                        if (prev_val)
+                        { // only case we can help
+                            unsigned char hist = history[i];
+                            unsigned char classification = _persistence_map[hist];
+                            if (classification & mask)
+                            { // we have had enough samples lately
+                                frame[i] = prev_val;
+                            }
                         }
+                        history[i] &= ~mask;
                     }
-                    history[i] &= ~mask;
                 }
-            }
+            });
 
             _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
@@ -31,6 +31,8 @@ namespace librealsense
             std::make_shared<min_distance_option>(
                 min_opt,
                 max_opt));
+
+        register_processing_threads_option();
     }
 
     rs2::frame threshold::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -46,6 +48,32 @@ namespace librealsense
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
+
+        // Borrowed pixels that their owner lets us write over are thresholded in place, without a new frame
+        auto in_place = dynamic_cast<librealsense::depth_frame*>((librealsense::frame_interface*)f.get());
+        if (in_place && in_place->external_data.writable)
+        {
+            auto depth_data = (uint16_t*)in_place->get_frame_data();
+            auto du = in_place->get_units();
+            auto stride = vf.get_stride_in_bytes() / sizeof(uint16_t);
+
+            parallel_for(height, 1, [&](size_t first, size_t last)
+            {
+                for (auto y = first; y < last; y++)
+                {
+                    auto row = depth_data + y * stride;
+                    for (auto x = 0; x < width; x++)
+                    {
+                        auto dist = du * row[x];
+                        if (dist < _min || dist > _max) row[x] = 0;
+                    }
+                }
+            });
+
+            // Other holders of the frame see its pixels change, but not its profile
+            return f;
+        }
+
         auto new_f = source.allocate_video_frame(_target_stream_profile, f,
             vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
@@ -60,12 +88,15 @@ namespace librealsense
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-            for (int i = 0; i < width * height; i++)
+            parallel_for(height, 1, [&](size_t first, size_t last)
             {
-                auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
-            }
+                memset(new_data + first * width, 0, (last - first) * width * sizeof(uint16_t));
+                for (auto i = first * width; i < last * width; i++)
+                {
+                    auto dist = du * depth_data[i];
+                    if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
+                }
+            });
 
             return new_f;
         }
@@ -14,6 +14,8 @@ namespace librealsense
     {
         _stream_filter.format = RS2_FORMAT_DISTANCE;
         _stream_filter.stream = RS2_STREAM_DEPTH;
+
+        register_processing_threads_option();
     }
 
     void units_transform::update_configuration(const rs2::frame& f)
@@ -64,12 +66,15 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, _width * _height * sizeof(float));
-            for (int i = 0; i < _width * _height; i++)
+            const float depth_units = *_depth_units;
+            parallel_for(_height, 1, [&](size_t first, size_t last)
             {
-                float dist = *_depth_units * depth_data[i];
-                new_data[i] = dist;
-            }
+                for (auto i = first * _width; i < last * _width; i++)
+                {
+                    float dist = depth_units * depth_data[i];
+                    new_data[i] = dist;
+                }
+            });
 
             return new_f;
         }
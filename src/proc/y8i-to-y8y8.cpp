@@ -4,6 +4,7 @@
 #include "y8i-to-y8y8.h"
 
 #include "stream.h"
+#include "interleaved-ir-simd.h"
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -18,7 +19,10 @@ namespace librealsense
 #ifdef RS2_USE_CUDA
         rscuda::split_frame_y8_y8_from_y8i_cuda(dest, count, reinterpret_cast<const y8i_pixel *>(source));
 #else
-        split_frame(dest, count, reinterpret_cast<const y8i_pixel*>(source),
+        // Both images are written in the same pass over the source; the scalar split finishes the tail
+        auto done = int(unpack_y8i_simd(dest[0], dest[1], source, count));
+        byte * const rest[] = { dest[0] + done, dest[1] + done };
+        split_frame(rest, count - done, reinterpret_cast<const y8i_pixel*>(source) + done,
             [](const y8i_pixel & p) -> uint8_t { return p.l; },
             [](const y8i_pixel & p) -> uint8_t { return p.r; });
 #endif
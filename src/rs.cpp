@@ -25,7 +25,9 @@
 #include "proc/units-transform.h"
 #include "proc/disparity-transform.h"
 #include "proc/syncer-processing-block.h"
+#include "proc/multi-device-syncer.h"
 #include "proc/decimation-filter.h"
+#include "proc/depth-filter-chain.h"
 #include "proc/spatial-filter.h"
 #include "proc/zero-order.h"
 #include "proc/hole-filling-filter.h"
@@ -108,11 +110,14 @@ struct rs2_pipeline_profile
 struct rs2_frame_queue
 {
     explicit rs2_frame_queue(int cap)
-        : queue(cap)
+        : queue(cap, spin)
     {
     }
 
-    single_consumer_frame_queue<librealsense::frame_holder> queue;
+    // Frame queues are never peeked, and are on the path of every frame to the application. Waiting
+    // threads briefly spin, since IMU frames come in bursts of gyro and accel samples
+    static const unsigned int spin = 64;
+    single_consumer_frame_queue<librealsense::frame_holder, lock_free_queue<librealsense::frame_holder>> queue;
 };
 
 struct rs2_sensor_list
@@ -803,6 +808,29 @@ void rs2_start_cpp(const rs2_sensor* sensor, rs2_frame_callback* callback, rs2_e
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, callback)
 
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    librealsense::frame_allocator_ptr allocator;
+    if (allocate)
+    {
+        VALIDATE_NOT_NULL(deallocate);
+        allocator.reset(new librealsense::frame_allocator(allocate, deallocate, user));
+    }
+    sensor->sensor->set_frame_allocator(allocator);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocate, deallocate, user)
+
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    librealsense::frame_allocator_ptr ptr;
+    if (allocator)
+        ptr = { allocator, [](rs2_frame_allocator* p) { p->release(); } };
+    sensor->sensor->set_frame_allocator(ptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocator)
+
 void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notifications_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -843,6 +871,31 @@ int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
+rs2_time_t rs2_get_frame_trace(const rs2_frame* frame, rs2_frame_trace_stage stage, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_ENUM(stage);
+    return ((frame_interface*)frame)->get_frame_trace(stage);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, stage)
+
+unsigned long long rs2_get_latency_histogram(const rs2_stream_profile* profile, rs2_frame_trace_stage stage, unsigned long long* bins, int bins_count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(profile);
+    VALIDATE_ENUM(stage);
+    VALIDATE_NOT_NULL(bins);
+    VALIDATE_RANGE(bins_count, 1, RS2_LATENCY_HISTOGRAM_BINS);
+    return environment::get_instance().get_latency_statistics().query(profile->profile->get_unique_id(), stage, bins, bins_count);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, profile, stage, bins, bins_count)
+
+void rs2_reset_latency_histogram(const rs2_stream_profile* profile, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(profile);
+    environment::get_instance().get_latency_statistics().reset(profile->profile->get_unique_id());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, profile)
+
 rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1265,11 +1318,13 @@ const char* rs2_distortion_to_string(rs2_distortion distortion)
 const char* rs2_option_to_string(rs2_option option)                                       { return librealsense::get_string(option);       }
 const char* rs2_camera_info_to_string(rs2_camera_info info)                               { return librealsense::get_string(info);         }
 const char* rs2_timestamp_domain_to_string(rs2_timestamp_domain info)                     { return librealsense::get_string(info);         }
+const char* rs2_frame_trace_stage_to_string(rs2_frame_trace_stage stage)                  { return librealsense::get_string(stage);        }
 const char* rs2_notification_category_to_string(rs2_notification_category category)       { return librealsense::get_string(category);     }
 const char* rs2_sr300_visual_preset_to_string(rs2_sr300_visual_preset preset)             { return librealsense::get_string(preset);       }
 const char* rs2_log_severity_to_string(rs2_log_severity severity)                         { return librealsense::get_string(severity);     }
 const char* rs2_exception_type_to_string(rs2_exception_type type)                         { return librealsense::get_string(type);         }
 const char* rs2_playback_status_to_string(rs2_playback_status status)                     { return librealsense::get_string(status);       }
+const char* rs2_record_queue_policy_to_string(rs2_record_queue_policy policy)             { return librealsense::get_string(policy);       }
 const char* rs2_extension_type_to_string(rs2_extension type)                              { return librealsense::get_string(type);         }
 const char* rs2_frame_metadata_to_string(rs2_frame_metadata_value metadata)               { return librealsense::get_string(metadata);     }
 const char* rs2_extension_to_string(rs2_extension type)                                   { return rs2_extension_type_to_string(type);     }
@@ -1662,6 +1717,36 @@ rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* fi
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
 
+rs2_device* rs2_create_record_device_with_queue(const rs2_device* device, const char* file, int compression_enabled,
+    unsigned long long max_queued_bytes, rs2_record_queue_policy policy, int serialization_threads, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(file);
+    VALIDATE_ENUM(policy);
+    VALIDATE_RANGE(serialization_threads, 0, 64);
+
+    record_queue_settings settings;
+    settings.max_queued_bytes = max_queued_bytes;
+    settings.policy = policy;
+    settings.serialization_threads = static_cast<uint32_t>(serialization_threads);
+
+    return new rs2_device({
+        device->ctx,
+        device->info,
+        std::make_shared<record_device>(device->device, std::make_shared<ros_writer>(file, compression_enabled), settings)
+        });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file, compression_enabled, max_queued_bytes, policy, serialization_threads)
+
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* statistics, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(statistics);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    *statistics = record_device->get_statistics();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, statistics)
+
 void rs2_record_device_pause(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2080,6 +2165,29 @@ void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* qu
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, queue)
 
+void rs2_set_processing_block_frame_allocator(rs2_processing_block* block, rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    librealsense::frame_allocator_ptr allocator;
+    if (allocate)
+    {
+        VALIDATE_NOT_NULL(deallocate);
+        allocator.reset(new librealsense::frame_allocator(allocate, deallocate, user));
+    }
+    block->block->set_frame_allocator(allocator);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, allocate, deallocate, user)
+
+void rs2_set_processing_block_frame_allocator_cpp(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    librealsense::frame_allocator_ptr ptr;
+    if (allocator)
+        ptr = { allocator, [](rs2_frame_allocator* p) { p->release(); } };
+    block->block->set_frame_allocator(ptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, allocator)
+
 void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
@@ -2170,6 +2278,14 @@ int rs2_get_frame_points_count(const rs2_frame* frame, rs2_error** error) BEGIN_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
 
+const int* rs2_get_frame_points_indices(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    return points->get_vertex_indices();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
 rs2_processing_block* rs2_create_pointcloud(rs2_error** error) BEGIN_API_CALL
 {
     return new rs2_processing_block { pointcloud::create() };
@@ -2295,6 +2411,37 @@ rs2_processing_block* rs2_create_sequence_id_filter(rs2_error** error) BEGIN_API
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_depth_filter_chain_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::depth_filter_chain>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+rs2_processing_block* rs2_create_multi_device_sync_processing_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::multi_device_syncer>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+int rs2_get_multi_device_sync_metrics(rs2_processing_block* block, rs2_sync_device_metrics* metrics, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_LE(0, count);
+    if (count)
+        VALIDATE_NOT_NULL(metrics);
+    auto syncer = std::dynamic_pointer_cast<librealsense::multi_device_syncer>(block->block);
+    if (!syncer)
+        throw std::runtime_error("Object does not support \"librealsense::multi_device_syncer\" interface! ");
+    auto devices = syncer->get_metrics();
+    std::copy_n(devices.begin(), std::min(devices.size(), size_t(count)), metrics);
+    return static_cast<int>(devices.size());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, block, metrics, count)
+
 float rs2_get_depth_scale(rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -2445,6 +2592,14 @@ void rs2_software_sensor_on_video_frame(rs2_sensor* sensor, rs2_software_video_f
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, frame.pixels)
 
+void rs2_software_sensor_on_writable_video_frame(rs2_sensor* sensor, rs2_software_video_frame frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    auto bs = VALIDATE_INTERFACE(sensor->sensor, librealsense::software_sensor);
+    return bs->on_video_frame(frame, true);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, frame.pixels)
+
 void rs2_software_sensor_on_motion_frame(rs2_sensor* sensor, rs2_software_motion_frame frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
@@ -39,6 +39,9 @@ namespace librealsense
     })
     {
         register_option(RS2_OPTION_FRAMES_QUEUE_SIZE, _source.get_published_size_option());
+        register_option(RS2_OPTION_FRAME_POOL_WATERMARK, _source.get_pool_watermark_option());
+        register_option(RS2_OPTION_FRAME_POOL_HITS, _source.get_pool_hits_option());
+        register_option(RS2_OPTION_FRAME_POOL_MISSES, _source.get_pool_misses_option());
 
         register_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL, std::make_shared<librealsense::md_time_of_arrival_parser>());
 
@@ -112,6 +115,11 @@ namespace librealsense
         return _is_opened;
     }
 
+    void sensor_base::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        _source.set_frame_allocator(allocator);
+    }
+
     std::shared_ptr<notifications_processor> sensor_base::get_notifications_processor() const
     {
         return _notifications_processor;
@@ -251,9 +259,9 @@ namespace librealsense
     {
         auto system_time = environment::get_instance().get_time_service()->get_time();
         auto fr = std::make_shared<frame>();
-        byte* pix = (byte*)fo.pixels;
-        std::vector<byte> pixels(pix, pix + fo.frame_size);
-        fr->data = pixels;
+        // The frame only lives for the duration of the backend callback, so it can view the pixels in place
+        fr->external_data.data = (byte*)fo.pixels;
+        fr->external_data.size = fo.frame_size;
         fr->set_stream(profile);
 
         // generate additional data
@@ -282,6 +290,77 @@ namespace librealsense
     /////////////////// UVC Sensor ///////////////////////
     //////////////////////////////////////////////////////
 
+    class zero_copy_option : public bool_option
+    {
+    public:
+        zero_copy_option() : bool_option(false) {}
+
+        const char* get_description() const override
+        {
+            return "Publish raw frames (Z16, Y8, Y16) directly from the capture buffers instead of copying them. "
+                   "A capture buffer is returned to the driver only when its frame is released";
+        }
+    };
+
+    // Tracks the capture buffers of a single stream that are currently held by zero-copy frames
+    struct zero_copy_stream
+    {
+        static const int RESERVED_BUFFERS = 2; // always left to the driver so that capture never stalls
+
+        zero_copy_stream(int buffers, std::shared_ptr<std::atomic<float>> hold_ms)
+            : kernel_buffers(buffers), outstanding(0), hold_ms(hold_ms)
+        {}
+
+        // Fails when publishing one more frame in place would starve the driver; the frame is copied instead
+        bool try_acquire()
+        {
+            if (outstanding.fetch_add(1) >= kernel_buffers - RESERVED_BUFFERS)
+            {
+                --outstanding;
+                return false;
+            }
+            return true;
+        }
+
+        void cancel() { --outstanding; }
+
+        void release(float held_ms)
+        {
+            --outstanding;
+            // Moving average, only used to size the capture queue the next time the stream is opened
+            hold_ms->store(0.9f * hold_ms->load() + 0.1f * held_ms);
+        }
+
+        const int kernel_buffers;
+        std::atomic<int> outstanding;
+        std::shared_ptr<std::atomic<float>> hold_ms;
+    };
+
+    static bool is_zero_copy_format(rs2_format format)
+    {
+        // Formats that are delivered to the user without an unpacking step
+        switch (format)
+        {
+        case RS2_FORMAT_Z16:
+        case RS2_FORMAT_DISPARITY16:
+        case RS2_FORMAT_Y8:
+        case RS2_FORMAT_Y16:
+        case RS2_FORMAT_RAW8:
+        case RS2_FORMAT_RAW16:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Enough capture buffers to cover the observed hold time at the stream rate, plus the reserved ones
+    static int zero_copy_buffers_count(float hold_ms, uint32_t fps)
+    {
+        auto held = static_cast<int>(std::ceil(hold_ms * fps / 1000.f));
+        return std::max<int>(DEFAULT_V4L2_FRAME_BUFFERS + zero_copy_stream::RESERVED_BUFFERS,
+                             std::min<int>(MAX_V4L2_FRAME_BUFFERS, held + zero_copy_stream::RESERVED_BUFFERS + 1));
+    }
+
     uvc_sensor::~uvc_sensor()
     {
         try
@@ -320,12 +399,21 @@ namespace librealsense
             {
                 unsigned long long last_frame_number = 0;
                 rs2_time_t last_timestamp = 0;
+
+                int buffers = DEFAULT_V4L2_FRAME_BUFFERS;
+                std::shared_ptr<zero_copy_stream> zc_stream;
+                if (_device->supports_zero_copy() && is_zero_copy_format(req_profile_base->get_format()))
+                {
+                    if (_zero_copy->is_true())
+                        buffers = zero_copy_buffers_count(_zero_copy_hold_ms->load(), req_profile_base->get_framerate());
+                    zc_stream = std::make_shared<zero_copy_stream>(buffers, _zero_copy_hold_ms);
+                }
+
                 _device->probe_and_commit(req_profile_base->get_backend_profile(),
-                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp, zc_stream](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
                 {
                     const auto&& system_time = environment::get_instance().get_time_service()->get_time();
                     const auto&& fr = generate_frame_from_data(f, _timestamp_reader.get(), last_timestamp, last_frame_number, req_profile_base);
-                    const auto&& requires_processing = true; // TODO - Ariel add option
                     const auto&& timestamp_domain = _timestamp_reader->get_frame_timestamp_domain(fr);
                     const auto&& bpp = get_image_bpp(req_profile_base->get_format());
                     auto&& frame_counter = fr->additional_data.frame_number;
@@ -358,6 +446,8 @@ namespace librealsense
                     int width = vsp ? vsp->get_width() : 0;
                     int height = vsp ? vsp->get_height() : 0;
 
+                    const auto&& zero_copy = zc_stream && _zero_copy->is_true() && zc_stream->try_acquire();
+                    const auto&& requires_processing = !zero_copy;
                     frame_holder fh = _source.alloc_frame(stream_to_frame_types(req_profile_base->get_stream_type()), width * height * bpp / 8, fr->additional_data, requires_processing);
                     auto diff = environment::get_instance().get_time_service()->get_time() - system_time;
                     if (diff >10 )
@@ -365,14 +455,22 @@ namespace librealsense
 
                     if (fh.frame)
                     {
-                        memcpy((void*)fh->get_frame_data(), fr->data.data(), sizeof(byte)*fr->data.size());
                         auto&& video = (video_frame*)fh.frame;
+                        if (zero_copy)
+                        {
+                            video->external_data.data = (byte*)f.pixels;
+                            video->external_data.size = width * height * bpp / 8;
+                        }
+                        else
+                            memcpy((void*)fh->get_frame_data(), fr->get_frame_data(), sizeof(byte)*fr->get_frame_data_size());
                         video->assign(width, height, width * bpp / 8, bpp);
                         video->set_timestamp_domain(timestamp_domain);
                         fh->set_stream(req_profile_base);
                     }
                     else
                     {
+                        if (zero_copy)
+                            zc_stream->cancel();
                         LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
                         return;
                     }
@@ -382,14 +480,22 @@ namespace librealsense
                         LOG_DEBUG("!! Frame memcpy took " << diff << " msec");
                     if (!requires_processing)
                     {
-                        fh->attach_continuation(std::move(release_and_enqueue));
+                        // The capture buffer now belongs to the frame and is re-queued when the frame is released
+                        auto acquired = std::chrono::steady_clock::now();
+                        fh->attach_continuation(frame_continuation([zc_stream, continuation, acquired]()
+                        {
+                            continuation();
+                            std::chrono::duration<float, std::milli> held = std::chrono::steady_clock::now() - acquired;
+                            zc_stream->release(held.count());
+                        }, f.pixels));
+                        release_and_enqueue.reset();
                     }
 
                     if (fh->get_stream().get())
                     {
                         _source.invoke_callback(std::move(fh));
                     }
-                });
+                }, buffers);
             }
             catch (...)
             {
@@ -847,7 +953,7 @@ namespace librealsense
             last_frame_number = frame_counter;
             last_timestamp = timestamp;
             frame_holder frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, fr->additional_data, true);
-            memcpy((void*)frame->get_frame_data(), fr->data.data(), sizeof(byte)*fr->data.size());
+            memcpy((void*)frame->get_frame_data(), fr->get_frame_data(), sizeof(byte)*fr->get_frame_data_size());
             if (!frame)
             {
                 LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
@@ -939,10 +1045,14 @@ namespace librealsense
         : sensor_base(name, dev, (recommended_proccesing_blocks_interface*)this),
         _device(move(uvc_device)),
         _user_count(0),
-        _timestamp_reader(std::move(timestamp_reader))
+        _timestamp_reader(std::move(timestamp_reader)),
+        _zero_copy(std::make_shared<zero_copy_option>()),
+        _zero_copy_hold_ms(std::make_shared<std::atomic<float>>(0.f))
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP, make_additional_data_parser(&frame_additional_data::backend_timestamp));
         register_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE, make_additional_data_parser(&frame_additional_data::raw_size));
+        if (_device->supports_zero_copy())
+            register_option(RS2_OPTION_ZERO_COPY_CAPTURE, _zero_copy);
     }
 
     iio_hid_timestamp_reader::iio_hid_timestamp_reader()
@@ -1043,6 +1153,10 @@ namespace librealsense
         auto& raw_fourcc_to_rs2_stream_map = _raw_sensor->get_fourcc_to_rs2_stream_map();
         _fourcc_to_rs2_stream = std::make_shared<std::map<uint32_t, rs2_stream>>(fourcc_to_rs2_stream_map);
         raw_fourcc_to_rs2_stream_map = _fourcc_to_rs2_stream;
+
+        // Capture-level option, only meaningful on the raw sensor
+        if (auto zero_copy = _raw_sensor->get_option_handler(RS2_OPTION_ZERO_COPY_CAPTURE))
+            sensor_base::register_option(RS2_OPTION_ZERO_COPY_CAPTURE, zero_copy);
     }
 
     synthetic_sensor::~synthetic_sensor()
@@ -1173,17 +1287,17 @@ namespace librealsense
         return cloned;
     }
 
-    void synthetic_sensor::register_processing_block_options(const processing_block & pb)
+    void synthetic_sensor::register_processing_block_options(const std::shared_ptr<processing_block>& pb)
     {
-        // Register the missing processing block's options to the sensor
-        const auto&& options = pb.get_supported_options();
+        // Register the missing processing block's options to the sensor, until the block is released on close.
+        // Each registered option holds the block, so that it stays valid as long as the sensor exposes it
+        const auto&& options = pb->get_supported_options();
 
         for (auto&& opt : options)
         {
-            const auto&& already_registered_predicate = [&opt](const rs2_option& o) {return o == opt; };
-            if (std::none_of(begin(options), end(options), already_registered_predicate))
+            if (!supports_option(opt))
             {
-                this->register_option(opt, std::shared_ptr<option>(const_cast<option*>(&pb.get_option(opt))));
+                this->register_option(opt, std::shared_ptr<option>(pb, &pb->get_option(opt)));
                 _cached_processing_blocks_options.push_back(opt);
             }
         }
@@ -1390,7 +1504,9 @@ namespace librealsense
             // Retrieve source profile from cached map and generate the relevant processing block.
             std::unordered_set<std::shared_ptr<stream_profile_interface>> current_resolved_reqs;
             auto best_pb = best_pbf->generate();
-            register_processing_block_options(*best_pb);
+            if (_frame_allocator)
+                best_pb->set_frame_allocator(_frame_allocator);
+            register_processing_block_options(best_pb);
             for (auto&& req : best_reqs)
             {
                 auto&& target = to_profile(req.get());
@@ -1493,6 +1609,7 @@ namespace librealsense
 
         // After processing callback
         const auto&& output_cb = make_callback([&](frame_holder f) {
+            const auto&& unpacked_time = environment::get_instance().get_time_service()->get_time();
             std::vector<frame_interface*> processed_frames;
             processed_frames.push_back(f.frame);
 
@@ -1519,6 +1636,9 @@ namespace librealsense
                     else
                         continue;
 
+                    fr->update_frame_trace(RS2_FRAME_TRACE_STAGE_UNPACK_DONE, unpacked_time);
+                    fr->update_frame_trace(RS2_FRAME_TRACE_STAGE_USER_CALLBACK_START, unpacked_time);
+
                     fr->acquire();
                     _post_process_callback->on_frame((rs2_frame*)fr);
                 }
@@ -1621,6 +1741,19 @@ namespace librealsense
         return _raw_sensor->is_opened();
     }
 
+    void synthetic_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
+        _frame_allocator = allocator;
+
+        // Frames that need no conversion are published straight from the raw sensor,
+        // the rest come out of the processing blocks resolved on open()
+        _raw_sensor->set_frame_allocator(allocator);
+        for (auto&& entry : _profiles_to_processing_block)
+            for (auto&& pb : entry.second)
+                pb->set_frame_allocator(allocator);
+    }
+
     void motion_sensor::create_snapshot(std::shared_ptr<motion_sensor>& snapshot) const
     {
         snapshot = std::make_shared<motion_sensor_snapshot>();
@@ -28,6 +28,7 @@ namespace librealsense
 {
     class device;
     class option;
+    class bool_option;
 
     typedef std::function<void(std::vector<platform::stream_profile>)> on_open;
 
@@ -63,6 +64,7 @@ namespace librealsense
         virtual void set_frames_callback(frame_callback_ptr callback) override;
         bool is_streaming() const override;
         virtual bool is_opened() const;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
         virtual void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const;
         void register_on_open(on_open callback)
         {
@@ -224,6 +226,7 @@ namespace librealsense
         void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const override;
         bool is_streaming() const override;
         bool is_opened() const override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
 
     protected:
         void add_source_profiles_missing_data();
@@ -236,7 +239,7 @@ namespace librealsense
         void add_source_profile_missing_data(std::shared_ptr<stream_profile_interface>& source_profile);
         bool is_duplicated_profile(const std::shared_ptr<stream_profile_interface>& duplicate, const stream_profiles& profiles);
         std::shared_ptr<stream_profile_interface> clone_profile(const std::shared_ptr<stream_profile_interface>& profile);
-        void register_processing_block_options(const processing_block& pb);
+        void register_processing_block_options(const std::shared_ptr<processing_block>& pb);
         void unregister_processing_block_options(const processing_block& pb);
 
         std::mutex _synthetic_configure_lock;
@@ -250,6 +253,7 @@ namespace librealsense
         std::unordered_map<stream_profile, stream_profiles> _target_to_source_profiles_map;
         std::unordered_map<rs2_format, stream_profiles> _cached_requests;
         std::vector<rs2_option> _cached_processing_blocks_options;
+        frame_allocator_ptr _frame_allocator;
     };
 
     class iio_hid_timestamp_reader : public frame_timestamp_reader
@@ -390,6 +394,8 @@ namespace librealsense
         std::vector<platform::extension_unit> _xus;
         std::unique_ptr<power> _power;
         std::unique_ptr<frame_timestamp_reader> _timestamp_reader;
+        std::shared_ptr<bool_option> _zero_copy;
+        std::shared_ptr<std::atomic<float>> _zero_copy_hold_ms; // how long consumers keep zero-copy frames, used to size the kernel queue
     };
 
     processing_blocks get_color_recommended_proccesing_blocks();
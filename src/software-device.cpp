@@ -253,17 +253,29 @@ namespace librealsense
         _metadata_map[key] = value;
     }
 
-    void software_sensor::on_video_frame(rs2_software_video_frame software_frame)
+    // The frame hands the data back to its deleter once released, and so does a frame that could not be allocated
+    static void borrow_data(frame_interface* f, void* data, size_t size, void(*deleter)(void*), bool writable = false)
+    {
+        auto& buffer = dynamic_cast<frame*>(f)->external_data;
+        buffer.data = static_cast<byte*>(data);
+        buffer.size = size;
+        buffer.deleter = deleter;
+        buffer.writable = writable;
+    }
+
+    void software_sensor::on_video_frame(rs2_software_video_frame software_frame, bool writable)
     {
         if (!_is_streaming) {
             software_frame.deleter(software_frame.pixels);
             return;
         }
-        
+
         frame_additional_data data;
         data.timestamp = software_frame.timestamp;
         data.timestamp_domain = software_frame.domain;
         data.frame_number = software_frame.frame_number;
+        // Software frames are submitted in their final format
+        data.trace[RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK] = data.trace[RS2_FRAME_TRACE_STAGE_UNPACK_DONE] = _source.get_time();
 
         data.metadata_size = 0;
         for (auto i : _metadata_map)
@@ -283,34 +295,37 @@ namespace librealsense
         rs2_extension extension = software_frame.profile->profile->get_stream_type() == RS2_STREAM_DEPTH ?
             RS2_EXTENSION_DEPTH_FRAME : RS2_EXTENSION_VIDEO_FRAME;
 
-        auto frame = _source.alloc_frame(extension, 0, data, false);
+        frame_holder frame = _source.alloc_frame(extension, 0, data, false);
         if (!frame)
         {
             LOG_WARNING("Dropped video frame. alloc_frame(...) returned nullptr");
+            software_frame.deleter(software_frame.pixels);
             return;
         }
         auto vid_profile = dynamic_cast<video_stream_profile_interface*>(software_frame.profile->profile);
-        auto vid_frame = dynamic_cast<video_frame*>(frame);
+        borrow_data(frame.frame, software_frame.pixels, software_frame.stride * vid_profile->get_height(), software_frame.deleter, writable);
+        auto vid_frame = dynamic_cast<video_frame*>(frame.frame);
         vid_frame->assign(vid_profile->get_width(), vid_profile->get_height(), software_frame.stride, software_frame.bpp * 8);
 
         frame->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(software_frame.profile->profile->shared_from_this()));
-        frame->attach_continuation(frame_continuation{ [=]() {
-            software_frame.deleter(software_frame.pixels);
-        }, software_frame.pixels });
 
         auto sd = dynamic_cast<software_device*>(_owner);
         sd->register_extrinsic(*vid_profile);
-        _source.invoke_callback(frame);
+        _source.invoke_callback(std::move(frame));
     }
 
     void software_sensor::on_motion_frame(rs2_software_motion_frame software_frame)
     {
-        if (!_is_streaming) return;
+        if (!_is_streaming) {
+            software_frame.deleter(software_frame.data);
+            return;
+        }
 
         frame_additional_data data;
         data.timestamp = software_frame.timestamp;
         data.timestamp_domain = software_frame.domain;
         data.frame_number = software_frame.frame_number;
+        data.trace[RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK] = data.trace[RS2_FRAME_TRACE_STAGE_UNPACK_DONE] = _source.get_time();
 
         data.metadata_size = 0;
         for (auto i : _metadata_map)
@@ -323,27 +338,30 @@ namespace librealsense
             data.metadata_size += static_cast<uint32_t>(size_of_data);
         }
 
-        auto frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, 0, data, false);
+        frame_holder frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, 0, data, false);
         if (!frame)
         {
             LOG_WARNING("Dropped motion frame. alloc_frame(...) returned nullptr");
+            software_frame.deleter(software_frame.data);
             return;
         }
+        borrow_data(frame.frame, software_frame.data, 3 * sizeof(float), software_frame.deleter);
         frame->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(software_frame.profile->profile->shared_from_this()));
-        frame->attach_continuation(frame_continuation{ [=]() {
-            software_frame.deleter(software_frame.data);
-        }, software_frame.data });
-        _source.invoke_callback(frame);
+        _source.invoke_callback(std::move(frame));
     }
 
     void software_sensor::on_pose_frame(rs2_software_pose_frame software_frame)
     {
-        if (!_is_streaming) return;
+        if (!_is_streaming) {
+            software_frame.deleter(software_frame.data);
+            return;
+        }
 
         frame_additional_data data;
         data.timestamp = software_frame.timestamp;
         data.timestamp_domain = software_frame.domain;
         data.frame_number = software_frame.frame_number;
+        data.trace[RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK] = data.trace[RS2_FRAME_TRACE_STAGE_UNPACK_DONE] = _source.get_time();
 
         data.metadata_size = 0;
         for (auto i : _metadata_map)
@@ -356,17 +374,16 @@ namespace librealsense
             data.metadata_size += static_cast<uint32_t>(size_of_data);
         }
 
-        auto frame = _source.alloc_frame(RS2_EXTENSION_POSE_FRAME, 0, data, false);
+        frame_holder frame = _source.alloc_frame(RS2_EXTENSION_POSE_FRAME, 0, data, false);
         if (!frame)
         {
             LOG_WARNING("Dropped pose frame. alloc_frame(...) returned nullptr");
+            software_frame.deleter(software_frame.data);
             return;
         }
+        borrow_data(frame.frame, software_frame.data, sizeof(rs2_software_pose_frame::pose_frame_info), software_frame.deleter);
         frame->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(software_frame.profile->profile->shared_from_this()));
-        frame->attach_continuation(frame_continuation{ [=]() {
-            software_frame.deleter(software_frame.data);
-        }, software_frame.data });
-        _source.invoke_callback(frame);
+        _source.invoke_callback(std::move(frame));
     }
 
     void software_sensor::on_notification(rs2_software_notification notif)
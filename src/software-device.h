@@ -105,7 +105,8 @@ namespace librealsense
         void start(frame_callback_ptr callback) override;
         void stop() override;
 
-        void on_video_frame(rs2_software_video_frame frame);
+        // The frames borrow the data they are given, see external_frame_buffer
+        void on_video_frame(rs2_software_video_frame frame, bool writable = false);
         void on_motion_frame(rs2_software_motion_frame frame);
         void on_pose_frame(rs2_software_pose_frame frame);
         void on_notification(rs2_software_notification notif);
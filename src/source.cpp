@@ -36,14 +36,114 @@ namespace librealsense
         std::atomic<uint32_t>* _ptr;
     };
 
+    class frame_pool_watermark : public option_base
+    {
+    public:
+        frame_pool_watermark(std::atomic<uint32_t>* ptr, const option_range& opt_range)
+            : option_base(opt_range),
+              _ptr(ptr)
+        {}
+
+        void set(float value) override
+        {
+            if (!is_valid(value))
+                throw invalid_value_exception(to_string() << "set(frame_pool_watermark) failed! Given value " << value << " is out of range.");
+
+            *_ptr = static_cast<uint32_t>(value);
+            _recording_function(*this);
+        }
+
+        float query() const override { return static_cast<float>(_ptr->load()); }
+
+        bool is_enabled() const override { return true; }
+
+        const char* get_description() const override
+        {
+            return "Max number of released frame buffers kept for reuse per frame size. Set to 0 to disable buffer recycling";
+        }
+    private:
+        std::atomic<uint32_t>* _ptr;
+    };
+
+    class frame_pool_counter : public readonly_option
+    {
+    public:
+        frame_pool_counter(std::function<uint64_t()> counter, std::string description)
+            : _counter(counter), _description(std::move(description))
+        {}
+
+        float query() const override { return static_cast<float>(_counter()); }
+
+        option_range get_range() const override { return { 0, std::numeric_limits<float>::max(), 1, 0 }; }
+
+        bool is_enabled() const override { return true; }
+
+        const char* get_description() const override { return _description.c_str(); }
+    private:
+        std::function<uint64_t()> _counter;
+        std::string _description;
+    };
+
     std::shared_ptr<option> frame_source::get_published_size_option()
     {
         return std::make_shared<frame_queue_size>(&_max_publish_list_size, option_range{ 0, 32, 1, 16 });
     }
 
+    std::shared_ptr<option> frame_source::get_pool_watermark_option()
+    {
+        return std::make_shared<frame_pool_watermark>(&_pool_watermark,
+            option_range{ 0, frame_buffer_pool::SLOTS_PER_BUCKET, 1, 16 });
+    }
+
+    std::shared_ptr<option> frame_source::get_pool_hits_option()
+    {
+        return std::make_shared<frame_pool_counter>([this]() { return get_pool_stats().hits; },
+            "Number of frame allocations served from recycled buffers");
+    }
+
+    std::shared_ptr<option> frame_source::get_pool_misses_option()
+    {
+        return std::make_shared<frame_pool_counter>([this]() { return get_pool_stats().misses; },
+            "Number of frame allocations that required new memory");
+    }
+
+    frame_pool_stats frame_source::get_pool_stats() const
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+
+        frame_pool_stats total;
+        for (auto&& kvp : _archive)
+        {
+            if (!kvp.second) continue;
+            auto stats = kvp.second->get_pool_stats();
+            total.hits += stats.hits;
+            total.misses += stats.misses;
+        }
+        return total;
+    }
+
+    static bool supports_frame_allocator(rs2_extension type)
+    {
+        return type == RS2_EXTENSION_VIDEO_FRAME
+            || type == RS2_EXTENSION_DEPTH_FRAME
+            || type == RS2_EXTENSION_DISPARITY_FRAME;
+    }
+
+    void frame_source::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        _frame_allocator = allocator;
+        for (auto&& kvp : _archive)
+        {
+            if (kvp.second && supports_frame_allocator(kvp.first))
+                kvp.second->set_frame_allocator(allocator);
+        }
+    }
+
     frame_source::frame_source(uint32_t max_publish_list_size)
             : _callback(nullptr, [](rs2_frame_callback*) {}),
               _max_publish_list_size(max_publish_list_size),
+              _pool_watermark(16),
               _ts(environment::get_instance().get_time_service())
     {}
 
@@ -61,7 +161,9 @@ namespace librealsense
 
         for (auto type : supported)
         {
-            _archive[type] = make_archive(type, &_max_publish_list_size, _ts, metadata_parsers);
+            _archive[type] = make_archive(type, &_max_publish_list_size, &_pool_watermark, _ts, metadata_parsers);
+            if (_frame_allocator && supports_frame_allocator(type))
+                _archive[type]->set_frame_allocator(_frame_allocator);
         }
 
         _metadata_parsers = metadata_parsers;
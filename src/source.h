@@ -25,6 +25,14 @@ namespace librealsense
         void reset();
 
         std::shared_ptr<option> get_published_size_option();
+        std::shared_ptr<option> get_pool_watermark_option();
+        std::shared_ptr<option> get_pool_hits_option();
+        std::shared_ptr<option> get_pool_misses_option();
+
+        frame_pool_stats get_pool_stats() const;
+
+        // Applies to video, depth and disparity frames; persists across init()
+        void set_frame_allocator(frame_allocator_ptr allocator);
 
         frame_interface* alloc_frame(rs2_extension type, size_t size, frame_additional_data additional_data, bool requires_memory) const;
 
@@ -44,7 +52,7 @@ namespace librealsense
         template<class T>
         void add_extension(rs2_extension ex)
         {
-            _archive[ex] = std::make_shared<frame_archive<T>>(&_max_publish_list_size, _ts, _metadata_parsers);
+            _archive[ex] = std::make_shared<frame_archive<T>>(&_max_publish_list_size, &_pool_watermark, _ts, _metadata_parsers);
         }
 
         void set_max_publish_list_size(int qsize) {_max_publish_list_size = qsize; }
@@ -57,8 +65,10 @@ namespace librealsense
         std::map<rs2_extension, std::shared_ptr<archive_interface>> _archive;
 
         std::atomic<uint32_t> _max_publish_list_size;
+        std::atomic<uint32_t> _pool_watermark;
         frame_callback_ptr _callback;
         std::shared_ptr<platform::time_service> _ts;
         std::shared_ptr<metadata_parser_map> _metadata_parsers;
+        frame_allocator_ptr _frame_allocator;
     };
 }
@@ -214,7 +214,10 @@ namespace librealsense
                 else if(!matcher->get_active())
                 {
                      matcher->set_active(true);
-                     _frames_queue[matcher.get()].start();
+                     // Queues are created on their first frame, and only by the matchers that use them
+                     auto q = _frames_queue.find(matcher.get());
+                     if (q != _frames_queue.end())
+                         q->second.start();
                 }
             }
         }
@@ -608,6 +611,299 @@ namespace librealsense
         return abs(a - b) < ((float)gap / (float)2) ;
     }
 
+    indexed_timestamp_composite_matcher::indexed_timestamp_composite_matcher(std::vector<std::shared_ptr<matcher>> matchers)
+        : timestamp_composite_matcher(matchers)
+    {
+        _name = create_composite_name(matchers, "ITS: ");
+    }
+
+    void indexed_timestamp_composite_matcher::dispatch(frame_holder f, syncronization_environment env)
+    {
+        // As composite_matcher::dispatch, without formatting every frame for the log
+        clean_inactive_streams(f);
+        auto matcher = find_matcher(f);
+        update_last_arrived(f, matcher.get());
+        matcher->dispatch(std::move(f), env);
+    }
+
+    void indexed_timestamp_composite_matcher::index_head(matcher* m, stream_queue& q)
+    {
+        auto&& head = q.frames.front();
+        q.generation = ++_generation;
+        q.head_domain = head->get_frame_timestamp_domain();
+        ++_heads_per_domain[q.head_domain];
+
+        auto fps = get_fps(head);
+        if (!_min_fps || fps < _min_fps)
+            _min_fps = fps;
+
+        // Entries are invalidated rather than removed, rebuild the index before it fills with stale ones
+        if (_index.size() > 2 * _queues.size() + 16)
+        {
+            _index.clear();
+            for (auto&& kvp : _queues)
+                if (!kvp.second.frames.empty())
+                    _index.push_back({ kvp.second.frames.front()->get_frame_timestamp(), kvp.first, kvp.second.generation });
+            std::make_heap(_index.begin(), _index.end());
+        }
+        else
+        {
+            _index.push_back({ head->get_frame_timestamp(), m, q.generation });
+            std::push_heap(_index.begin(), _index.end());
+        }
+    }
+
+    void indexed_timestamp_composite_matcher::push(matcher* m, frame_holder f)
+    {
+        auto&& q = _queues[m];
+        q.frames.push_back(std::move(f));
+        if (q.frames.size() == 1)
+        {
+            ++_heads;
+            _empty_queues.erase(m);
+            index_head(m, q);
+        }
+        else if (q.frames.size() > size_t(QUEUE_MAX_SIZE))
+        {
+            // As the queues of composite_matcher, the oldest frame makes room for the new one. The next one
+            // becomes the head, and is indexed in its place
+            LOG_DEBUG(_name << " queue of stream " << (m->get_streams().empty() ? -1 : m->get_streams()[0]) << " is full, oldest frame dropped");
+            pop(m);
+        }
+    }
+
+    frame_holder indexed_timestamp_composite_matcher::pop(matcher* m)
+    {
+        auto&& q = _queues[m];
+        frame_holder f = std::move(q.frames.front());
+        q.frames.pop_front();
+        --_heads_per_domain[q.head_domain];
+
+        if (q.frames.empty())
+        {
+            --_heads;
+            q.generation = ++_generation;
+            q.head_domain = RS2_TIMESTAMP_DOMAIN_COUNT;
+            _empty_queues.insert(m);
+        }
+        else
+            index_head(m, q);
+        return f;
+    }
+
+    void indexed_timestamp_composite_matcher::drop_queue(matcher* m)
+    {
+        auto it = _queues.find(m);
+        if (it == _queues.end())
+            return;
+        if (!it->second.frames.empty())
+        {
+            --_heads;
+            --_heads_per_domain[it->second.head_domain];
+        }
+        _empty_queues.erase(m);
+        _queues.erase(it);
+    }
+
+    void indexed_timestamp_composite_matcher::drop_replaced_queues()
+    {
+        // find_matcher replaces the matchers of the streams of a device when it first sees it
+        std::set<matcher*> current;
+        for (auto&& kvp : _matchers)
+            current.insert(kvp.second.get());
+
+        std::vector<matcher*> replaced;
+        for (auto&& kvp : _queues)
+            if (!current.count(kvp.first))
+                replaced.push_back(kvp.first);
+        for (auto m : replaced)
+            drop_queue(m);
+    }
+
+    bool indexed_timestamp_composite_matcher::earliest_head(index_entry& entry)
+    {
+        while (!_index.empty())
+        {
+            entry = _index.front();
+            auto it = _queues.find(entry.m);
+            if (it != _queues.end() && it->second.generation == entry.generation)
+                return true;
+            std::pop_heap(_index.begin(), _index.end());
+            _index.pop_back();
+        }
+        return false;
+    }
+
+    bool indexed_timestamp_composite_matcher::select(std::vector<matcher*>& synced)
+    {
+        int domains = 0;
+        for (auto heads : _heads_per_domain)
+            domains += heads > 0;
+        if (domains > 1)
+            return select_by_scan(synced);
+
+        index_entry first;
+        if (!earliest_head(first))
+            return false;
+
+        // Only the heads within the widest equivalence window of the earliest one can match it
+        auto window = _min_fps ? 1000.f / (float)_min_fps / 2 : std::numeric_limits<float>::max();
+        auto&& first_frame = _queues[first.m].frames.front();
+
+        std::vector<index_entry> candidates;
+        index_entry entry;
+        while (earliest_head(entry) && entry.timestamp - first.timestamp <= window)
+        {
+            std::pop_heap(_index.begin(), _index.end());
+            _index.pop_back();
+            candidates.push_back(entry);
+
+            if (entry.m == first.m || are_equivalent(first_frame, _queues[entry.m].frames.front()))
+                synced.push_back(entry.m);
+        }
+        for (auto&& c : candidates)
+        {
+            _index.push_back(c);
+            std::push_heap(_index.begin(), _index.end());
+        }
+
+        // Heads that do not match the earliest one are newer frames, which the match should not wait for
+        return synced.size() < _heads;
+    }
+
+    bool indexed_timestamp_composite_matcher::select_by_scan(std::vector<matcher*>& synced)
+    {
+        // The loop of composite_matcher::sync, over the heads
+        frame_holder* curr_sync = nullptr;
+        auto old_frames = false;
+        for (auto&& kvp : _queues)
+        {
+            if (kvp.second.frames.empty())
+                continue;
+
+            auto&& f = kvp.second.frames.front();
+            if (!curr_sync)
+            {
+                curr_sync = &f;
+                synced.push_back(kvp.first);
+            }
+            else if (are_equivalent(*curr_sync, f))
+                synced.push_back(kvp.first);
+            else if (is_smaller_than(f, *curr_sync))
+            {
+                old_frames = true;
+                synced.clear();
+                synced.push_back(kvp.first);
+                curr_sync = &f;
+            }
+            else
+                old_frames = true;
+        }
+        return old_frames;
+    }
+
+    void indexed_timestamp_composite_matcher::sync(frame_holder f, syncronization_environment env)
+    {
+        update_next_expected(f);
+        auto matcher = find_matcher(f).get();
+        if (!_queues.count(matcher))
+            drop_replaced_queues();
+        push(matcher, std::move(f));
+
+        std::vector<librealsense::matcher*> synced;
+        while (_heads)
+        {
+            synced.clear();
+            auto old_frames = select(synced);
+
+            if (!old_frames)
+            {
+                for (auto missing : _empty_queues)
+                {
+                    if (!skip_missing_stream(synced, missing))
+                    {
+                        LOG_DEBUG(_name << " wait for missing stream " << (missing->get_streams().empty() ? -1 : missing->get_streams()[0])
+                                        << " next expected " << std::fixed << _next_expected[missing]);
+                        synced.clear();
+                        break;
+                    }
+                }
+            }
+            if (synced.empty())
+                break;
+
+            std::vector<frame_holder> match;
+            match.reserve(synced.size());
+            for (auto m : synced)
+                match.push_back(pop(m));
+
+            std::sort(match.begin(), match.end(), [](const frame_holder& f1, const frame_holder& f2)
+            {
+                return ((frame_interface*)f1)->get_stream()->get_unique_id() > ((frame_interface*)f2)->get_stream()->get_unique_id();
+            });
+
+            frame_holder composite = env.source->allocate_composite_frame(std::move(match));
+            if (composite.frame)
+            {
+                auto cb = begin_callback();
+                _callback(std::move(composite), env);
+            }
+        }
+    }
+
+    void indexed_timestamp_composite_matcher::clean_inactive_streams(frame_holder& f)
+    {
+        if (f.is_blocking())
+            return;
+
+        // As timestamp_composite_matcher::clean_inactive_streams, checking the streams at most every half of the
+        // shortest inactivity threshold rather than on each arrival
+        auto now = environment::get_instance().get_time_service()->get_time();
+        if (now < _next_inactivity_check)
+            return;
+
+        double shortest_threshold = 500;
+        std::vector<matcher*> dead_matchers;
+        for (auto&& m : _matchers)
+        {
+            auto fps = _fps[m.second.get()];
+            double threshold = fps ? (1000 / fps) * 5 : 500;
+            shortest_threshold = std::min(shortest_threshold, threshold);
+            if (_last_arrived[m.second.get()] && (now - _last_arrived[m.second.get()]) > threshold)
+            {
+                LOG_DEBUG("clean inactive stream " << m.first << " in " << _name);
+                dead_matchers.push_back(m.second.get());
+                m.second->set_active(false);
+            }
+        }
+
+        for (auto m : dead_matchers)
+            drop_queue(m);
+        _next_inactivity_check = now + shortest_threshold / 2;
+    }
+
+    bool indexed_timestamp_composite_matcher::skip_missing_stream(std::vector<matcher*> synced, matcher* missing)
+    {
+        // As timestamp_composite_matcher::skip_missing_stream, over the queues of this matcher
+        if (!missing->get_active())
+            return true;
+
+        auto&& synced_frame = _queues[synced[0]].frames.front();
+        auto next_expected = _next_expected[missing];
+
+        auto it = _next_expected_domain.find(missing);
+        if (it != _next_expected_domain.end() && it->second != synced_frame->get_frame_timestamp_domain())
+            return false;
+
+        auto fps = get_fps(synced_frame);
+        auto gap = 1000.f / (float)fps;
+        // next expected of the missing stream didn't update yet
+        if (synced_frame->get_frame_timestamp() > next_expected && abs(synced_frame->get_frame_timestamp() - next_expected) < gap * 10)
+            return false;
+
+        return !are_equivalent(synced_frame->get_frame_timestamp(), next_expected, fps);
+    }
+
     composite_identity_matcher::composite_identity_matcher(std::vector<std::shared_ptr<matcher>> matchers) :composite_matcher(matchers, "CI: ")
     {}
 
@@ -7,9 +7,11 @@
 #include "archive.h"
 
 #include <stdint.h>
+#include <deque>
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <set>
 
 namespace librealsense
 {
@@ -178,11 +180,62 @@ namespace librealsense
         bool skip_missing_stream(std::vector<matcher*> synced, matcher* missing) override;
         void update_next_expected(const frame_holder & f) override;
 
-    private:
+    protected:
         unsigned int get_fps(const frame_holder & f);
         bool are_equivalent(double a, double b, int fps);
         std::map<matcher*, double> _last_arrived;
         std::map<matcher*, unsigned int> _fps;
 
     };
+
+    // Timestamp matcher for syncing many streams. The heads of the stream queues are indexed by a min-heap of
+    // their timestamps, so that an arrival is matched without rescanning every queue: the earliest head is
+    // matched with the heads equivalent to it, following the rules of timestamp_composite_matcher. When the
+    // heads are in different timestamp domains, they are compared by time of arrival and scanned instead.
+    class indexed_timestamp_composite_matcher : public timestamp_composite_matcher
+    {
+    public:
+        indexed_timestamp_composite_matcher(std::vector<std::shared_ptr<matcher>> matchers);
+
+        void dispatch(frame_holder f, syncronization_environment env) override;
+        void sync(frame_holder f, syncronization_environment env) override;
+        void clean_inactive_streams(frame_holder& f) override;
+        bool skip_missing_stream(std::vector<matcher*> synced, matcher* missing) override;
+
+    private:
+        struct stream_queue
+        {
+            std::deque<frame_holder> frames;
+            unsigned long long generation = 0; // of the head, its entry in the index is stale once it changes
+            rs2_timestamp_domain head_domain = RS2_TIMESTAMP_DOMAIN_COUNT;
+        };
+
+        struct index_entry
+        {
+            double timestamp;
+            matcher* m;
+            unsigned long long generation;
+
+            // std::push_heap builds a max-heap
+            bool operator<(const index_entry& other) const { return timestamp > other.timestamp; }
+        };
+
+        void push(matcher* m, frame_holder f);
+        frame_holder pop(matcher* m);
+        void index_head(matcher* m, stream_queue& q);
+        void drop_queue(matcher* m);
+        void drop_replaced_queues();
+        bool earliest_head(index_entry& entry);
+        bool select(std::vector<matcher*>& synced);
+        bool select_by_scan(std::vector<matcher*>& synced);
+
+        std::map<matcher*, stream_queue> _queues;
+        std::vector<index_entry> _index;
+        std::set<matcher*> _empty_queues;  // the streams that are missing to complete a match
+        size_t _heads = 0;
+        int _heads_per_domain[RS2_TIMESTAMP_DOMAIN_COUNT] = {};
+        unsigned long long _generation = 0;
+        unsigned int _min_fps = 0;
+        double _next_inactivity_check = 0;
+    };
 }
@@ -739,7 +739,7 @@ namespace librealsense
             f.profile.set(vframe->get_width(), vframe->get_height(), vframe->get_stride(), convertToTm2PixelFormat(vframe->get_stream()->get_format()));
             f.exposuretime = get_md_or_default(RS2_FRAME_METADATA_ACTUAL_EXPOSURE);
             f.frameLength = vframe->get_height()*vframe->get_stride()* (vframe->get_bpp() / 8);
-            f.data = vframe->data.data();
+            f.data = const_cast<byte*>(vframe->get_frame_data());
             f.timestamp = to_nanos(vframe->additional_data.timestamp);
             f.systemTimestamp = to_nanos(vframe->additional_data.backend_timestamp);
             f.arrivalTimeStamp = to_nanos(vframe->additional_data.system_time);
@@ -755,7 +755,7 @@ namespace librealsense
             if (st == RS2_STREAM_ACCEL)
             {
                 TrackingData::AccelerometerFrame f{};
-                auto mdata = reinterpret_cast<float*>(mframe->data.data());
+                auto mdata = reinterpret_cast<const float*>(mframe->get_frame_data());
                 f.acceleration.set(mdata[0], mdata[1], mdata[2]);
                 f.frameId = mframe->additional_data.frame_number;
                 f.sensorIndex = stream_index;
@@ -772,7 +772,7 @@ namespace librealsense
             else if(st == RS2_STREAM_GYRO)
             {
                 TrackingData::GyroFrame f{};
-                auto mdata = reinterpret_cast<float*>(mframe->data.data());
+                auto mdata = reinterpret_cast<const float*>(mframe->get_frame_data());
                 f.angularVelocity.set(mdata[0], mdata[1], mdata[2]);
                 f.frameId = mframe->additional_data.frame_number;
                 f.sensorIndex = stream_index;
@@ -1118,7 +1118,7 @@ namespace librealsense
             frame->set_timestamp_domain(RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME);
             frame->set_stream(profile);
 
-            auto info = reinterpret_cast<librealsense::pose_frame::pose_info*>(pose_frame->data.data());
+            auto info = reinterpret_cast<librealsense::pose_frame::pose_info*>(const_cast<byte*>(pose_frame->get_frame_data()));
             info->translation = float3{pose.flX, pose.flY, pose.flZ};
             info->velocity = float3{pose.flVx, pose.flVy, pose.flVz};
             info->acceleration = float3{pose.flAx, pose.flAy, pose.flAz};
@@ -1231,7 +1231,7 @@ namespace librealsense
             frame->set_timestamp_domain(RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME);
             frame->set_stream(profile);
             frame->set_sensor(this->shared_from_this()); //TODO? uvc doesn't set it?
-            video->data.assign(message->metadata.bFrameData, message->metadata.bFrameData + (height * stride));
+            memcpy(const_cast<byte*>(video->get_frame_data()), message->metadata.bFrameData, height * stride);
         }
         else
         {
@@ -1533,7 +1533,7 @@ namespace librealsense
             frame->set_timestamp(ts.global_ts.count());
             frame->set_timestamp_domain(RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME);
             frame->set_stream(profile);
-            auto data = reinterpret_cast<float*>(motion_frame->data.data());
+            auto data = reinterpret_cast<float*>(const_cast<byte*>(motion_frame->get_frame_data()));
             data[0] = imu_data[0];
             data[1] = imu_data[1];
             data[2] = imu_data[2];
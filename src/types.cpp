@@ -344,6 +344,18 @@ namespace librealsense
 #undef CASE
     }
 
+    const char* get_string(rs2_record_queue_policy value)
+    {
+#define CASE(X) STRCASE(RECORD_QUEUE_POLICY, X)
+        switch (value)
+        {
+            CASE(DROP_NEWEST)
+            CASE(BLOCK)
+        default: assert(!is_valid(value)); return UNKNOWN_VALUE;
+        }
+#undef CASE
+    }
+
     const char* get_string(rs2_log_severity value)
     {
 #define CASE(X) STRCASE(LOG_SEVERITY, X)
@@ -451,6 +463,14 @@ namespace librealsense
             case RS2_OPTION_ALTERNATE_IR:       return "Alternate IR";
             CASE(NOISE_ESTIMATION)
             case RS2_OPTION_ENABLE_IR_REFLECTIVITY: return "Enable IR Reflectivity";
+            CASE(FRAME_POOL_WATERMARK)
+            CASE(FRAME_POOL_HITS)
+            CASE(FRAME_POOL_MISSES)
+            CASE(ZERO_COPY_CAPTURE)
+            CASE(PROCESSING_THREADS)
+            CASE(COMPACT_POINTS)
+            CASE(SYNC_TOLERANCE)
+            CASE(SYNC_QUEUE_SIZE)
         default: assert(!is_valid(value)); return UNKNOWN_VALUE;
         }
 #undef CASE
@@ -595,6 +615,24 @@ namespace librealsense
 #undef CASE
     }
 
+    const char* get_string(rs2_frame_trace_stage value)
+    {
+#define CASE(X) STRCASE(FRAME_TRACE_STAGE, X)
+        switch (value)
+        {
+            CASE(KERNEL_DEQUEUE)
+            CASE(BACKEND_CALLBACK)
+            CASE(UNPACK_DONE)
+            CASE(PROCESSING_IN)
+            CASE(PROCESSING_OUT)
+            CASE(SYNCER_OUT)
+            CASE(USER_CALLBACK_START)
+            CASE(USER_CALLBACK_END)
+        default: assert(!is_valid(value)); return UNKNOWN_VALUE;
+        }
+#undef CASE
+    }
+
     const char* get_string(rs2_notification_category value)
     {
 #define CASE(X) STRCASE(NOTIFICATION_CATEGORY, X)
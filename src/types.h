@@ -544,12 +544,14 @@ namespace librealsense
     RS2_ENUM_HELPERS(rs2_camera_info, CAMERA_INFO)
     RS2_ENUM_HELPERS(rs2_frame_metadata_value, FRAME_METADATA)
     RS2_ENUM_HELPERS(rs2_timestamp_domain, TIMESTAMP_DOMAIN)
+    RS2_ENUM_HELPERS(rs2_frame_trace_stage, FRAME_TRACE_STAGE)
     RS2_ENUM_HELPERS(rs2_sr300_visual_preset, SR300_VISUAL_PRESET)
     RS2_ENUM_HELPERS(rs2_extension, EXTENSION)
     RS2_ENUM_HELPERS(rs2_exception_type, EXCEPTION_TYPE)
     RS2_ENUM_HELPERS(rs2_log_severity, LOG_SEVERITY)
     RS2_ENUM_HELPERS(rs2_notification_category, NOTIFICATION_CATEGORY)
     RS2_ENUM_HELPERS(rs2_playback_status, PLAYBACK_STATUS)
+    RS2_ENUM_HELPERS(rs2_record_queue_policy, RECORD_QUEUE_POLICY)
     RS2_ENUM_HELPERS(rs2_matchers, MATCHER)
     RS2_ENUM_HELPERS(rs2_sensor_mode, SENSOR_MODE)
     RS2_ENUM_HELPERS(rs2_l500_visual_preset, L500_VISUAL_PRESET)
@@ -930,6 +932,20 @@ namespace librealsense
         void release() override { delete this; }
     };
 
+    class frame_allocator : public rs2_frame_allocator
+    {
+        rs2_frame_allocate_ptr alloc_fptr;
+        rs2_frame_deallocate_ptr dealloc_fptr;
+        void * user;
+    public:
+        frame_allocator(rs2_frame_allocate_ptr allocate, rs2_frame_deallocate_ptr deallocate, void * user)
+            : alloc_fptr(allocate), dealloc_fptr(deallocate), user(user) {}
+
+        void* allocate(int size) override { return alloc_fptr(size, user); }
+        void deallocate(void* ptr, int size) override { dealloc_fptr(ptr, size, user); }
+        void release() override { delete this; }
+    };
+
     class internal_frame_processor_fptr_callback : public rs2_frame_processor_callback
     {
         rs2_frame_processor_callback_ptr fptr;
@@ -1066,6 +1082,7 @@ namespace librealsense
     };
 
     typedef std::shared_ptr<rs2_frame_callback> frame_callback_ptr;
+    typedef std::shared_ptr<rs2_frame_allocator> frame_allocator_ptr;
     typedef std::shared_ptr<rs2_frame_processor_callback> frame_processor_callback_ptr;
     typedef std::shared_ptr<rs2_notifications_callback> notifications_callback_ptr;
     typedef std::shared_ptr<rs2_calibration_change_callback> calibration_change_callback_ptr;
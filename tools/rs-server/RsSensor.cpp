@@ -10,10 +10,17 @@
 #include <math.h>
 #include <thread>
 
+// Frames waiting for the compression thread of their stream, beyond which the oldest are dropped
+#define COMPRESSION_QUEUE_SIZE 2
+// Period at which an idle compression thread checks whether it should stop
+#define COMPRESSION_WAIT_MS 100
+
 RsSensor::RsSensor(UsageEnvironment* t_env, rs2::sensor t_sensor, rs2::device t_device)
     : env(t_env)
     , m_sensor(t_sensor)
     , m_device(t_device)
+    , m_compressionThreads(std::make_shared<std::vector<std::thread>>())
+    , m_isCompressing(std::make_shared<std::atomic<bool>>(false))
 {
     for(rs2::stream_profile streamProfile : m_sensor.get_stream_profiles())
     {
@@ -56,38 +63,49 @@ int RsSensor::open(std::unordered_map<long long int, rs2::frame_queue>& t_stream
 int RsSensor::close()
 {
     m_sensor.close();
+    m_iCompress.clear();
     return EXIT_SUCCESS;
 }
 
 int RsSensor::stop()
 {
     m_sensor.stop();
+    stopCompression();
     return EXIT_SUCCESS;
 }
 
 int RsSensor::start(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfilesQueues)
 {
+    stopCompression();
+    *m_isCompressing = true;
+    for(auto& streamProfile : t_streamProfilesQueues)
+    {
+        long long int profileKey = streamProfile.first;
+        if(m_iCompress.find(profileKey) != m_iCompress.end())
+        {
+            rs2::frame_queue pendingFrames(COMPRESSION_QUEUE_SIZE);
+            m_pendingFrames.emplace(profileKey, pendingFrames);
+            m_compressionThreads->emplace_back(&RsSensor::compressFrames, this, profileKey, pendingFrames, streamProfile.second);
+        }
+    }
+
     auto callback = [&](const rs2::frame& frame) {
         long long int profileKey = getStreamProfileKey(frame.get_profile());
         //check if profile exists in map:
         if(t_streamProfilesQueues.find(profileKey) != t_streamProfilesQueues.end())
         {
             std::chrono::high_resolution_clock::time_point curSample = std::chrono::high_resolution_clock::now();
-            std::chrono::duration<double> timeSpan = std::chrono::duration_cast<std::chrono::duration<double>>(curSample - m_prevSample[profileKey]);
-            if(CompressionFactory::isCompressionSupported(frame.get_profile().format(), frame.get_profile().stream_type()))
+            auto pendingFrames = m_pendingFrames.find(profileKey);
+            if(pendingFrames != m_pendingFrames.end())
             {
-                unsigned char* buff = m_memPool->getNextMem();
-                int frameSize = m_iCompress.at(profileKey)->compressBuffer((unsigned char*)frame.get_data(), frame.get_data_size(), buff);
-                if(frameSize == -1)
-                {
-                    m_memPool->returnMem(buff);
-                    return;
-                }
-                memcpy((unsigned char*)frame.get_data(), buff, frameSize);
-                m_memPool->returnMem(buff);
+                //compressed and pushed to its queue by the compression thread of the stream
+                pendingFrames->second.enqueue(frame);
+            }
+            else
+            {
+                //push frame to its queue
+                t_streamProfilesQueues[profileKey].enqueue(frame);
             }
-            //push frame to its queue
-            t_streamProfilesQueues[profileKey].enqueue(frame);
             m_prevSample[profileKey] = curSample;
         }
     };
@@ -95,6 +113,38 @@ int RsSensor::start(std::unordered_map<long long int, rs2::frame_queue>& t_strea
     return EXIT_SUCCESS;
 }
 
+void RsSensor::compressFrames(long long int t_profileKey, rs2::frame_queue t_pendingFrames, rs2::frame_queue t_compressedFrames)
+{
+    std::shared_ptr<ICompression> compression = m_iCompress.at(t_profileKey);
+    while(*m_isCompressing)
+    {
+        rs2::frame frame;
+        if(!t_pendingFrames.try_wait_for_frame(&frame, COMPRESSION_WAIT_MS))
+        {
+            continue;
+        }
+        unsigned char* buff = m_memPool->getNextMem();
+        int frameSize = compression->compressBuffer((unsigned char*)frame.get_data(), frame.get_data_size(), buff);
+        if(frameSize != -1)
+        {
+            memcpy((unsigned char*)frame.get_data(), buff, frameSize);
+            t_compressedFrames.enqueue(frame);
+        }
+        m_memPool->returnMem(buff);
+    }
+}
+
+void RsSensor::stopCompression()
+{
+    *m_isCompressing = false;
+    for(auto& thread : *m_compressionThreads)
+    {
+        thread.join();
+    }
+    m_compressionThreads->clear();
+    m_pendingFrames.clear();
+}
+
 long long int RsSensor::getStreamProfileKey(rs2::stream_profile t_profile)
 {
     long long int key;
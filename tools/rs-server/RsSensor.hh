@@ -4,11 +4,14 @@
 #pragma once
 
 #include "compression/ICompression.h"
+#include <atomic>
 #include <chrono>
 #include <ipDeviceCommon/MemoryPool.h>
 #include <librealsense2/hpp/rs_types.hpp>
 #include <librealsense2/rs.hpp>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 typedef struct RsOption
 {
@@ -42,6 +45,11 @@ public:
     std::vector<RsOption> getSupportedOptions();
 
 private:
+    // Compress the frames of a stream on their own thread, so that the sensor callback is not held by the
+    // compression. Frames are dropped when the thread falls behind, as they are by the queues of the streams
+    void compressFrames(long long int t_profileKey, rs2::frame_queue t_pendingFrames, rs2::frame_queue t_compressedFrames);
+    void stopCompression();
+
     UsageEnvironment* env;
     rs2::sensor m_sensor;
     std::unordered_map<long long int, rs2::video_stream_profile> m_streamProfiles;
@@ -49,4 +57,8 @@ private:
     rs2::device m_device;
     MemoryPool* m_memPool;
     std::unordered_map<long long int, std::chrono::high_resolution_clock::time_point> m_prevSample;
+    std::unordered_map<long long int, rs2::frame_queue> m_pendingFrames;
+    // Shared by the copies of the sensor, as its queues are
+    std::shared_ptr<std::vector<std::thread>> m_compressionThreads;
+    std::shared_ptr<std::atomic<bool>> m_isCompressing;
 };
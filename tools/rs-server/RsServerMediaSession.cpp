@@ -34,8 +34,8 @@ void RsServerMediaSession::closeRsCamera()
 {
     if(m_isActive)
     {
-        m_rsSensor.getRsSensor().stop();
-        m_rsSensor.getRsSensor().close();
+        m_rsSensor.stop();
+        m_rsSensor.close();
         m_isActive = false;
     }
 }
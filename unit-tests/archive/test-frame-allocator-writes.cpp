@@ -0,0 +1,121 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../test.h"
+#include "../../src/source.h"
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies that the frames a sensor source allocates with a frame allocator set are written
+//         and read through their frame data, the way device sensors fill them: video frames in the allocator memory,
+//         pose and motion frames, which the allocator does not apply to, in internal memory.
+
+namespace
+{
+    struct counting_allocator
+    {
+        std::map< void *, int > sizes;  // Buffers handed out and not back yet
+        int allocated = 0;
+
+        static void * allocate( int size, void * user )
+        {
+            auto self = static_cast< counting_allocator * >( user );
+            auto p = new uint8_t[size];
+            self->sizes[p] = size;
+            ++self->allocated;
+            return p;
+        }
+
+        static void deallocate( void * p, int size, void * user )
+        {
+            auto self = static_cast< counting_allocator * >( user );
+            CHECK( self->sizes[p] == size );
+            self->sizes.erase( p );
+            delete[] static_cast< uint8_t * >( p );
+        }
+
+        bool owns( const void * p ) const { return sizes.count( const_cast< void * >( p ) ) != 0; }
+    };
+
+    struct allocating_source
+    {
+        counting_allocator allocator;
+        frame_source source;
+
+        allocating_source()
+        {
+            source.set_frame_allocator( std::make_shared< frame_allocator >( &counting_allocator::allocate,
+                                                                             &counting_allocator::deallocate,
+                                                                             &allocator ) );
+            source.init( std::make_shared< metadata_parser_map >() );
+        }
+
+        frame_holder alloc( rs2_extension type, size_t size )
+        {
+            frame_holder f( source.alloc_frame( type, size, frame_additional_data(), true ) );
+            REQUIRE( f.frame );
+            return f;
+        }
+    };
+
+    byte * writable_data( frame_holder & f )
+    {
+        return const_cast< byte * >( f->get_frame_data() );
+    }
+}
+
+// Current test description:
+//       * Allocate pose and motion frames and fill them through their frame data: they are not placed in the
+//         allocator memory, and read back what was written
+TEST_CASE( "pose and motion frames are written through their frame data", "[frame allocator]" )
+{
+    allocating_source s;
+    {
+        auto pose = s.alloc( RS2_EXTENSION_POSE_FRAME, sizeof( pose_frame::pose_info ) );
+        REQUIRE( pose->get_frame_data_size() == int( sizeof( pose_frame::pose_info ) ) );
+        auto info = reinterpret_cast< pose_frame::pose_info * >( writable_data( pose ) );
+        info->translation = float3{ 1.f, 2.f, 3.f };
+        info->tracker_confidence = 3;
+
+        auto motion = s.alloc( RS2_EXTENSION_MOTION_FRAME, 3 * sizeof( float ) );
+        REQUIRE( motion->get_frame_data_size() == int( 3 * sizeof( float ) ) );
+        float imu[3] = { 0.5f, -9.8f, 0.25f };
+        memcpy( writable_data( motion ), imu, sizeof( imu ) );
+
+        CHECK( s.allocator.allocated == 0 );
+        CHECK_FALSE( s.allocator.owns( pose->get_frame_data() ) );
+        auto read = reinterpret_cast< const pose_frame::pose_info * >( pose->get_frame_data() );
+        CHECK( read->translation.y == 2.f );
+        CHECK( read->tracker_confidence == 3 );
+        CHECK( memcmp( motion->get_frame_data(), imu, sizeof( imu ) ) == 0 );
+    }
+    CHECK( s.allocator.allocated == 0 );
+}
+
+// Current test description:
+//       * Allocate a video frame and copy pixels into its frame data: they land in the allocator memory, which is
+//         handed back when the frame is released
+TEST_CASE( "video frames are written in allocator memory", "[frame allocator]" )
+{
+    allocating_source s;
+    std::vector< byte > pixels( 64 * 4 );
+    for( size_t i = 0; i < pixels.size(); ++i )
+        pixels[i] = byte( i * 7 );
+    {
+        auto video = s.alloc( RS2_EXTENSION_VIDEO_FRAME, pixels.size() );
+        memcpy( writable_data( video ), pixels.data(), pixels.size() );
+
+        CHECK( s.allocator.allocated == 1 );
+        CHECK( s.allocator.owns( video->get_frame_data() ) );
+        REQUIRE( video->get_frame_data_size() == int( pixels.size() ) );
+        CHECK( memcmp( video->get_frame_data(), pixels.data(), pixels.size() ) == 0 );
+    }
+    CHECK( s.allocator.sizes.empty() );
+}
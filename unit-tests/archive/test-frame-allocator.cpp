@@ -0,0 +1,158 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies that processing blocks given a frame allocator publish their frames in the
+//         memory it provides, and hand every buffer back to it exactly once.
+
+namespace
+{
+    const int W = 16, H = 8;
+
+    struct counting_allocator
+    {
+        std::mutex mutex;
+        std::map< void *, int > sizes;     // Buffers handed out and not back yet
+        std::map< void *, int > returned;  // How many times each buffer was handed back
+        bool fail = false;
+
+        void * allocate( int size )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            if( fail )
+                return nullptr;
+            auto p = new uint8_t[size];
+            sizes[p] = size;
+            return p;
+        }
+
+        void deallocate( void * p, int size )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            CHECK( sizes[p] == size );
+            sizes.erase( p );
+            ++returned[p];
+            delete[] static_cast< uint8_t * >( p );
+        }
+
+        bool owns( const void * p )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            return sizes.count( const_cast< void * >( p ) ) != 0;
+        }
+    };
+
+    struct depth_source
+    {
+        rs2::software_device dev;
+        rs2::software_sensor sensor;
+        rs2::stream_profile depth;
+        rs2::frame_queue queue;
+        std::vector< uint16_t > pixels;
+
+        depth_source()
+            : sensor( dev.add_sensor( "depth" ) )
+            , queue( 100, true )
+            , pixels( W * H )
+        {
+            sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+            rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+            depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 201, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+            for( int i = 0; i < W * H; ++i )
+                pixels[i] = uint16_t( 100 * i );
+            sensor.open( depth );
+            sensor.start( queue );
+        }
+
+        ~depth_source()
+        {
+            sensor.stop();
+            sensor.close();
+        }
+
+        rs2::frame next( int frame_number )
+        {
+            sensor.on_video_frame( { pixels.data(), []( void * ) {}, W * 2, 2, double( frame_number ),
+                                     RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, depth } );
+            return queue.wait_for_frame();
+        }
+    };
+}
+
+// Current test description:
+//       * Colorize depth with an allocator: the output frames are placed in the allocator memory, and each buffer
+//         is handed back once, with its size, when the last reference to its frame is released
+TEST_CASE( "processing block publishes frames in allocator memory", "[frame allocator]" )
+{
+    counting_allocator allocator;
+    depth_source source;
+    {
+        rs2::colorizer colorizer;
+        colorizer.set_frame_allocator( [&]( int size ) { return allocator.allocate( size ); },
+                                       [&]( void * p, int size ) { allocator.deallocate( p, size ); } );
+
+        std::vector< rs2::frame > held;
+        for( int i = 0; i < 5; ++i )
+        {
+            auto out = colorizer.process( source.next( i ) );
+            REQUIRE( out );
+            CHECK( allocator.owns( out.get_data() ) );
+            CHECK( out.get_data_size() == W * H * 3 );
+            held.push_back( out );
+        }
+
+        // Nothing is handed back while the frames are held
+        {
+            std::lock_guard< std::mutex > lock( allocator.mutex );
+            CHECK( allocator.returned.empty() );
+        }
+
+        // The colorized pixels are read from the allocator memory
+        auto first = static_cast< const uint8_t * >( held[0].get_data() );
+        auto last = static_cast< const uint8_t * >( held[4].get_data() );
+        CHECK( std::vector< uint8_t >( first, first + W * H * 3 ) == std::vector< uint8_t >( last, last + W * H * 3 ) );
+    }
+
+    std::lock_guard< std::mutex > lock( allocator.mutex );
+    CHECK( allocator.sizes.empty() );
+    CHECK( ! allocator.returned.empty() );
+    for( auto && r : allocator.returned )
+        CHECK( r.second == 1 );
+}
+
+// Current test description:
+//       * An allocator that returns null leaves the frames in internal memory, and is never handed anything back.
+//         Resetting the allocator restores the internal memory too
+TEST_CASE( "frame allocator falls back to internal memory", "[frame allocator]" )
+{
+    counting_allocator allocator;
+    allocator.fail = true;
+    depth_source source;
+    {
+        rs2::colorizer colorizer;
+        colorizer.set_frame_allocator( [&]( int size ) { return allocator.allocate( size ); },
+                                       [&]( void * p, int size ) { allocator.deallocate( p, size ); } );
+        auto out = colorizer.process( source.next( 0 ) );
+        REQUIRE( out );
+        CHECK( out.get_data() != nullptr );
+        CHECK( out.get_data_size() == W * H * 3 );
+
+        allocator.fail = false;
+        colorizer.reset_frame_allocator();
+        out = colorizer.process( source.next( 1 ) );
+        REQUIRE( out );
+        CHECK( ! allocator.owns( out.get_data() ) );
+    }
+
+    std::lock_guard< std::mutex > lock( allocator.mutex );
+    CHECK( allocator.sizes.empty() );
+    CHECK( allocator.returned.empty() );
+}
@@ -0,0 +1,117 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include "../../src/frame-buffer-pool.h"
+
+#include <thread>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the frame_buffer_pool class used by frame_archive.
+//
+// Current test description:
+//       * Verify buffers are recycled by size, without touching their content
+TEST_CASE( "recycle by size", "[frame buffer pool]" )
+{
+    std::atomic< uint32_t > watermark( 4 );
+    frame_buffer_pool pool( &watermark );
+
+    std::vector< uint8_t > out;
+    CHECK_FALSE( pool.acquire( 100, out ) );
+
+    std::vector< uint8_t > buf( 100, 0xAB );
+    auto ptr = buf.data();
+    pool.release( std::move( buf ) );
+
+    CHECK_FALSE( pool.acquire( 200, out ) );
+    REQUIRE( pool.acquire( 100, out ) );
+    CHECK( out.data() == ptr );
+    CHECK( out.size() == 100 );
+    CHECK( out[99] == 0xAB );
+    CHECK_FALSE( pool.acquire( 100, out ) );
+
+    auto stats = pool.get_stats();
+    CHECK( stats.hits == 1 );
+    CHECK( stats.misses == 3 );
+}
+
+// Current test description:
+//       * Verify the watermark caps the number of cached buffers, and zero disables recycling
+TEST_CASE( "watermark", "[frame buffer pool]" )
+{
+    std::atomic< uint32_t > watermark( 2 );
+    frame_buffer_pool pool( &watermark );
+
+    for( int i = 0; i < 5; ++i )
+        pool.release( std::vector< uint8_t >( 64 ) );
+
+    std::vector< uint8_t > out;
+    CHECK( pool.acquire( 64, out ) );
+    CHECK( pool.acquire( 64, out ) );
+    CHECK_FALSE( pool.acquire( 64, out ) );
+
+    watermark = 0;
+    pool.release( std::move( out ) );
+    CHECK_FALSE( pool.acquire( 64, out ) );
+}
+
+// Current test description:
+//       * Verify new sizes evict the least recently used bucket once all buckets are taken
+TEST_CASE( "bucket eviction", "[frame buffer pool]" )
+{
+    std::atomic< uint32_t > watermark( 4 );
+    frame_buffer_pool pool( &watermark );
+
+    std::vector< uint8_t > out;
+    for( size_t size = 1; size <= frame_buffer_pool::BUCKETS; ++size )
+    {
+        pool.release( std::vector< uint8_t >( size ) );
+        pool.acquire( size, out );
+        pool.release( std::move( out ) );
+    }
+
+    // Size 1 is now the least recently used one
+    pool.release( std::vector< uint8_t >( 1000 ) );
+    CHECK_FALSE( pool.acquire( 1, out ) );
+    CHECK( pool.acquire( 1000, out ) );
+    CHECK( pool.acquire( 2, out ) );
+
+    pool.clear();
+    CHECK_FALSE( pool.acquire( 3, out ) );
+}
+
+// Current test description:
+//       * Verify concurrent producers/consumers never hand out the same buffer twice
+TEST_CASE( "multi-threading", "[frame buffer pool]" )
+{
+    std::atomic< uint32_t > watermark( 16 );
+    frame_buffer_pool pool( &watermark );
+
+    const int iterations = 10000;
+    std::atomic< int > corrupted( 0 );
+    auto worker = [&]( uint8_t id ) {
+        for( int i = 0; i < iterations; ++i )
+        {
+            std::vector< uint8_t > buf;
+            if( ! pool.acquire( 256, buf ) )
+                buf.resize( 256 );
+            std::fill( buf.begin(), buf.end(), id );
+            std::this_thread::yield();
+            if( std::any_of( buf.begin(), buf.end(), [id]( uint8_t v ) { return v != id; } ) )
+                ++corrupted;
+            pool.release( std::move( buf ) );
+        }
+    };
+
+    std::vector< std::thread > threads;
+    for( uint8_t t = 1; t <= 4; ++t )
+        threads.emplace_back( worker, t );
+    for( auto & t : threads )
+        t.join();
+
+    CHECK( corrupted == 0 );
+    auto stats = pool.get_stats();
+    CHECK( stats.hits + stats.misses == 4 * iterations );
+}
@@ -0,0 +1,71 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <numeric>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies the pipeline stage stamps of the frames, and the latency
+//         histograms they are accounted for in once released.
+
+namespace
+{
+    const int W = 16, H = 8;
+
+    rs2::stream_profile add_depth_stream( rs2::software_sensor & s )
+    {
+        rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        return s.add_video_stream( { RS2_STREAM_DEPTH, 0, 101, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+    }
+}
+
+// Current test description:
+//       * Submit frames to a software sensor, check the stages they were stamped at in the callback, then
+//         that each of them is accounted for once in the histograms of its stream
+TEST_CASE( "frame trace and latency histogram", "[frame trace]" )
+{
+    rs2::context ctx;  // sets up the clock the stages are stamped with
+    rs2::software_device dev;
+    auto s = dev.add_sensor( "depth" );
+    auto depth = add_depth_stream( s );
+    depth.reset_latency_histogram();
+
+    const int frames = 5;
+    std::vector< uint16_t > pixels( W * H );
+    int received = 0;
+    s.open( depth );
+    s.start( [&]( rs2::frame f ) {
+        ++received;
+        auto arrived = f.get_frame_trace( RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK );
+        CHECK( arrived > 0 );
+        CHECK( f.get_frame_trace( RS2_FRAME_TRACE_STAGE_UNPACK_DONE ) == arrived );
+        CHECK( f.get_frame_trace( RS2_FRAME_TRACE_STAGE_USER_CALLBACK_START ) >= arrived );
+        // Not released yet, and never went through a processing block
+        CHECK( f.get_frame_trace( RS2_FRAME_TRACE_STAGE_USER_CALLBACK_END ) == 0 );
+        CHECK( f.get_frame_trace( RS2_FRAME_TRACE_STAGE_PROCESSING_OUT ) == 0 );
+    } );
+    for( int i = 0; i < frames; ++i )
+        s.on_video_frame( { pixels.data(), []( void * ) {}, W * 2, 2, double( i ), RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth } );
+    s.stop();
+    s.close();
+    REQUIRE( received == frames );
+
+    for( auto stage : { RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK, RS2_FRAME_TRACE_STAGE_USER_CALLBACK_END } )
+    {
+        auto bins = depth.get_latency_histogram( stage );
+        REQUIRE( bins.size() == RS2_LATENCY_HISTOGRAM_BINS );
+        CHECK( std::accumulate( bins.begin(), bins.end(), 0ULL ) == frames );
+    }
+    // The earliest stage is the origin of the latencies
+    CHECK( depth.get_latency_histogram( RS2_FRAME_TRACE_STAGE_BACKEND_CALLBACK )[0] == frames );
+    auto never = depth.get_latency_histogram( RS2_FRAME_TRACE_STAGE_SYNCER_OUT );
+    CHECK( std::accumulate( never.begin(), never.end(), 0ULL ) == 0 );
+
+    depth.reset_latency_histogram();
+    auto cleared = depth.get_latency_histogram( RS2_FRAME_TRACE_STAGE_USER_CALLBACK_END );
+    CHECK( std::accumulate( cleared.begin(), cleared.end(), 0ULL ) == 0 );
+}
@@ -0,0 +1,165 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies that the frames of a software sensor borrow the buffers they are given,
+//         and hand them back to their deleter exactly once, whichever way the frame goes.
+
+namespace
+{
+    const int W = 16, H = 8;
+
+    std::mutex deleted_mutex;
+    std::map< void *, int > deleted;  // How many times each buffer was handed back
+
+    void count_and_delete( void * p )
+    {
+        {
+            std::lock_guard< std::mutex > lock( deleted_mutex );
+            ++deleted[p];
+        }
+        delete[] static_cast< uint16_t * >( p );
+    }
+
+    // Every buffer given was handed back once, and only those
+    void check_all_deleted_once( const std::vector< void * > & given )
+    {
+        std::lock_guard< std::mutex > lock( deleted_mutex );
+        CHECK( deleted.size() == given.size() );
+        for( auto p : given )
+            CHECK( deleted[p] == 1 );
+        deleted.clear();
+    }
+
+    size_t deleted_count()
+    {
+        std::lock_guard< std::mutex > lock( deleted_mutex );
+        return deleted.size();
+    }
+
+    struct test_sensor
+    {
+        rs2::software_device dev;
+        rs2::software_sensor sensor;
+        rs2::stream_profile depth;
+        std::vector< void * > given;
+
+        test_sensor()
+            : sensor( dev.add_sensor( "depth" ) )
+        {
+            sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+            rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+            depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 201, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+        }
+
+        rs2_software_video_frame make_frame( int frame_number, uint16_t value )
+        {
+            auto pixels = new uint16_t[W * H];
+            for( int i = 0; i < W * H; ++i )
+                pixels[i] = value;
+            given.push_back( pixels );
+            return { pixels, count_and_delete, W * 2, 2, double( frame_number ),
+                     RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, depth };
+        }
+    };
+}
+
+// Current test description:
+//       * Check that the delivered frames point at the buffers they were given, that the buffers of the frames
+//         held by the application or dropped are handed back only once the frames are released, and that those
+//         submitted when the sensor is not streaming are handed back right away
+TEST_CASE( "software frames borrow their buffer", "[software-device]" )
+{
+    test_sensor s;
+    {
+        std::vector< rs2::frame > held;
+        std::mutex held_mutex;
+        s.sensor.open( s.depth );
+        s.sensor.start( [&]( rs2::frame f ) {
+            std::lock_guard< std::mutex > lock( held_mutex );
+            held.push_back( f );
+        } );
+
+        // Holding the frames without releasing them eventually exhausts the frames of the sensor,
+        // beyond which the frames are dropped
+        const int frames = 40;
+        for( int i = 0; i < frames; ++i )
+            s.sensor.on_video_frame( s.make_frame( i, uint16_t( i ) ) );
+        s.sensor.stop();
+
+        REQUIRE( ! held.empty() );
+        for( auto && f : held )
+        {
+            auto i = f.get_frame_number();
+            CHECK( f.get_data() == s.given[i] );
+            CHECK( f.get_data_size() == W * H * 2 );
+            CHECK( static_cast< const uint16_t * >( f.get_data() )[0] == i );
+        }
+        CHECK( deleted_count() + held.size() == frames );
+    }
+    s.sensor.close();
+    check_all_deleted_once( s.given );
+
+    s.given.clear();
+    s.sensor.on_video_frame( s.make_frame( 0, 0 ) );
+    check_all_deleted_once( s.given );
+}
+
+// Current test description:
+//       * Threshold frames through a queue: writable frames are thresholded in place and passed on, while the
+//         others are left untouched and thresholded into a new frame that holds on to them. A frame thresholded in
+//         place keeps the profile of the sensor, which other holders of the frame may rely on, while new frames have
+//         the profile of the threshold
+TEST_CASE( "threshold processes writable software frames in place", "[software-device]" )
+{
+    test_sensor s;
+    rs2::frame_queue queue( 10, true );
+    s.sensor.open( s.depth );
+    s.sensor.start( queue );
+
+    // 0.5 m is kept, 2 m is out of range
+    s.sensor.on_video_frame( s.make_frame( 0, 500 ) );
+    s.sensor.on_writable_video_frame( s.make_frame( 1, 500 ) );
+    s.sensor.on_video_frame( s.make_frame( 2, 2000 ) );
+    s.sensor.on_writable_video_frame( s.make_frame( 3, 2000 ) );
+
+    {
+        rs2::threshold_filter threshold( 0.1f, 1.f );
+        int threshold_profile = -1;
+        for( int i = 0; i < 4; ++i )
+        {
+            auto f = queue.wait_for_frame();
+            auto writable = i % 2 == 1;
+            uint16_t expected = i < 2 ? 500 : 0;
+            auto out = threshold.process( f );
+            CAPTURE( i );
+            CHECK( ( out.get_data() == s.given[i] ) == writable );
+            CHECK( out.get_profile().format() == RS2_FORMAT_Z16 );
+            CHECK( f.get_profile().unique_id() == s.depth.unique_id() );
+            if( writable )
+                CHECK( out.get_profile().unique_id() == s.depth.unique_id() );
+            else
+            {
+                CHECK( out.get_profile().unique_id() != s.depth.unique_id() );
+                if( threshold_profile < 0 )
+                    threshold_profile = out.get_profile().unique_id();
+                CHECK( out.get_profile().unique_id() == threshold_profile );
+            }
+            CHECK( static_cast< const uint16_t * >( out.get_data() )[W * H - 1] == expected );
+            // The frame given in is only overwritten when writable
+            CHECK( static_cast< const uint16_t * >( f.get_data() )[0] == ( writable ? expected : ( i < 2 ? 500 : 2000 ) ) );
+        }
+    }
+
+    s.sensor.stop();
+    s.sensor.close();
+    check_all_deleted_once( s.given );
+}
@@ -0,0 +1,253 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/compression/RvlCompression.cpp
+//#cmake:add-file ../../src/compression/Lz4Compression.cpp
+//#cmake:add-file ../../src/compression/CompressionThreadPool.cpp
+//#cmake:add-file ../../third-party/realsense-file/lz4/lz4.c
+
+#include "../test.h"
+#include "../../src/compression/RvlCompression.h"
+#include "../../src/compression/Lz4Compression.h"
+
+#include <cstring>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies that the RVL and LZ4 codecs of the network device decode what they encode, and
+//         reject the payloads they cannot decode: those of another codec or version, of another frame size,
+//         truncated or corrupted.
+
+namespace
+{
+    // Depth with holes, runs of values, and steps over the whole 16-bit range
+    std::vector< uint16_t > make_depth( int width, int height )
+    {
+        std::vector< uint16_t > depth( width * height );
+        for( int y = 0; y < height; ++y )
+            for( int x = 0; x < width; ++x )
+            {
+                uint16_t & z = depth[y * width + x];
+                if( ( x / 7 + y / 5 ) % 4 == 0 )
+                    z = 0;
+                else if( ( x + y ) % 97 == 0 )
+                    z = 65535;
+                else
+                    z = uint16_t( 500 + x * 3 + y * 2 + ( x * y ) % 13 );
+            }
+        return depth;
+    }
+
+    // The payload of an encoded frame, without the size that prefixes it
+    std::vector< unsigned char > encode( ICompression & codec, const void * frame, int size )
+    {
+        // LZ4 writes up to its bound before checking the size of the result
+        std::vector< unsigned char > buffer( size * 2 + 64 );
+        int encoded = codec.compressBuffer( (unsigned char *)frame, size, buffer.data() );
+        REQUIRE( encoded > int( sizeof( int ) ) );
+        int payload_size;
+        memcpy( &payload_size, buffer.data(), sizeof( payload_size ) );
+        REQUIRE( payload_size == encoded - int( sizeof( int ) ) );
+        return std::vector< unsigned char >( buffer.begin() + sizeof( int ), buffer.begin() + encoded );
+    }
+
+    // The decoded size, or -1; the frame is resized to hold what the codec may write
+    int decode( ICompression & codec, std::vector< unsigned char > payload, std::vector< unsigned char > & frame,
+                size_t frame_size )
+    {
+        frame.assign( frame_size, 0xcd );
+        return codec.decompressBuffer( payload.data(), int( payload.size() ), frame.data() );
+    }
+
+    void check_round_trip( ICompression & encoder, ICompression & decoder, const std::vector< uint16_t > & depth )
+    {
+        int size = int( depth.size() * sizeof( uint16_t ) );
+        auto payload = encode( encoder, depth.data(), size );
+        CHECK( payload.size() < size_t( size ) );
+
+        std::vector< unsigned char > decoded;
+        REQUIRE( decode( decoder, payload, decoded, size ) == size );
+        CHECK( memcmp( decoded.data(), depth.data(), size ) == 0 );
+    }
+
+    void register_logger()
+    {
+        // The codecs log their failures to the librealsense logger
+        el::Loggers::getLogger( "librealsense" );
+    }
+}
+
+// Current test description:
+//       * Encode depth frames with RVL, small enough for one band and large enough for many, and decode them with
+//         another instance: the frames are restored as they were, every time
+TEST_CASE( "rvl round trip", "[depth codecs]" )
+{
+    register_logger();
+    for( auto size : { std::make_pair( 64, 48 ), std::make_pair( 848, 480 ), std::make_pair( 1280, 721 ) } )
+    {
+        CAPTURE( size.first, size.second );
+        RvlCompression encoder( size.first, size.second, RS2_FORMAT_Z16, 2 );
+        RvlCompression decoder( size.first, size.second, RS2_FORMAT_Z16, 2 );
+        auto depth = make_depth( size.first, size.second );
+        check_round_trip( encoder, decoder, depth );
+
+        // Reusing the codecs for another frame leaves nothing of the previous one
+        std::vector< uint16_t > empty( depth.size(), 0 );
+        check_round_trip( encoder, decoder, empty );
+        check_round_trip( encoder, decoder, depth );
+    }
+}
+
+// Current test description:
+//       * Encode 16-bit frames with LZ4, through its delta prefilter, and 8-bit frames without it: both are restored
+//         as they were
+TEST_CASE( "lz4 round trip", "[depth codecs]" )
+{
+    register_logger();
+    const int W = 848, H = 480;
+    auto depth = make_depth( W, H );
+    {
+        Lz4Compression encoder( W, H, RS2_FORMAT_Z16, 2 );
+        Lz4Compression decoder( W, H, RS2_FORMAT_Z16, 2 );
+        auto payload = encode( encoder, depth.data(), W * H * 2 );
+        CHECK( payload[0] == (unsigned char)CompressionVersion::lz4Delta );
+        check_round_trip( encoder, decoder, depth );
+    }
+    {
+        std::vector< uint8_t > y8( W * H );
+        for( size_t i = 0; i < y8.size(); ++i )
+            y8[i] = uint8_t( depth[i] >> 2 );
+        Lz4Compression encoder( W, H, RS2_FORMAT_Y8, 1 );
+        Lz4Compression decoder( W, H, RS2_FORMAT_Y8, 1 );
+        auto payload = encode( encoder, y8.data(), W * H );
+        CHECK( payload[0] == (unsigned char)CompressionVersion::lz4 );
+
+        std::vector< unsigned char > decoded;
+        REQUIRE( decode( decoder, payload, decoded, W * H ) == W * H );
+        CHECK( memcmp( decoded.data(), y8.data(), W * H ) == 0 );
+    }
+}
+
+// Current test description:
+//       * Decode payloads with a version byte the decoder does not know, or that belongs to the other codec: they
+//         are rejected
+TEST_CASE( "depth codecs reject other versions", "[depth codecs]" )
+{
+    register_logger();
+    const int W = 848, H = 480;
+    auto depth = make_depth( W, H );
+    RvlCompression rvl( W, H, RS2_FORMAT_Z16, 2 );
+    Lz4Compression lz4( W, H, RS2_FORMAT_Z16, 2 );
+    auto rvl_payload = encode( rvl, depth.data(), W * H * 2 );
+    auto lz4_payload = encode( lz4, depth.data(), W * H * 2 );
+    std::vector< unsigned char > decoded;
+
+    CHECK( decode( lz4, rvl_payload, decoded, W * H * 2 ) == -1 );
+    CHECK( decode( rvl, lz4_payload, decoded, W * H * 2 ) == -1 );
+    for( unsigned char version : { 0, 4, 255 } )
+    {
+        CAPTURE( int( version ) );
+        rvl_payload[0] = lz4_payload[0] = version;
+        CHECK( decode( rvl, rvl_payload, decoded, W * H * 2 ) == -1 );
+        CHECK( decode( lz4, lz4_payload, decoded, W * H * 2 ) == -1 );
+    }
+
+    // 8-bit frames have no delta prefilter to undo
+    Lz4Compression y8( W, H * 2, RS2_FORMAT_Y8, 1 );
+    lz4_payload[0] = (unsigned char)CompressionVersion::lz4Delta;
+    CHECK( decode( y8, lz4_payload, decoded, W * H * 2 ) == -1 );
+
+    CHECK( rvl.decompressBuffer( rvl_payload.data(), 0, decoded.data() ) == -1 );
+    CHECK( lz4.decompressBuffer( lz4_payload.data(), 0, decoded.data() ) == -1 );
+}
+
+// Current test description:
+//       * Decode an RVL frame truncated at every length, and frames corrupted in their header or their bands: they
+//         are rejected, without writing past the frame
+TEST_CASE( "rvl rejects truncated and corrupted frames", "[depth codecs]" )
+{
+    register_logger();
+    const int W = 848, H = 480;
+    auto depth = make_depth( W, H );
+    RvlCompression rvl( W, H, RS2_FORMAT_Z16, 2 );
+    auto payload = encode( rvl, depth.data(), W * H * 2 );
+    int bands = payload[1];
+    REQUIRE( bands > 1 );
+    std::vector< unsigned char > decoded;
+
+    for( size_t size = 0; size < payload.size(); size += 1 + size / 16 )
+    {
+        CAPTURE( size );
+        REQUIRE( decode( rvl, std::vector< unsigned char >( payload.begin(), payload.begin() + size ), decoded,
+                         W * H * 2 + 16 )
+                 == -1 );
+        for( size_t i = W * H * 2; i < decoded.size(); ++i )
+            CHECK( decoded[i] == 0xcd );
+    }
+
+    // Another number of bands than the frame size makes
+    for( int other : { 0, 1, bands - 1, bands + 1, 255 } )
+    {
+        CAPTURE( other );
+        auto corrupted = payload;
+        corrupted[1] = (unsigned char)other;
+        CHECK( decode( rvl, corrupted, decoded, W * H * 2 ) == -1 );
+    }
+
+    // Bands that claim more words than the frame holds
+    {
+        auto corrupted = payload;
+        uint32_t words = 0x40000000;
+        memcpy( corrupted.data() + 4, &words, sizeof( words ) );
+        CHECK( decode( rvl, corrupted, decoded, W * H * 2 ) == -1 );
+    }
+
+    // Values longer than any the encoder writes
+    {
+        auto corrupted = payload;
+        std::fill( corrupted.begin() + 4 + bands * 4, corrupted.end(), 0xff );
+        CHECK( decode( rvl, corrupted, decoded, W * H * 2 ) == -1 );
+    }
+
+    // Bands whose words end before their pixels
+    {
+        auto corrupted = payload;
+        std::fill( corrupted.begin() + 4 + bands * 4, corrupted.end(), 0x77 );
+        CHECK( decode( rvl, corrupted, decoded, W * H * 2 ) == -1 );
+    }
+}
+
+// Current test description:
+//       * Decode frames encoded for another frame size: both codecs reject them rather than write past the frame
+TEST_CASE( "depth codecs reject other frame sizes", "[depth codecs]" )
+{
+    register_logger();
+    const int W = 848, H = 480;
+    auto depth = make_depth( W, H );
+    std::vector< unsigned char > decoded;
+    {
+        RvlCompression encoder( W, H, RS2_FORMAT_Z16, 2 );
+        auto payload = encode( encoder, depth.data(), W * H * 2 );
+        for( auto size : { std::make_pair( 640, 480 ), std::make_pair( 848, 100 ), std::make_pair( 64, 48 ) } )
+        {
+            CAPTURE( size.first, size.second );
+            RvlCompression decoder( size.first, size.second, RS2_FORMAT_Z16, 2 );
+            CHECK( decode( decoder, payload, decoded, size.first * size.second * 2 ) == -1 );
+        }
+
+        // Nor is a frame smaller than its size encoded
+        std::vector< unsigned char > buffer( W * H * 4 );
+        CHECK( encoder.compressBuffer( (unsigned char *)depth.data(), W * H, buffer.data() ) == -1 );
+    }
+    {
+        Lz4Compression encoder( W, H, RS2_FORMAT_Z16, 2 );
+        auto payload = encode( encoder, depth.data(), W * H * 2 );
+        Lz4Compression decoder( 640, 480, RS2_FORMAT_Z16, 2 );
+        CHECK( decode( decoder, payload, decoded, 640 * 480 * 2 ) == -1 );
+
+        // A truncated LZ4 block does not decode either
+        payload.resize( payload.size() / 2 );
+        Lz4Compression same( W, H, RS2_FORMAT_Z16, 2 );
+        CHECK( decode( same, payload, decoded, W * H * 2 ) == -1 );
+    }
+}
@@ -0,0 +1,184 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include "../../src/concurrency.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies lock_free_queue against the semantics of single_consumer_queue,
+//         and compares the two (the benchmark is hidden; run it with the [benchmark] tag).
+
+namespace
+{
+    template< class Q >
+    void check_drop_oldest()
+    {
+        Q q( 3 );
+        for( int i = 0; i < 5; ++i )
+            q.enqueue( std::move( i ) );
+        CHECK( q.size() == 3 );
+
+        int item = -1;
+        for( int expected : { 2, 3, 4 } )
+        {
+            REQUIRE( q.dequeue( &item, 0 ) );
+            CHECK( item == expected );
+        }
+        CHECK_FALSE( q.try_dequeue( &item ) );
+    }
+
+    template< class Q >
+    void check_clear()
+    {
+        Q q( 4 );
+        int one = 1, two = 2;
+        q.enqueue( std::move( one ) );
+        q.clear();
+        CHECK( q.size() == 0 );
+
+        // Refused until the next dequeue, which no longer waits
+        q.enqueue( std::move( two ) );
+        int item = 0;
+        auto start = std::chrono::steady_clock::now();
+        CHECK_FALSE( q.dequeue( &item, 1000 ) );
+        CHECK( std::chrono::steady_clock::now() - start < std::chrono::milliseconds( 500 ) );
+
+        q.start();
+        int three = 3;
+        q.enqueue( std::move( three ) );
+        REQUIRE( q.dequeue( &item, 0 ) );
+        CHECK( item == 3 );
+    }
+
+    // Producers enqueue increasing values tagged with their index; the consumer checks that the
+    // values of each producer arrive in order, and counts them. Blocking producers lose no item, so
+    // that the consumer stops after the last one instead of waiting for more
+    template< class Q >
+    size_t run_producers( Q & q, int producers, int items_per_producer, bool blocking )
+    {
+        const size_t expected = blocking ? size_t( producers * items_per_producer ) : size_t( -1 );
+        std::vector< std::thread > threads;
+        for( int p = 0; p < producers; ++p )
+            threads.emplace_back( [&q, p, items_per_producer, blocking]() {
+                for( int i = 0; i < items_per_producer; ++i )
+                {
+                    int v = p << 24 | i;
+                    if( blocking )
+                        q.blocking_enqueue( std::move( v ) );
+                    else
+                        q.enqueue( std::move( v ) );
+                }
+            } );
+
+        std::vector< int > last( producers, -1 );
+        size_t received = 0;
+        bool ordered = true;
+        int item;
+        while( received != expected && q.dequeue( &item, 200 ) )
+        {
+            int p = item >> 24, i = item & 0xffffff;
+            ordered = ordered && i > last[p];
+            last[p] = i;
+            ++received;
+        }
+        for( auto & t : threads )
+            t.join();
+        CHECK( ordered );
+        return received;
+    }
+}
+
+// Current test description:
+//       * A full queue drops its oldest item, as single_consumer_queue does
+TEST_CASE( "drops the oldest item", "[lock free queue]" )
+{
+    check_drop_oldest< single_consumer_queue< int > >();
+    check_drop_oldest< lock_free_queue< int > >();
+}
+
+// Current test description:
+//       * clear() empties the queue, refuses items until the next dequeue, and releases waiting
+//         threads until start()
+TEST_CASE( "clear and start", "[lock free queue]" )
+{
+    check_clear< single_consumer_queue< int > >();
+    check_clear< lock_free_queue< int > >();
+}
+
+// Current test description:
+//       * With several producers, every item is delivered once and in the order of its producer;
+//         blocking producers lose nothing, and the others lose items only to a full queue
+TEST_CASE( "concurrent producers", "[lock free queue]" )
+{
+    const int producers = 4, items = 20000;
+    {
+        lock_free_queue< int > q( 64, 8 );
+        CHECK( run_producers( q, producers, items, true ) == size_t( producers * items ) );
+    }
+    {
+        lock_free_queue< int > q( 64 );
+        auto received = run_producers( q, producers, items, false );
+        CHECK( received > 0 );
+        CHECK( received <= size_t( producers * items ) );
+    }
+}
+
+// Current test description:
+//       * Time the enqueue calls of producer threads, as seen by a sensor callback, while a consumer
+//         waits for and drains the items, for both queues and for a spinning consumer
+TEST_CASE( "enqueue latency benchmark", "[lock free queue][benchmark][.]" )
+{
+    const int items = 200000;
+
+    // Returns the average time of an enqueue call, in ns
+    auto measure = []( std::function< void( int & ) > enqueue, std::function< bool( int & ) > dequeue, int producers ) {
+        std::atomic< long long > enqueue_ns( 0 );
+        std::atomic< int > running( producers );
+        std::vector< std::thread > threads;
+        for( int p = 0; p < producers; ++p )
+            threads.emplace_back( [&]() {
+                for( int i = 0; i < items; ++i )
+                {
+                    auto start = std::chrono::steady_clock::now();
+                    enqueue( i );
+                    enqueue_ns += std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - start ).count();
+                    if( i % 64 == 0 )
+                        std::this_thread::yield(); // Let the consumer catch up, as frames arrive over time
+                }
+                --running;
+            } );
+        int item;
+        while( dequeue( item ) || running )
+            ;
+        for( auto & t : threads )
+            t.join();
+        return double( enqueue_ns ) / ( producers * items );
+    };
+
+    for( int producers : { 1, 4 } )
+    {
+        std::cout << producers << " producer(s), " << items << " items each, ns per enqueue:" << std::endl;
+        {
+            single_consumer_queue< int > q( 1024 );
+            std::cout << "  single_consumer_queue       "
+                      << measure( [&]( int & i ) { q.enqueue( std::move( i ) ); },
+                                  [&]( int & i ) { return q.dequeue( &i, 10 ); }, producers )
+                      << std::endl;
+        }
+        for( unsigned int spin : { 0, 64 } )
+        {
+            lock_free_queue< int > q( 1024, spin );
+            std::cout << "  lock_free_queue, " << spin << " spins  " << ( spin ? "" : " " )
+                      << measure( [&]( int & i ) { q.enqueue( std::move( i ) ); },
+                                  [&]( int & i ) { return q.dequeue( &i, 10 ); }, producers )
+                      << std::endl;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../func-common.h"
+
+#include <mutex>
+#include <thread>
+
+using namespace rs2;
+
+// Test group description:
+//       * This tests group verifies that zero-copy frames, which hold their capture buffer until released,
+//         can outlive the stream they came from.
+
+namespace
+{
+    const size_t HELD_FRAMES = 2;  // Below the buffers always left to the driver
+
+    struct zero_copy_depth
+    {
+        depth_sensor sensor;
+        stream_profile profile;
+        std::mutex mutex;
+        std::vector< frame > held;
+
+        explicit zero_copy_depth( depth_sensor s )
+            : sensor( s )
+            , profile( find_default_depth_profile( s ) )
+        {
+        }
+
+        // Stream until HELD_FRAMES frames are held
+        void stream()
+        {
+            sensor.open( profile );
+            sensor.start( [&]( frame f ) {
+                std::lock_guard< std::mutex > lock( mutex );
+                if( held.size() < HELD_FRAMES )
+                    held.push_back( f );
+            } );
+            for( int i = 0; i < 100 && held_count() < HELD_FRAMES; ++i )
+                std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            REQUIRE( held_count() == HELD_FRAMES );
+        }
+
+        size_t held_count()
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            return held.size();
+        }
+
+        void release()
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            held.clear();
+        }
+    };
+}
+
+// Current test description:
+//       * Hold zero-copy frames past the close of their stream: their pixels stay readable, releasing them
+//         afterwards is safe, and the sensor streams again once they are released
+TEST_CASE( "zero-copy frames released after close", "[d400][live]" )
+{
+    auto devices = find_devices_by_product_line_or_exit( RS2_PRODUCT_LINE_D400 );
+    auto depth_sens = devices[0].first< rs2::depth_sensor >();
+    if( ! depth_sens.supports( RS2_OPTION_ZERO_COPY_CAPTURE ) )
+    {
+        std::cout << "Zero-copy capture is not supported by this backend; skipping test" << std::endl;
+        return;
+    }
+
+    REQUIRE_NOTHROW( depth_sens.set_option( RS2_OPTION_ZERO_COPY_CAPTURE, 1.f ) );
+    zero_copy_depth s( depth_sens );
+
+    s.stream();
+    s.sensor.stop();
+    s.sensor.close();
+
+    // The capture buffers stay mapped while the frames hold them: reading them must not fault
+    for( auto && f : s.held )
+    {
+        auto vf = f.as< video_frame >();
+        REQUIRE( f.get_data_size() >= vf.get_height() * vf.get_stride_in_bytes() );
+        auto pixels = static_cast< const uint8_t * >( f.get_data() );
+        CHECK( std::count( pixels, pixels + f.get_data_size(), uint8_t( 0xff ) ) <= f.get_data_size() );
+    }
+    s.release();
+
+    s.stream();
+    s.sensor.stop();
+    s.sensor.close();
+    s.release();
+
+    depth_sens.set_option( RS2_OPTION_ZERO_COPY_CAPTURE, 0.f );
+}
+
+// Current test description:
+//       * Open the sensor again while frames of the previous stream are still held: the open waits for them to be
+//         released, then streams normally
+TEST_CASE( "zero-copy reopen waits for held frames", "[d400][live]" )
+{
+    auto devices = find_devices_by_product_line_or_exit( RS2_PRODUCT_LINE_D400 );
+    auto depth_sens = devices[0].first< rs2::depth_sensor >();
+    if( ! depth_sens.supports( RS2_OPTION_ZERO_COPY_CAPTURE ) )
+    {
+        std::cout << "Zero-copy capture is not supported by this backend; skipping test" << std::endl;
+        return;
+    }
+
+    REQUIRE_NOTHROW( depth_sens.set_option( RS2_OPTION_ZERO_COPY_CAPTURE, 1.f ) );
+    zero_copy_depth s( depth_sens );
+
+    s.stream();
+    s.sensor.stop();
+    s.sensor.close();
+
+    std::thread releaser( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        s.release();
+    } );
+    s.stream();
+    releaser.join();
+
+    s.sensor.stop();
+    s.sensor.close();
+    s.release();
+
+    depth_sens.set_option( RS2_OPTION_ZERO_COPY_CAPTURE, 0.f );
+}
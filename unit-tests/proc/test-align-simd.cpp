@@ -0,0 +1,120 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/align-simd.cpp
+//#cmake:add-file ../../src/proc/align-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/align-simd.h"
+#include <librealsense2/rsutil.h>
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized projection of align against the deprojection,
+//         transformation and projection of each depth pixel with rsutil.h.
+
+namespace
+{
+    rs2_intrinsics make_intrinsics( int width, int height, rs2_distortion model )
+    {
+        rs2_intrinsics intrin = { width, height, width / 2.f + 0.3f, height / 2.f - 0.7f, 610.4f, 609.8f, model,
+                                  { 0.12f, -0.25f, 0.0012f, -0.0009f, 0.09f } };
+        return intrin;
+    }
+
+    void compare_projections( rs2_distortion model, size_t count )
+    {
+        const int width = 848, height = 480;
+        const rs2_intrinsics depth_intrin = make_intrinsics( width, height, RS2_DISTORTION_BROWN_CONRADY );
+        align_projection p;
+        p.other = make_intrinsics( 1280, 720, model );
+        p.depth_to_other = { { 0.9999f, 0.0042f, -0.0113f, -0.0041f, 0.9999f, 0.0061f, 0.0113f, -0.0061f, 0.9999f },
+                             { 0.0147f, 0.0003f, 0.0002f } };
+        p.depth_scale = 0.001f;
+
+        std::mt19937 gen( 5 );
+        std::vector< uint16_t > depth( count );
+        std::vector< float > ray_x( count ), ray_y( count );
+        std::vector< int > expected_x( count ), expected_y( count );
+        for( size_t i = 0; i < count; ++i )
+        {
+            depth[i] = uint16_t( 200 + gen() % 8000 );
+            float pixel[2] = { ( gen() % ( width + 1 ) ) - 0.5f, ( gen() % ( height + 1 ) ) - 0.5f }, ray[3];
+            rs2_deproject_pixel_to_point( ray, &depth_intrin, pixel, 1.f );
+            ray_x[i] = ray[0];
+            ray_y[i] = ray[1];
+
+            // As align::project_depth, and the align_images of earlier versions
+            float depth_point[3], other_point[3], other_pixel[2];
+            rs2_deproject_pixel_to_point( depth_point, &depth_intrin, pixel, p.depth_scale * depth[i] );
+            rs2_transform_point_to_point( other_point, &p.depth_to_other, depth_point );
+            rs2_project_point_to_pixel( other_pixel, &p.other, other_point );
+            expected_x[i] = static_cast< int >( other_pixel[0] + 0.5f );
+            expected_y[i] = static_cast< int >( other_pixel[1] + 0.5f );
+        }
+
+        std::vector< int > other_x( count, -1 ), other_y( count, -1 );
+        auto done = align_project_simd( depth.data(), ray_x.data(), ray_y.data(), count, p, other_x.data(), other_y.data() );
+        REQUIRE( done > count - 8 );
+        REQUIRE( done <= count );
+        other_x.resize( done );
+        other_y.resize( done );
+        expected_x.resize( done );
+        expected_y.resize( done );
+
+        CAPTURE( model, count );
+        REQUIRE( other_x == expected_x );
+        REQUIRE( other_y == expected_y );
+    }
+}
+
+// Current test description:
+//       * Project pixels with the distortion models that are vectorized, including counts that are not a
+//         multiple of the vectors, and compare the pixels of the other image with the scalar code
+TEST_CASE( "align projection matches scalar", "[align simd]" )
+{
+    if( ! align_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the align for this CPU: nothing was compared" );
+        return;
+    }
+
+    for( size_t count : { 8, 1000, 848 * 3 + 5 } )
+    {
+        compare_projections( RS2_DISTORTION_NONE, count );
+        compare_projections( RS2_DISTORTION_MODIFIED_BROWN_CONRADY, count );
+        compare_projections( RS2_DISTORTION_INVERSE_BROWN_CONRADY, count );
+        compare_projections( RS2_DISTORTION_BROWN_CONRADY, count );
+    }
+}
+
+// Current test description:
+//       * Models that need trigonometry are left to the caller
+TEST_CASE( "align projection skips other models", "[align simd]" )
+{
+    align_projection p = {};
+    p.other.model = RS2_DISTORTION_FTHETA;
+    std::vector< uint16_t > depth( 16, 1000 );
+    std::vector< float > ray( 16 );
+    std::vector< int > out( 16 );
+    CHECK( align_project_simd( depth.data(), ray.data(), ray.data(), 16, p, out.data(), out.data() ) == 0 );
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "align AVX2 kernels are built", "[align simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::align_built() );
+}
@@ -0,0 +1,122 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/color-formats-simd.cpp
+//#cmake:add-file ../../src/proc/color-formats-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/color-formats-simd.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized YUY2 and UYVY unpackers against the scalar
+//         conversion of unpack_yuy2 and unpack_uyvy, for every destination format.
+
+namespace
+{
+    uint8_t clamp_byte( int v ) { return uint8_t( std::min( std::max( v, 0 ), 255 ) ); }
+
+    size_t bytes_per_pixel( rs2_format format )
+    {
+        switch( format )
+        {
+        case RS2_FORMAT_Y8: return 1;
+        case RS2_FORMAT_Y16: return 2;
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8: return 3;
+        default: return 4;
+        }
+    }
+
+    // The per-pixel conversion of the generic (non-SSSE3) code
+    void reference_unpack( rs2_format src_format, rs2_format dst_format, uint8_t * dst, const uint8_t * src, size_t count )
+    {
+        const bool uyvy = src_format == RS2_FORMAT_UYVY;
+        for( size_t i = 0; i < count; ++i, dst += bytes_per_pixel( dst_format ) )
+        {
+            const uint8_t * mp = src + 4 * ( i / 2 );
+            int y = mp[uyvy ? ( i % 2 ? 3 : 1 ) : ( i % 2 ? 2 : 0 )];
+            int u = mp[uyvy ? 0 : 1];
+            int v = mp[uyvy ? 2 : 3];
+
+            if( dst_format == RS2_FORMAT_Y8 )
+            {
+                dst[0] = uint8_t( y );
+                continue;
+            }
+            if( dst_format == RS2_FORMAT_Y16 )
+            {
+                dst[0] = 0;
+                dst[1] = uint8_t( y );
+                continue;
+            }
+
+            int c = y - 16, d = u - 128, e = v - 128;
+            uint8_t r = clamp_byte( ( 298 * c + 409 * e + 128 ) >> 8 );
+            uint8_t g = clamp_byte( ( 298 * c - 100 * d - 208 * e + 128 ) >> 8 );
+            uint8_t b = clamp_byte( ( 298 * c + 516 * d + 128 ) >> 8 );
+            bool rgb = dst_format == RS2_FORMAT_RGB8 || dst_format == RS2_FORMAT_RGBA8;
+            dst[0] = rgb ? r : b;
+            dst[1] = g;
+            dst[2] = rgb ? b : r;
+            if( bytes_per_pixel( dst_format ) == 4 )
+                dst[3] = 255;
+        }
+    }
+}
+
+// Current test description:
+//       * Unpack random YUYV and UYVY images, including values that saturate, into every destination
+//         format, and compare the output with the scalar conversion byte for byte
+TEST_CASE( "YUY2 and UYVY unpacking matches scalar", "[color formats simd]" )
+{
+    if( ! unpack_yuv_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the YUY2 and UYVY unpacking for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 13 );
+    for( size_t count : { 16, 640 * 2, 16 * 37 + 6 } )
+    {
+        std::vector< uint8_t > src( count * 2 );
+        for( auto & b : src )
+            b = uint8_t( gen() );
+
+        for( rs2_format src_format : { RS2_FORMAT_YUYV, RS2_FORMAT_UYVY } )
+            for( rs2_format dst_format : { RS2_FORMAT_Y8, RS2_FORMAT_Y16, RS2_FORMAT_RGB8, RS2_FORMAT_BGR8,
+                                           RS2_FORMAT_RGBA8, RS2_FORMAT_BGRA8 } )
+            {
+                const size_t bpp = bytes_per_pixel( dst_format );
+                std::vector< uint8_t > expected( count * bpp ), actual( count * bpp );
+                reference_unpack( src_format, dst_format, expected.data(), src.data(), count );
+
+                auto done = unpack_yuv_simd( src_format, dst_format, actual.data(), src.data(), count );
+                CHECK( done == count - count % UNPACK_YUV_BLOCK );
+                reference_unpack( src_format, dst_format, actual.data() + done * bpp, src.data() + done * 2, count - done );
+
+                CAPTURE( src_format, dst_format, count );
+                REQUIRE( actual == expected );
+            }
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "YUY2 and UYVY unpacking AVX2 kernels are built", "[color formats simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::unpack_yuv_built() );
+}
@@ -0,0 +1,79 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/colorizer-simd.cpp
+//#cmake:add-file ../../src/proc/colorizer-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/colorizer-simd.h"
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized coloring of depth through the colorizer lookup table
+//         against looking up each pixel.
+
+namespace
+{
+    void reference_colorize( uint8_t * rgb, const uint16_t * depth, const uint32_t * lut, size_t count )
+    {
+        for( size_t i = 0; i < count; ++i )
+        {
+            auto c = lut[depth[i]];
+            rgb[i * 3 + 0] = uint8_t( c );
+            rgb[i * 3 + 1] = uint8_t( c >> 8 );
+            rgb[i * 3 + 2] = uint8_t( c >> 16 );
+        }
+    }
+}
+
+// Current test description:
+//       * Color random depth through a random table, and compare the output with looking up each pixel.
+//         The bytes past the last pixel must be left alone, as the vector stores overlap
+TEST_CASE( "Colorizer table lookup matches scalar", "[colorizer simd]" )
+{
+    if( ! colorizer_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the colorizer for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 17 );
+    std::vector< uint32_t > lut( 0x10000 );
+    for( auto & c : lut )
+        c = gen() & 0xffffff;
+
+    for( size_t count : { 10, 848 * 2, 8 * 37 + 5 } )
+    {
+        CAPTURE( count );
+        std::vector< uint16_t > depth( count );
+        for( auto & d : depth )
+            d = uint16_t( gen() );
+
+        const size_t guard = 16;
+        std::vector< uint8_t > expected( count * 3 + guard, 0xcd ), actual( count * 3 + guard, 0xcd );
+        reference_colorize( expected.data(), depth.data(), lut.data(), count );
+        auto done = colorize_lut_simd( actual.data(), depth.data(), lut.data(), count );
+        CHECK( done + 10 > count );
+        reference_colorize( actual.data() + done * 3, depth.data() + done, lut.data(), count - done );
+        REQUIRE( actual == expected );
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "colorizer AVX2 kernels are built", "[colorizer simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::colorizer_built() );
+}
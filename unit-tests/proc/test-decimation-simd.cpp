@@ -0,0 +1,94 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/decimation-simd.cpp
+//#cmake:add-file ../../src/proc/decimation-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/decimation-simd.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized median decimation of depth against the median of the
+//         non-zero pixels of each patch that decimation_filter picks in scalar code.
+
+namespace
+{
+    // The median of the non-zero pixels of each patch, the lower one for an even number of them
+    void reference_median( uint16_t * out, const uint16_t * in, size_t stride, size_t count, size_t scale )
+    {
+        for( size_t i = 0; i < count; ++i )
+        {
+            std::vector< uint16_t > pixels;
+            for( size_t n = 0; n < scale; ++n )
+                for( size_t m = 0; m < scale; ++m )
+                    if( auto d = in[n * stride + i * scale + m] )
+                        pixels.push_back( d );
+            std::sort( pixels.begin(), pixels.end() );
+            out[i] = pixels.empty() ? 0 : pixels[( pixels.size() - 1 ) / 2];
+        }
+    }
+
+    // Patches with any number of zeros, and values that repeat
+    std::vector< uint16_t > random_depth( std::mt19937 & gen, size_t count )
+    {
+        std::vector< uint16_t > depth( count );
+        const uint16_t zero_odds = uint16_t( 1 + gen() % 4 );
+        for( auto & d : depth )
+            d = gen() % 5 < zero_odds ? 0 : uint16_t( gen() % 2 ? 1000 + gen() % 8 : gen() );
+        return depth;
+    }
+}
+
+// Current test description:
+//       * Decimate random rows with 2x2 and 3x3 patches, from none to most of their pixels zero, and
+//         compare the output with the median of the non-zero pixels of each patch
+TEST_CASE( "Median decimation matches scalar", "[decimation simd]" )
+{
+    if( ! decimation_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the median decimation for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 13 );
+    for( size_t scale : { 2, 3 } )
+    {
+        for( size_t count : { 16, 424, 16 * 37 + 5 } )
+        {
+            for( int repeat = 0; repeat < 8; ++repeat )
+            {
+                CAPTURE( count, scale );
+                const size_t stride = count * scale + 3;
+                auto depth = random_depth( gen, stride * scale );
+                std::vector< uint16_t > expected( count ), actual( count );
+
+                reference_median( expected.data(), depth.data(), stride, count, scale );
+                auto done = decimate_depth_median_simd( actual.data(), depth.data(), stride, count, scale );
+                CHECK( done + 16 > count );
+                reference_median( actual.data() + done, depth.data() + done * scale, stride, count - done, scale );
+                REQUIRE( actual == expected );
+            }
+        }
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "median decimation AVX2 kernels are built", "[decimation simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::decimation_built() );
+}
@@ -0,0 +1,125 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/hdr-merge-simd.cpp
+//#cmake:add-file ../../src/proc/hdr-merge-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/hdr-merge-simd.h"
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized merge of the depth of two HDR exposures against
+//         the scalar merge of hdr_merge, with and without infrared.
+
+namespace
+{
+    const hdr_ir_range Y8_RANGE{ 0x05, 0xfa };
+    const hdr_ir_range Y16_RANGE{ 0x14, 0x3eb };
+
+    // The per-pixel merge of hdr_merge; no infrared trusts every pixel
+    template< class IR >
+    void reference_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                          const IR * ir0, const IR * ir1, size_t count, hdr_ir_range range )
+    {
+        for( size_t i = 0; i < count; ++i )
+        {
+            bool valid0 = ! ir0 || ( ir0[i] > range.under_saturated && ir0[i] < range.over_saturated );
+            bool valid1 = ! ir1 || ( ir1[i] > range.under_saturated && ir1[i] < range.over_saturated );
+            if( valid0 && d0[i] )
+                out[i] = d0[i];
+            else if( valid1 && d1[i] )
+                out[i] = d1[i];
+            else
+                out[i] = 0;
+        }
+    }
+
+    // Values around both ends of the range, and any other
+    template< class IR >
+    std::vector< IR > random_ir( std::mt19937 & gen, size_t count, hdr_ir_range range )
+    {
+        std::vector< IR > ir( count );
+        for( auto & v : ir )
+        {
+            switch( gen() % 4 )
+            {
+            case 0: v = IR( range.under_saturated - 2 + int( gen() % 5 ) ); break;
+            case 1: v = IR( range.over_saturated - 2 + int( gen() % 5 ) ); break;
+            default: v = IR( gen() ); break;
+            }
+        }
+        return ir;
+    }
+
+    std::vector< uint16_t > random_depth( std::mt19937 & gen, size_t count )
+    {
+        std::vector< uint16_t > depth( count );
+        for( auto & d : depth )
+            d = gen() % 3 ? uint16_t( gen() ) : 0;
+        return depth;
+    }
+}
+
+// Current test description:
+//       * Merge random exposures, with a third of the depth pixels zero and infrared values on both sides
+//         of the saturation thresholds, and compare the output with the scalar merge
+TEST_CASE( "HDR merge matches scalar", "[hdr merge simd]" )
+{
+    if( ! hdr_merge_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the HDR merge for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 7 );
+    for( size_t count : { 16, 848 * 2, 16 * 37 + 5 } )
+    {
+        auto d0 = random_depth( gen, count ), d1 = random_depth( gen, count );
+        std::vector< uint16_t > expected( count ), actual( count );
+        CAPTURE( count );
+
+        {
+            reference_merge< uint8_t >( expected.data(), d0.data(), d1.data(), nullptr, nullptr, count, Y8_RANGE );
+            auto done = hdr_merge_depth_simd( actual.data(), d0.data(), d1.data(), count );
+            CHECK( done > count - 16 );
+            reference_merge< uint8_t >( actual.data() + done, d0.data() + done, d1.data() + done, nullptr, nullptr, count - done, Y8_RANGE );
+            REQUIRE( actual == expected );
+        }
+        {
+            auto ir0 = random_ir< uint8_t >( gen, count, Y8_RANGE ), ir1 = random_ir< uint8_t >( gen, count, Y8_RANGE );
+            reference_merge( expected.data(), d0.data(), d1.data(), ir0.data(), ir1.data(), count, Y8_RANGE );
+            auto done = hdr_merge_ir_simd( actual.data(), d0.data(), d1.data(), ir0.data(), ir1.data(), count, Y8_RANGE );
+            CHECK( done > count - 16 );
+            reference_merge( actual.data() + done, d0.data() + done, d1.data() + done, ir0.data() + done, ir1.data() + done, count - done, Y8_RANGE );
+            REQUIRE( actual == expected );
+        }
+        {
+            auto ir0 = random_ir< uint16_t >( gen, count, Y16_RANGE ), ir1 = random_ir< uint16_t >( gen, count, Y16_RANGE );
+            reference_merge( expected.data(), d0.data(), d1.data(), ir0.data(), ir1.data(), count, Y16_RANGE );
+            auto done = hdr_merge_ir_simd( actual.data(), d0.data(), d1.data(), ir0.data(), ir1.data(), count, Y16_RANGE );
+            CHECK( done > count - 16 );
+            reference_merge( actual.data() + done, d0.data() + done, d1.data() + done, ir0.data() + done, ir1.data() + done, count - done, Y16_RANGE );
+            REQUIRE( actual == expected );
+        }
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "HDR merge AVX2 kernels are built", "[hdr merge simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::hdr_merge_built() );
+}
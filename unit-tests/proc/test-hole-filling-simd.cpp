@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/hole-filling-simd.cpp
+//#cmake:add-file ../../src/proc/hole-filling-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/hole-filling-simd.h"
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized hole filling of depth rows against the per-pixel
+//         scalar filling of hole_filling_filter, for each of its modes.
+
+namespace
+{
+    enum class fill_mode { left, farest, nearest };
+
+    // The per-pixel filling of hole_filling_filter, from index 'first' of the row on
+    void reference_fill( uint16_t * row, const uint16_t * above, const uint16_t * below,
+                         size_t first, size_t width, fill_mode mode )
+    {
+        for( size_t i = first; i < width; ++i )
+        {
+            if( row[i] )
+                continue;
+            if( mode == fill_mode::left )
+            {
+                row[i] = row[i - 1];
+                continue;
+            }
+            uint16_t tmp = above[i];
+            for( uint16_t v : { above[i - 1], row[i - 1], below[i - 1], below[i] } )
+            {
+                if( mode == fill_mode::farest ? v > tmp : v && v < tmp )
+                    tmp = v;
+            }
+            row[i] = tmp;
+        }
+    }
+
+    void simd_fill( uint16_t * row, const uint16_t * above, const uint16_t * below,
+                    size_t width, fill_mode mode )
+    {
+        size_t done = mode == fill_mode::left
+                        ? hole_fill_left_simd( row, width )
+                        : hole_fill_around_simd( row, above, below, width, mode == fill_mode::farest );
+        CHECK( done + 16 > width );
+        reference_fill( row, above, below, done, width, mode );
+    }
+
+    // Runs of holes of any length, including whole blocks, between runs of depth
+    std::vector< uint16_t > random_depth( std::mt19937 & gen, size_t count )
+    {
+        std::vector< uint16_t > depth( count );
+        for( size_t i = 0; i < count; )
+        {
+            size_t run = 1 + gen() % 40;
+            bool holes = gen() % 2 != 0;
+            for( ; run && i < count; --run, ++i )
+                depth[i] = holes ? 0 : uint16_t( 1 + gen() % 0xffff );
+        }
+        return depth;
+    }
+}
+
+// Current test description:
+//       * Fill random frames, with runs of holes of random lengths, in each mode and compare the
+//         output with the scalar filling, row after row as the filter does
+TEST_CASE( "Hole filling matches scalar", "[hole filling simd]" )
+{
+    if( ! hole_filling_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the hole filling for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 11 );
+    const size_t height = 8;
+    for( size_t width : { 17, 848, 16 * 37 + 5 } )
+    {
+        for( auto mode : { fill_mode::left, fill_mode::farest, fill_mode::nearest } )
+        {
+            CAPTURE( width, mode );
+            auto expected = random_depth( gen, width * height );
+            auto actual = expected;
+            for( size_t j = 1; j + 1 < height; ++j )
+            {
+                size_t row = j * width;
+                reference_fill( &expected[row], &expected[row - width], &expected[row + width], 1, width, mode );
+                simd_fill( &actual[row], &actual[row - width], &actual[row + width], width, mode );
+            }
+            REQUIRE( actual == expected );
+        }
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "hole filling AVX2 kernels are built", "[hole filling simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::hole_filling_built() );
+}
@@ -0,0 +1,121 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/interleaved-ir-simd.cpp
+//#cmake:add-file ../../src/proc/interleaved-ir-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/interleaved-ir-simd.h"
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized split of interleaved left/right infrared (Y8I and Y12I)
+//         against the per-pixel conversion.
+
+namespace
+{
+    void reference_y8i( uint8_t * left, uint8_t * right, const uint8_t * source, size_t count )
+    {
+        for( size_t i = 0; i < count; ++i )
+        {
+            left[i] = source[i * 2];
+            right[i] = source[i * 2 + 1];
+        }
+    }
+
+    uint16_t scale_10_to_16( int v )
+    {
+        return uint16_t( v << 6 | v >> 4 );
+    }
+
+    void reference_y12i( uint16_t * left, uint16_t * right, const uint8_t * source, size_t count )
+    {
+        for( size_t i = 0; i < count; ++i )
+        {
+            const uint8_t * p = source + i * 3;
+            right[i] = scale_10_to_16( p[0] | ( p[1] & 0x0f ) << 8 );
+            left[i] = scale_10_to_16( p[1] >> 4 | p[2] << 4 );
+        }
+    }
+}
+
+// Current test description:
+//       * Split random Y8I pixels, and compare both images with the per-pixel split.
+//         Nothing may be written past the last pixel
+TEST_CASE( "Y8I split matches scalar", "[interleaved-ir simd]" )
+{
+    if( ! interleaved_ir_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the interleaved infrared split for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 5 );
+    for( size_t count : { 7, 848 * 2, 32 * 11 + 19 } )
+    {
+        CAPTURE( count );
+        std::vector< uint8_t > source( count * 2 );
+        for( auto & b : source )
+            b = uint8_t( gen() );
+
+        const size_t guard = 32;
+        std::vector< uint8_t > expected_left( count + guard, 0xcd ), expected_right( count + guard, 0xcd );
+        std::vector< uint8_t > left( count + guard, 0xcd ), right( count + guard, 0xcd );
+        reference_y8i( expected_left.data(), expected_right.data(), source.data(), count );
+        auto done = unpack_y8i_simd( left.data(), right.data(), source.data(), count );
+        CHECK( done <= count );
+        reference_y8i( left.data() + done, right.data() + done, source.data() + done * 2, count - done );
+        REQUIRE( left == expected_left );
+        REQUIRE( right == expected_right );
+    }
+}
+
+// Current test description:
+//       * Split random Y12I pixels, and compare both Y16 images with the per-pixel conversion.
+//         Nothing may be written past the last pixel
+TEST_CASE( "Y12I split matches scalar", "[interleaved-ir simd]" )
+{
+    if( ! interleaved_ir_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the interleaved infrared split for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 11 );
+    for( size_t count : { 5, 848 * 2, 16 * 13 + 9 } )
+    {
+        CAPTURE( count );
+        std::vector< uint8_t > source( count * 3 );
+        for( auto & b : source )
+            b = uint8_t( gen() );
+
+        const size_t guard = 16;
+        std::vector< uint16_t > expected_left( count + guard, 0xcdcd ), expected_right( count + guard, 0xcdcd );
+        std::vector< uint16_t > left( count + guard, 0xcdcd ), right( count + guard, 0xcdcd );
+        reference_y12i( expected_left.data(), expected_right.data(), source.data(), count );
+        auto done = unpack_y12i_simd( left.data(), right.data(), source.data(), count );
+        CHECK( done <= count );
+        reference_y12i( left.data() + done, right.data() + done, source.data() + done * 3, count - done );
+        REQUIRE( left == expected_left );
+        REQUIRE( right == expected_right );
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "interleaved infrared split AVX2 kernels are built", "[interleaved-ir simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::interleaved_ir_built() );
+}
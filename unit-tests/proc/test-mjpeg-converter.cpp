@@ -0,0 +1,357 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../test.h"
+#include "../../src/proc/color-formats-converter.h"
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies that the MJPEG converter, decoding on several threads, delivers its frames in
+//         the order they arrived and with the pixels it decodes on the calling thread, drops the frames that arrive
+//         while all of its threads are behind, and hands its frames on without holding its locks.
+
+namespace
+{
+    const int W = 32, H = 16;
+
+    // A W x H baseline JPEG, with 4:2:0 chroma subsampling, of the gradient expected_pixel() describes
+    const uint8_t gradient_jpeg[] = {
+        0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+        0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x84, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x04, 0x06,
+        0x06, 0x05, 0x06, 0x07, 0x07, 0x06, 0x08, 0x0a, 0x10, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x14, 0x0e,
+        0x0f, 0x0c, 0x10, 0x17, 0x14, 0x18, 0x18, 0x17, 0x14, 0x16, 0x16, 0x1a, 0x1d, 0x25, 0x1f, 0x1a,
+        0x1b, 0x23, 0x1c, 0x16, 0x16, 0x20, 0x2c, 0x20, 0x23, 0x26, 0x27, 0x29, 0x2a, 0x29, 0x19, 0x1f,
+        0x2d, 0x30, 0x2d, 0x28, 0x30, 0x25, 0x28, 0x29, 0x28, 0x01, 0x07, 0x07, 0x07, 0x0a, 0x08, 0x0a,
+        0x13, 0x0a, 0x0a, 0x13, 0x28, 0x1a, 0x16, 0x1a, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+        0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+        0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+        0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00,
+        0x10, 0x00, 0x20, 0x03, 0x01, 0x11, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x01,
+        0xa2, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x10, 0x00,
+        0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01,
+        0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22,
+        0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24,
+        0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29,
+        0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+        0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+        0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
+        0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8,
+        0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+        0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3,
+        0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+        0xfa, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x11, 0x00,
+        0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+        0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+        0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+        0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+        0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+        0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+        0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+        0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+        0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+        0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+        0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf2,
+        0xdb, 0x7f, 0x0f, 0xf4, 0xf9, 0x3f, 0x4a, 0xfd, 0x8f, 0x15, 0x9a, 0x79, 0x9e, 0x06, 0x13, 0x30,
+        0xf3, 0x34, 0xed, 0xfc, 0x3f, 0xd3, 0xe4, 0xfd, 0x2b, 0xe7, 0x31, 0x59, 0xa7, 0x99, 0xf5, 0x18,
+        0x4c, 0xc3, 0xcc, 0xd4, 0xb7, 0xf0, 0xff, 0x00, 0x4f, 0x93, 0xf4, 0xaf, 0x9c, 0xc5, 0x66, 0x9e,
+        0x67, 0xd4, 0x61, 0x33, 0x0f, 0x33, 0x4e, 0xdf, 0xc3, 0xfd, 0x3e, 0x4f, 0xd2, 0xbe, 0x73, 0x15,
+        0x9a, 0x79, 0x9f, 0x53, 0x84, 0xcc, 0x3c, 0xce, 0x92, 0xdf, 0xc3, 0xfd, 0x3e, 0x4f, 0xd2, 0xbe,
+        0x8b, 0x15, 0x9a, 0x79, 0x9f, 0xc9, 0x98, 0x4c, 0xc3, 0xcc, 0xd3, 0xb7, 0xf0, 0xff, 0x00, 0x4f,
+        0x93, 0xf4, 0xaf, 0x9c, 0xc5, 0x66, 0x9e, 0x67, 0xd4, 0xe1, 0x33, 0x0f, 0x33, 0x52, 0xdf, 0xc3,
+        0xfd, 0x3e, 0x4f, 0xd2, 0xbe, 0x6f, 0x15, 0x9a, 0x79, 0x9f, 0x51, 0x84, 0xcc, 0x3c, 0xcd, 0x3b,
+        0x7f, 0x0f, 0xf4, 0xf9, 0x3f, 0x4a, 0xf9, 0xcc, 0x56, 0x69, 0xe6, 0x7d, 0x46, 0x13, 0x30, 0xf3,
+        0x3f, 0xff, 0xd9,
+    };
+
+    void expected_pixel( int x, int y, uint8_t rgb[3] )
+    {
+        rgb[0] = uint8_t( x * 8 );
+        rgb[1] = uint8_t( y * 16 );
+        rgb[2] = uint8_t( 255 - ( x + y ) * 5 );
+    }
+
+    // MJPEG frames from a software sensor. Unless use_jpeg() was called, their data is not a valid image: they
+    // fail to decode, and are delivered all the same, which is enough for the order of delivery
+    struct mjpeg_source
+    {
+        rs2::software_device dev;
+        rs2::software_sensor sensor;
+        rs2::stream_profile mjpeg;
+        rs2::frame_queue queue;
+        std::vector< uint8_t > data;
+
+        mjpeg_source()
+            : sensor( dev.add_sensor( "color" ) )
+            , queue( 100, true )
+            , data( W * H * 2 )
+        {
+            rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+            mjpeg = sensor.add_video_stream( { RS2_STREAM_COLOR, 0, 301, W, H, 30, 2, RS2_FORMAT_MJPEG, intrinsics } );
+            sensor.open( mjpeg );
+            sensor.start( queue );
+        }
+
+        ~mjpeg_source()
+        {
+            sensor.stop();
+            sensor.close();
+        }
+
+        // The frames carry the JPEG, followed by zeros up to their size
+        void use_jpeg( const uint8_t * jpeg, size_t size )
+        {
+            REQUIRE( size <= data.size() );
+            std::fill( std::copy( jpeg, jpeg + size, data.begin() ), data.end(), uint8_t( 0 ) );
+        }
+
+        rs2::frame next( int frame_number )
+        {
+            sensor.on_video_frame( { data.data(), []( void * ) {}, W * 2, 2, double( frame_number ),
+                                     RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number, mjpeg } );
+            return queue.wait_for_frame();
+        }
+    };
+
+    rs2::processing_block make_converter()
+    {
+        std::shared_ptr< processing_block_interface > converter = std::make_shared< mjpeg_converter >( RS2_FORMAT_RGB8 );
+        return rs2::processing_block( std::make_shared< rs2_processing_block >( converter ) );
+    }
+
+    struct delivered_frames
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector< unsigned long long > numbers;
+
+        void add( rs2::frame f )
+        {
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                CHECK( f.get_profile().format() == RS2_FORMAT_RGB8 );
+                numbers.push_back( f.get_frame_number() );
+            }
+            cv.notify_all();
+        }
+
+        size_t count()
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            return numbers.size();
+        }
+
+        // Waits until the given number of frames were delivered, or for a second without a new one
+        std::vector< unsigned long long > wait_for( size_t count )
+        {
+            std::unique_lock< std::mutex > lock( mutex );
+            while( numbers.size() < count )
+            {
+                auto seen = numbers.size();
+                if( ! cv.wait_for( lock, std::chrono::seconds( 1 ), [&]() { return numbers.size() != seen; } ) )
+                    break;
+            }
+            return numbers;
+        }
+    };
+
+    void check_increasing( const std::vector< unsigned long long > & numbers )
+    {
+        for( size_t i = 1; i < numbers.size(); ++i )
+        {
+            CAPTURE( i, numbers[i - 1], numbers[i] );
+            CHECK( numbers[i] > numbers[i - 1] );
+        }
+    }
+}
+
+// Current test description:
+//       * Decode frames on the calling thread, with an output callback that sets an option of the converter: the
+//         callback runs without the converter's locks held, and every frame is delivered, in order
+TEST_CASE( "mjpeg converter delivers outside its locks", "[mjpeg converter]" )
+{
+    mjpeg_source source;
+    auto converter = make_converter();
+    REQUIRE( converter.supports( RS2_OPTION_PROCESSING_THREADS ) );
+
+    delivered_frames delivered;
+    converter.start( [&]( rs2::frame f ) {
+        converter.set_option( RS2_OPTION_PROCESSING_THREADS, 1.f );
+        delivered.add( f );
+    } );
+    const int frames = 20;
+    for( int i = 0; i < frames; ++i )
+        converter.invoke( source.next( i ) );
+
+    auto numbers = delivered.wait_for( frames );
+    REQUIRE( numbers.size() == frames );
+    for( int i = 0; i < frames; ++i )
+        CHECK( numbers[i] == i );
+}
+
+// Current test description:
+//       * Decode frames on 4 threads, pushing them as they come: the frames that are delivered come out in the order
+//         they arrived. The first frame, and one pushed once the others were delivered, are never dropped
+TEST_CASE( "mjpeg converter keeps the order of its threads", "[mjpeg converter]" )
+{
+    mjpeg_source source;
+    auto converter = make_converter();
+    converter.set_option( RS2_OPTION_PROCESSING_THREADS, 4.f );
+
+    delivered_frames delivered;
+    converter.start( [&]( rs2::frame f ) { delivered.add( f ); } );
+    const int frames = 200;
+    for( int i = 0; i < frames; ++i )
+        converter.invoke( source.next( i ) );
+    auto before_last = delivered.wait_for( frames ).size();
+    converter.invoke( source.next( frames ) );
+
+    auto numbers = delivered.wait_for( before_last + 1 );
+    REQUIRE( numbers.size() == before_last + 1 );
+    CHECK( numbers.front() == 0 );
+    CHECK( numbers.back() == frames );
+    check_increasing( numbers );
+}
+
+// Current test description:
+//       * Block the output callback on the first frame while more frames arrive on 4 threads: the converter keeps
+//         accepting frames without waiting for the callback, holds no more than two per thread, and drops the rest.
+//         Once the callback returns, the frames held are delivered in order
+TEST_CASE( "mjpeg converter drops frames when behind", "[mjpeg converter]" )
+{
+    const int threads = 4;
+    mjpeg_source source;
+    auto converter = make_converter();
+    converter.set_option( RS2_OPTION_PROCESSING_THREADS, float( threads ) );
+
+    std::mutex gate_mutex;
+    std::condition_variable gate_cv;
+    bool gate_open = false;
+    bool first_blocked = false;
+    delivered_frames delivered;
+    converter.start( [&]( rs2::frame f ) {
+        {
+            std::unique_lock< std::mutex > lock( gate_mutex );
+            first_blocked = true;
+            gate_cv.notify_all();
+            gate_cv.wait( lock, [&]() { return gate_open; } );
+        }
+        delivered.add( f );
+    } );
+
+    converter.invoke( source.next( 0 ) );
+    {
+        std::unique_lock< std::mutex > lock( gate_mutex );
+        REQUIRE( gate_cv.wait_for( lock, std::chrono::seconds( 5 ), [&]() { return first_blocked; } ) );
+    }
+
+    // The callback is blocked: these return without waiting for it
+    const int frames = 50;
+    for( int i = 1; i < frames; ++i )
+        converter.invoke( source.next( i ) );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+    CHECK( delivered.count() == 0 );
+
+    {
+        std::lock_guard< std::mutex > lock( gate_mutex );
+        gate_open = true;
+    }
+    gate_cv.notify_all();
+
+    auto numbers = delivered.wait_for( frames );
+    CHECK( numbers.size() > 1 );
+    CHECK( numbers.size() <= 1 + 2 * threads );
+    CHECK( numbers.front() == 0 );
+    check_increasing( numbers );
+}
+
+// Current test description:
+//       * Decode a valid JPEG on the calling thread, then on 4 threads, pushing no more frames than the threads may
+//         hold: the image is decoded to RGB8 close to the gradient it was encoded from, and every frame decoded by
+//         the threads is delivered in order, with the same pixels as on the calling thread, however many frames
+//         each thread decoded before it
+TEST_CASE( "mjpeg converter decodes the same pixels on its threads", "[mjpeg converter]" )
+{
+    mjpeg_source source;
+    source.use_jpeg( gradient_jpeg, sizeof( gradient_jpeg ) );
+
+    std::mutex mutex;
+    std::vector< unsigned long long > numbers;
+    std::vector< std::vector< uint8_t > > pixels;
+    auto collect = [&]( rs2::frame f ) {
+        auto vf = f.as< rs2::video_frame >();
+        CHECK( vf.get_profile().format() == RS2_FORMAT_RGB8 );
+        CHECK( vf.get_width() == W );
+        CHECK( vf.get_height() == H );
+        auto data = static_cast< const uint8_t * >( vf.get_data() );
+        std::lock_guard< std::mutex > lock( mutex );
+        numbers.push_back( f.get_frame_number() );
+        pixels.emplace_back( data, data + W * H * 3 );
+    };
+    auto delivered = [&]() {
+        std::lock_guard< std::mutex > lock( mutex );
+        return numbers.size();
+    };
+
+    std::vector< uint8_t > reference;
+    {
+        auto converter = make_converter();
+        converter.start( collect );
+        converter.invoke( source.next( 0 ) );
+        REQUIRE( delivered() == 1 );
+        reference = pixels.front();
+    }
+
+    // JPEG is lossy: the decoded gradient is only close to the original
+    int total_error = 0;
+    for( int y = 0; y < H; ++y )
+        for( int x = 0; x < W; ++x )
+        {
+            uint8_t rgb[3];
+            expected_pixel( x, y, rgb );
+            for( int c = 0; c < 3; ++c )
+                total_error += std::abs( int( reference[( y * W + x ) * 3 + c] ) - int( rgb[c] ) );
+        }
+    CAPTURE( total_error );
+    CHECK( total_error < W * H * 3 * 4 );
+
+    const int threads = 4;
+    const int frames = 100;
+    numbers.clear();
+    pixels.clear();
+    {
+        auto converter = make_converter();
+        converter.set_option( RS2_OPTION_PROCESSING_THREADS, float( threads ) );
+        converter.start( collect );
+        for( int i = 0; i < frames; )
+        {
+            // Up to two frames per thread in flight are never dropped
+            auto batch_end = std::min( frames, i + 2 * threads );
+            for( ; i < batch_end; ++i )
+                converter.invoke( source.next( i ) );
+            for( int waited = 0; delivered() < size_t( i ) && waited < 5000; waited += 10 )
+                std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            REQUIRE( delivered() == size_t( i ) );
+        }
+    }
+
+    for( int i = 0; i < frames; ++i )
+    {
+        CAPTURE( i );
+        CHECK( numbers[i] == i );
+        CHECK( pixels[i] == reference );
+    }
+}
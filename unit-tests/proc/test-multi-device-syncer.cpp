@@ -0,0 +1,113 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include "../approx.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <memory>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies the matching of the frames of several devices by the multi-device syncer,
+//         and the synchronization metrics it keeps for each device.
+
+namespace
+{
+    const int W = 16, H = 8;
+
+    struct test_device
+    {
+        rs2::software_device dev;
+        rs2::software_sensor sensor;
+        rs2::stream_profile depth;
+
+        test_device( int index, rs2::multi_device_syncer & sync )
+            : sensor( dev.add_sensor( "depth" ) )
+        {
+            dev.register_info( RS2_CAMERA_INFO_SERIAL_NUMBER, std::to_string( 1000 + index ) );
+            rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+            depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 301 + index, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+            sensor.open( depth );
+            sensor.start( [&sync]( rs2::frame f ) { sync( f ); } );
+        }
+
+        ~test_device()
+        {
+            sensor.stop();
+            sensor.close();
+        }
+
+        void send( int frame_number, double timestamp, std::vector< uint16_t > & pixels )
+        {
+            sensor.on_video_frame( { pixels.data(), []( void * ) {}, W * 2, 2, timestamp,
+                                     RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME, frame_number, depth } );
+        }
+    };
+}
+
+// Current test description:
+//       * Send the frames of three devices with small offsets, one of them drifting, and two devices
+//         lagging behind the first. Check that each set holds the frames of a frame number from all
+//         devices, that the set a frame is missing from is dropped, and the offsets to the first device
+TEST_CASE( "multi-device syncer matches devices by host time", "[multi-device syncer]" )
+{
+    const int DEVICES = 3, ROUNDS = 20, LAG = 2, MISSING = 5;
+    const double PERIOD = 1000. / 30, DRIFT = 0.001;
+
+    rs2::multi_device_syncer sync( ROUNDS );
+    REQUIRE( sync.get_option( RS2_OPTION_SYNC_TOLERANCE ) >= 1.f );
+
+    std::vector< std::unique_ptr< test_device > > devices;
+    for( int d = 0; d < DEVICES; ++d )
+        devices.emplace_back( new test_device( d, sync ) );
+
+    // Device 1 is 0.5 ms after device 0, device 2 is 1 ms after it and drifts by 1000 ppm
+    auto timestamp = [&]( int d, int round ) {
+        double t = 1.6e12 + round * PERIOD + 0.5 * d;
+        return d == 2 ? t + DRIFT * round * PERIOD : t;
+    };
+    std::vector< uint16_t > pixels( W * H );
+    for( int round = 0; round < ROUNDS + LAG; ++round )
+    {
+        if( round < ROUNDS )
+            devices[0]->send( round, timestamp( 0, round ), pixels );
+        int late = round - LAG;
+        if( late < 0 )
+            continue;
+        devices[1]->send( late, timestamp( 1, late ), pixels );
+        if( late != MISSING )
+            devices[2]->send( late, timestamp( 2, late ), pixels );
+    }
+
+    int sets = 0;
+    rs2::frameset fs;
+    while( sync.poll_for_frames( &fs ) )
+    {
+        REQUIRE( fs.size() == DEVICES );
+        auto number = fs[0].get_frame_number();
+        CHECK( number != MISSING );
+        for( auto && f : fs )
+            CHECK( f.get_frame_number() == number );
+        ++sets;
+    }
+    CHECK( sets == ROUNDS - 1 );
+
+    auto metrics = sync.get_metrics();
+    REQUIRE( metrics.size() == DEVICES );
+    for( int d = 0; d < DEVICES; ++d )
+    {
+        CHECK( std::string( metrics[d].serial_number ) == std::to_string( 1000 + d ) );
+        CHECK( !! metrics[d].is_reference == ( d == 0 ) );
+        CHECK( metrics[d].on_host_clock );
+        CHECK( metrics[d].clock_drift_ppm == 0 );  // Software devices have no time_diff_keeper
+        CHECK( metrics[d].frames_matched == ROUNDS - 1 );
+        CHECK( metrics[d].frames_dropped == ( d == 2 ? 0 : 1 ) );
+    }
+    CHECK( metrics[0].offset_ms == approx( 0. ) );
+    CHECK( metrics[1].offset_ms == approx( 0.5 ).margin( 0.001 ) );  // The timestamps are precise to 0.25 us
+    CHECK( metrics[1].offset_drift_ppm == approx( 0. ).margin( 5. ) );
+    CHECK( metrics[2].offset_ms > 1. );
+    CHECK( metrics[2].offset_drift_ppm == approx( DRIFT * 1e6 ).epsilon( 0.01 ) );
+}
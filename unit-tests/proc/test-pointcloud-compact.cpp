@@ -0,0 +1,171 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies that a pointcloud with RS2_OPTION_COMPACT_POINTS emits the vertices with depth
+//         of the full pointcloud, along with the indices of their depth pixels, and exports the same PLY.
+
+namespace
+{
+    const int W = 32, H = 24;
+
+    // Depth around 1m, with holes, and a color image of distinct pixels over the same view
+    struct depth_and_color
+    {
+        rs2::software_device dev;
+        rs2::software_sensor depth_sensor, color_sensor;
+        rs2::stream_profile depth_profile, color_profile;
+        rs2::frame_queue depth_queue, color_queue;
+        std::vector< uint16_t > depth_pixels;
+        std::vector< uint8_t > color_pixels;
+
+        depth_and_color()
+            : depth_sensor( dev.add_sensor( "depth" ) )
+            , color_sensor( dev.add_sensor( "color" ) )
+            , depth_queue( 10, true )
+            , color_queue( 10, true )
+            , depth_pixels( W * H )
+            , color_pixels( W * H * 3 )
+        {
+            depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+            rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 30.f, 30.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+            depth_profile = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 201, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+            color_profile = color_sensor.add_video_stream( { RS2_STREAM_COLOR, 0, 202, W, H, 30, 3, RS2_FORMAT_RGB8, intrinsics } );
+            depth_profile.register_extrinsics_to( color_profile, { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.01f, 0, 0 } } );
+
+            for( int y = 0; y < H; ++y )
+                for( int x = 0; x < W; ++x )
+                {
+                    bool hole = ( x * 7 + y * 3 ) % 5 == 0 || ( x >= 10 && x < 16 && y >= 8 && y < 12 );
+                    depth_pixels[y * W + x] = hole ? 0 : uint16_t( 1000 + x + y );
+                }
+            for( size_t i = 0; i < color_pixels.size(); ++i )
+                color_pixels[i] = uint8_t( i * 13 );
+
+            depth_sensor.open( depth_profile );
+            depth_sensor.start( depth_queue );
+            color_sensor.open( color_profile );
+            color_sensor.start( color_queue );
+        }
+
+        ~depth_and_color()
+        {
+            depth_sensor.stop();
+            depth_sensor.close();
+            color_sensor.stop();
+            color_sensor.close();
+        }
+
+        rs2::depth_frame depth()
+        {
+            depth_sensor.on_video_frame( { depth_pixels.data(), []( void * ) {}, W * 2, 2, 0.,
+                                           RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 0, depth_profile } );
+            return depth_queue.wait_for_frame();
+        }
+
+        rs2::video_frame color()
+        {
+            color_sensor.on_video_frame( { color_pixels.data(), []( void * ) {}, W * 3, 3, 0.,
+                                           RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 0, color_profile } );
+            return color_queue.wait_for_frame();
+        }
+    };
+
+    std::string read_file( const std::string & name )
+    {
+        std::ifstream in( name, std::ios::binary );
+        return std::string( std::istreambuf_iterator< char >( in ), std::istreambuf_iterator< char >() );
+    }
+}
+
+// Current test description:
+//       * Compute the pointcloud of a depth frame with holes, in full and compact: the compact one holds the
+//         vertices with depth, in pixel order, each with the index of its pixel, and the same vertex and texture
+//         coordinate as the full one at that index
+TEST_CASE( "compact points keep the vertices with depth", "[pointcloud compact]" )
+{
+    depth_and_color source;
+    auto depth = source.depth();
+    auto color = source.color();
+
+    rs2::pointcloud pc;
+    REQUIRE( pc.supports( RS2_OPTION_COMPACT_POINTS ) );
+    pc.map_to( color );
+    rs2::points full = pc.calculate( depth );
+    pc.set_option( RS2_OPTION_COMPACT_POINTS, 1.f );
+    rs2::points compact = pc.calculate( depth );
+
+    REQUIRE( full.size() == W * H );
+    CHECK( full.get_indices() == nullptr );
+
+    std::vector< int > with_depth;
+    for( int i = 0; i < W * H; ++i )
+        if( source.depth_pixels[i] )
+            with_depth.push_back( i );
+    REQUIRE( compact.size() == with_depth.size() );
+    auto indices = compact.get_indices();
+    REQUIRE( indices != nullptr );
+    CHECK( std::vector< int >( indices, indices + compact.size() ) == with_depth );
+
+    auto full_vertices = full.get_vertices();
+    auto full_texcoords = full.get_texture_coordinates();
+    auto vertices = compact.get_vertices();
+    auto texcoords = compact.get_texture_coordinates();
+    for( size_t i = 0; i < compact.size(); ++i )
+    {
+        CAPTURE( i, indices[i] );
+        CHECK( vertices[i].z == Approx( source.depth_pixels[indices[i]] * 0.001f ) );
+        CHECK( vertices[i].x == full_vertices[indices[i]].x );
+        CHECK( vertices[i].y == full_vertices[indices[i]].y );
+        CHECK( vertices[i].z == full_vertices[indices[i]].z );
+        CHECK( texcoords[i].u == full_texcoords[indices[i]].u );
+        CHECK( texcoords[i].v == full_texcoords[indices[i]].v );
+    }
+
+    // Turning the option off goes back to a vertex per pixel
+    pc.set_option( RS2_OPTION_COMPACT_POINTS, 0.f );
+    rs2::points again = pc.calculate( depth );
+    CHECK( again.size() == W * H );
+    CHECK( again.get_indices() == nullptr );
+}
+
+// Current test description:
+//       * Export the full and compact pointclouds of the same depth frame to PLY: the compact vertices are put back
+//         on the pixel grid, so both files have the same vertices, colors and faces
+TEST_CASE( "compact points export the same PLY", "[pointcloud compact]" )
+{
+    depth_and_color source;
+    auto depth = source.depth();
+    auto color = source.color();
+
+    rs2::pointcloud pc;
+    pc.map_to( color );
+    rs2::points full = pc.calculate( depth );
+    pc.set_option( RS2_OPTION_COMPACT_POINTS, 1.f );
+    rs2::points compact = pc.calculate( depth );
+
+    full.export_to_ply( "test-pointcloud-full.ply", color );
+    compact.export_to_ply( "test-pointcloud-compact.ply", color );
+    auto full_ply = read_file( "test-pointcloud-full.ply" );
+    auto compact_ply = read_file( "test-pointcloud-compact.ply" );
+    std::remove( "test-pointcloud-full.ply" );
+    std::remove( "test-pointcloud-compact.ply" );
+
+    // The vertices without depth are left out, and faces join the neighbors with depth
+    auto vertices = std::count_if( source.depth_pixels.begin(), source.depth_pixels.end(), []( uint16_t z ) { return z != 0; } );
+    CHECK( compact_ply.find( "element vertex " + std::to_string( vertices ) + "\n" ) != std::string::npos );
+    CHECK( compact_ply.find( "element face 0\n" ) == std::string::npos );
+    CHECK( compact_ply.find( "property uchar red\n" ) != std::string::npos );
+    CHECK( compact_ply == full_ply );
+}
@@ -0,0 +1,72 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/processing-thread-pool.cpp
+
+#include "../test.h"
+#include "../../src/proc/processing-thread-pool.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the processing_thread_pool used by processing blocks
+//         to split a frame over several threads.
+
+// Current test description:
+//       * Every index is processed exactly once, in ranges that are multiples of the grain
+TEST_CASE( "parallel_for covers the range", "[processing thread pool]" )
+{
+    auto pool = processing_thread_pool::get();
+
+    for( size_t count : { 1, 7, 480, 1000, 4099 } )
+    {
+        for( int threads : { 1, 2, 4, 16 } )
+        {
+            std::vector< std::atomic< int > > hits( count );
+            for( auto & h : hits )
+                h = 0;
+            std::atomic< bool > aligned( true );
+
+            pool->parallel_for( count, 8, threads, [&]( size_t first, size_t last ) {
+                if( first % 8 || ( last % 8 && last != count ) )
+                    aligned = false;
+                for( auto i = first; i < last; ++i )
+                    ++hits[i];
+            } );
+
+            CHECK( aligned );
+            CHECK( std::all_of( hits.begin(), hits.end(), []( const std::atomic< int > & h ) { return h == 1; } ) );
+        }
+    }
+}
+
+// Current test description:
+//       * Several callers share the pool concurrently, and an exception reaches the caller
+TEST_CASE( "concurrent jobs and errors", "[processing thread pool]" )
+{
+    auto pool = processing_thread_pool::get();
+    CHECK( pool == processing_thread_pool::get() );
+
+    std::vector< std::thread > callers;
+    std::atomic< size_t > total( 0 );
+    for( int c = 0; c < 4; ++c )
+    {
+        callers.emplace_back( [&]() {
+            for( int i = 0; i < 50; ++i )
+                pool->parallel_for( 480, 1, 4, [&]( size_t first, size_t last ) { total += last - first; } );
+        } );
+    }
+    for( auto & t : callers )
+        t.join();
+    CHECK( total == 4 * 50 * 480 );
+
+    CHECK_THROWS_AS( pool->parallel_for( 100, 1, 4,
+                                         []( size_t first, size_t ) {
+                                             if( first == 0 )
+                                                 throw std::runtime_error( "failed" );
+                                         } ),
+                     std::runtime_error );
+}
@@ -0,0 +1,146 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/spatial-filter-simd.cpp
+//#cmake:add-file ../../src/proc/spatial-filter-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/spatial-filter-simd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized recursive passes of the spatial filter
+//         against a scalar implementation of the same recursion.
+
+namespace
+{
+    bool valid( float x )
+    {
+        int bits;
+        std::memcpy( &bits, &x, sizeof( bits ) );
+        return bits > 0;
+    }
+
+    // One line of the recursion, forward then backward, over 'n' elements 'step' apart
+    void reference_line( float * p, size_t n, ptrdiff_t step, float alpha, float delta_z )
+    {
+        for( int pass = 0; pass < 2; ++pass )
+        {
+            float * line = pass ? p + ( n - 1 ) * step : p;
+            ptrdiff_t dir = pass ? -step : step;
+            float prev = line[0];
+            for( size_t k = 1; k < n; ++k )
+            {
+                float x = line[k * dir];
+                float delta = prev - x;
+                if( valid( prev ) && valid( x ) && delta < delta_z && delta > -delta_z )
+                    line[k * dir] = x * alpha + line[( k - 1 ) * dir] * ( 1.0f - alpha );
+                prev = x;
+            }
+        }
+    }
+
+    std::vector< float > random_disparity( size_t width, size_t height, std::mt19937 & gen )
+    {
+        std::uniform_real_distribution< float > dist( 0.f, 10.f );
+        std::vector< float > image( width * height );
+        for( auto & v : image )
+        {
+            switch( gen() % 8 )
+            {
+            case 0: v = 0.f; break;                  // hole
+            case 1: v = -dist( gen ); break;         // invalid
+            case 2: v = 30.f + dist( gen ); break;   // edge
+            default: v = 1.f + dist( gen ); break;
+            }
+        }
+        return image;
+    }
+}
+
+// Current test description:
+//       * Filter frames of various sizes, including widths and heights that are not a multiple
+//         of the vector width, and compare with the scalar recursion
+TEST_CASE( "horizontal and vertical passes match scalar", "[spatial filter simd]" )
+{
+    if( ! spatial_filter_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the spatial filter for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 42 );
+    const size_t sizes[][2] = { { 848, 480 }, { 640, 360 }, { 13, 17 }, { 9, 9 }, { 17, 3 }, { 3, 8 }, { 2, 2 } };
+
+    for( auto & size : sizes )
+    {
+        const size_t width = size[0], height = size[1];
+        for( float alpha : { 0.25f, 0.5f, 0.83f, 1.f } )
+        {
+            auto image = random_disparity( width, height, gen );
+            auto expected = image;
+            const float delta_z = 20.f;
+
+            for( size_t v = 0; v < height; ++v )
+                reference_line( expected.data() + v * width, width, 1, alpha, delta_z );
+            for( size_t u = 0; u < width; ++u )
+                reference_line( expected.data() + u, height, ptrdiff_t( width ), alpha, delta_z );
+
+            recursive_filter_horizontal_simd( image.data(), width, height, width, alpha, delta_z );
+            recursive_filter_vertical_simd( image.data(), width, height, width, alpha, delta_z );
+
+            for( size_t i = 0; i < image.size(); ++i )
+            {
+                CAPTURE( width, height, alpha, i );
+                REQUIRE( image[i] == Approx( expected[i] ).epsilon( 1e-6 ) );
+            }
+        }
+    }
+}
+
+// Current test description:
+//       * Processing the frame in slices (blocks of rows, stripes of columns) of any size, as
+//         done when running on multiple threads, gives the same result as a single call
+TEST_CASE( "slices match whole frame", "[spatial filter simd]" )
+{
+    if( ! spatial_filter_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the spatial filter for this CPU: nothing was compared" );
+        return;
+    }
+
+    std::mt19937 gen( 7 );
+    const size_t width = 101, height = 67;
+    auto whole = random_disparity( width, height, gen );
+    auto sliced = whole;
+
+    recursive_filter_horizontal_simd( whole.data(), width, height, width, 0.5f, 20.f );
+    recursive_filter_vertical_simd( whole.data(), width, height, width, 0.5f, 20.f );
+
+    for( size_t v = 0; v < height; v += 5 )
+        recursive_filter_horizontal_simd( sliced.data() + v * width, width, std::min< size_t >( 5, height - v ), width, 0.5f, 20.f );
+    for( size_t u = 0; u < width; u += 11 )
+        recursive_filter_vertical_simd( sliced.data() + u, std::min< size_t >( 11, width - u ), height, width, 0.5f, 20.f );
+
+    CHECK( whole == sliced );
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "spatial filter AVX2 kernels are built", "[spatial filter simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::spatial_filter_built() );
+}
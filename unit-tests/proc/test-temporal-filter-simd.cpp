@@ -0,0 +1,143 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/proc/temporal-filter-simd.cpp
+//#cmake:add-file ../../src/proc/temporal-filter-avx.cpp
+//#cmake:add-file ../../src/proc/simd-support.cpp
+
+#include "../test.h"
+#include "../../src/proc/simd-support.h"
+#include "../../src/proc/temporal-filter-simd.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+// Test group description:
+//       * This tests group verifies the vectorized pass of the temporal filter against the
+//         scalar implementation, on sequences of frames so that the history comes into play.
+
+namespace
+{
+    // The per-pixel pass of temporal_filter::temp_jw_smooth
+    template< typename T >
+    void reference_smooth( T * frame, T * last_frame, uint8_t * history, size_t count, float alpha, T delta_z,
+                           uint8_t mask, const uint8_t * persistence_map )
+    {
+        for( size_t i = 0; i < count; i++ )
+        {
+            T cur_val = frame[i];
+            T prev_val = last_frame[i];
+
+            if( cur_val )
+            {
+                if( ! prev_val )
+                {
+                    last_frame[i] = cur_val;
+                    history[i] = mask;
+                }
+                else
+                {
+                    T diff = static_cast< T >( fabs( cur_val - prev_val ) );
+                    if( diff < delta_z )
+                    {
+                        history[i] |= mask;
+                        float filtered = alpha * cur_val + ( 1.f - alpha ) * prev_val;
+                        T result = static_cast< T >( filtered );
+                        frame[i] = result;
+                        last_frame[i] = result;
+                    }
+                    else
+                    {
+                        last_frame[i] = cur_val;
+                        history[i] = mask;
+                    }
+                }
+            }
+            else
+            {
+                if( prev_val && ( persistence_map[history[i]] & mask ) )
+                    frame[i] = prev_val;
+                history[i] &= ~mask;
+            }
+        }
+    }
+
+    template< typename T >
+    T random_pixel( std::mt19937 & gen )
+    {
+        // Holes, and values close enough to their previous ones to be filtered
+        return gen() % 4 ? static_cast< T >( 1000 + gen() % 40 ) : static_cast< T >( 0 );
+    }
+
+    template< typename T >
+    void compare_sequences( size_t count )
+    {
+        std::mt19937 gen( 11 );
+        std::vector< uint8_t > persistence_map( 256 );
+        for( auto & c : persistence_map )
+            c = uint8_t( gen() );
+
+        std::vector< T > last( count ), expected_last( count );
+        std::vector< uint8_t > history( count ), expected_history( count );
+
+        for( int index = 0; index < 24; ++index )
+        {
+            uint8_t mask = uint8_t( 1 << ( index % 8 ) );
+            const float alpha = 0.4f;
+            const T delta_z = static_cast< T >( 20 );
+
+            std::vector< T > frame( count );
+            for( auto & v : frame )
+                v = random_pixel< T >( gen );
+            auto expected = frame;
+
+            reference_smooth( expected.data(), expected_last.data(), expected_history.data(), count, alpha, delta_z,
+                              mask, persistence_map.data() );
+
+            temporal_filter_params p( alpha, 1.f - alpha, delta_z, mask, persistence_map.data() );
+            auto done = temporal_filter_smooth_simd( frame.data(), last.data(), history.data(), count, p );
+            CHECK( done == count - count % TEMPORAL_FILTER_BLOCK );
+            reference_smooth( frame.data() + done, last.data() + done, history.data() + done, count - done, alpha,
+                              delta_z, mask, persistence_map.data() );
+
+            CAPTURE( index, count );
+            REQUIRE( frame == expected );
+            REQUIRE( last == expected_last );
+            REQUIRE( history == expected_history );
+        }
+    }
+}
+
+// Current test description:
+//       * Filter sequences of depth and disparity frames, including sizes that are not a multiple
+//         of the block, and compare frame, last frame and history with the scalar filter
+TEST_CASE( "temporal pass matches scalar", "[temporal filter simd]" )
+{
+    if( ! temporal_filter_simd_supported() )
+    {
+        WARN( "No SIMD implementation of the temporal filter for this CPU: nothing was compared" );
+        return;
+    }
+
+    for( size_t count : { 16, 1000, 848 * 3 + 5 } )
+    {
+        compare_sequences< uint16_t >( count );
+        compare_sequences< float >( count );
+    }
+}
+
+// Current test description:
+//       * On a CPU with AVX2, the AVX2 kernels are built into the test with AVX2 code generation, and used by the
+//         cases above
+TEST_CASE( "temporal filter AVX2 kernels are built", "[temporal filter simd]" )
+{
+    if( ! avx2_supported() )
+    {
+        WARN( "No AVX2 on this CPU: only the other SIMD kernels were compared" );
+        return;
+    }
+    CHECK( avx2::temporal_filter_built() );
+}
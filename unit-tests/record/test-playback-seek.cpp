@@ -0,0 +1,169 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies that seeking and resuming a playback, which read the file ahead of the frames
+//         they publish, neither skip nor repeat frames.
+
+namespace
+{
+    const int W = 64, H = 48;
+    const int FRAMES = 60;
+    const char * FILE_NAME = "test-playback-seek.bag";
+
+    // Record FRAMES depth frames 10ms apart; every pixel of a frame holds its number
+    void record()
+    {
+        rs2::software_device dev;
+        auto depth_sensor = dev.add_sensor( "depth" );
+        depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+        rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        auto depth = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 201, W, H, 100, 2, RS2_FORMAT_Z16, intrinsics } );
+
+        rs2::recorder recorder( FILE_NAME, dev );
+        auto sensor = recorder.query_sensors()[0];
+        sensor.open( depth );
+        sensor.start( []( rs2::frame ) {} );
+        for( int i = 0; i < FRAMES; ++i )
+        {
+            auto pixels = new uint16_t[W * H];
+            std::fill( pixels, pixels + W * H, uint16_t( i ) );
+            depth_sensor.on_video_frame( { pixels, []( void * p ) { delete[] static_cast< uint16_t * >( p ); }, W * 2,
+                                           2, double( i ) * 10, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, depth } );
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+        }
+        sensor.stop();
+        sensor.close();
+    }
+
+    struct played_frames
+    {
+        std::mutex mutex;
+        std::vector< unsigned long long > numbers;
+
+        void add( rs2::frame f )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            CHECK( static_cast< const uint16_t * >( f.get_data() )[0] == f.get_frame_number() );
+            numbers.push_back( f.get_frame_number() );
+        }
+
+        std::vector< unsigned long long > take()
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            auto result = numbers;
+            numbers.clear();
+            return result;
+        }
+
+        size_t count()
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            return numbers.size();
+        }
+    };
+
+    void wait_for_end( rs2::playback & playback )
+    {
+        for( int i = 0; i < 100 && playback.current_status() != RS2_PLAYBACK_STATUS_STOPPED; ++i )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+        REQUIRE( playback.current_status() == RS2_PLAYBACK_STATUS_STOPPED );
+    }
+
+    // The frames from first to the last one recorded
+    std::vector< unsigned long long > frames_from( unsigned long long first )
+    {
+        std::vector< unsigned long long > result;
+        for( auto i = first; i < FRAMES; ++i )
+            result.push_back( i );
+        return result;
+    }
+}
+
+// Current test description:
+//       * Seek a paused playback, twice: each seek publishes the last frame recorded before the seek time, and
+//         resuming plays every frame after the last one published, once and in order
+TEST_CASE( "playback seek while paused", "[playback seek]" )
+{
+    record();
+    {
+        rs2::context ctx;
+        auto playback = ctx.load_device( FILE_NAME ).as< rs2::playback >();
+        playback.set_real_time( false );
+        auto duration = playback.get_duration();
+
+        played_frames played;
+        auto sensor = playback.query_sensors()[0];
+        sensor.open( sensor.get_stream_profiles() );
+        playback.pause();
+        sensor.start( [&]( rs2::frame f ) { played.add( f ); } );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        played.take();
+
+        unsigned long long published = FRAMES;
+        for( auto seek_time : { duration / 2, duration / 4 } )
+        {
+            CAPTURE( seek_time.count() );
+            playback.seek( seek_time );
+            for( int i = 0; i < 20 && played.count() == 0; ++i )
+                std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            auto numbers = played.take();
+            REQUIRE( numbers.size() == 1 );
+            CHECK( numbers[0] < published );
+            published = numbers[0];
+        }
+
+        playback.resume();
+        wait_for_end( playback );
+        CHECK( played.take() == frames_from( published + 1 ) );
+        sensor.close();
+    }
+    std::remove( FILE_NAME );
+}
+
+// Current test description:
+//       * Pause a playback in the middle of the file, then resume it: it continues from the frame after the last
+//         one published, and the file is played in full, without a frame missing or repeated
+TEST_CASE( "playback resume after pause", "[playback seek]" )
+{
+    record();
+    {
+        rs2::context ctx;
+        auto playback = ctx.load_device( FILE_NAME ).as< rs2::playback >();
+        playback.set_real_time( true );
+
+        played_frames played;
+        auto sensor = playback.query_sensors()[0];
+        sensor.open( sensor.get_stream_profiles() );
+        sensor.start( [&]( rs2::frame f ) { played.add( f ); } );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        playback.pause();
+        auto before = played.count();
+        CHECK( before > 0 );
+        CHECK( before < FRAMES );
+
+        // Nothing is published while paused
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        CHECK( played.count() == before );
+
+        playback.resume();
+        wait_for_end( playback );
+        CHECK( played.take() == frames_from( 0 ) );
+
+        // Played again from the start once stopped
+        sensor.start( [&]( rs2::frame f ) { played.add( f ); } );
+        wait_for_end( playback );
+        CHECK( played.take() == frames_from( 0 ) );
+        sensor.close();
+    }
+    std::remove( FILE_NAME );
+}
@@ -0,0 +1,147 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Test group description:
+//       * This tests group verifies that the recorder queue writes frames in the order they arrived, and that its
+//         statistics account for every frame, whether written or dropped.
+
+namespace
+{
+    const int W = 64, H = 48;
+    const int FRAMES = 30;
+    const char * FILE_NAME = "test-record-queue.bag";
+
+    struct depth_device
+    {
+        rs2::software_device dev;
+        rs2::software_sensor sensor;
+        rs2::stream_profile depth;
+
+        depth_device()
+            : sensor( dev.add_sensor( "depth" ) )
+        {
+            sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+            rs2_intrinsics intrinsics{ W, H, W / 2.f, H / 2.f, 10.f, 10.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+            depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 201, W, H, 30, 2, RS2_FORMAT_Z16, intrinsics } );
+        }
+
+        // Every pixel of a frame holds its number
+        void push( int frame_number )
+        {
+            auto pixels = new uint16_t[W * H];
+            std::fill( pixels, pixels + W * H, uint16_t( frame_number ) );
+            sensor.on_video_frame( { pixels, []( void * p ) { delete[] static_cast< uint16_t * >( p ); }, W * 2, 2,
+                                     double( frame_number ) * 33, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, frame_number,
+                                     depth } );
+        }
+    };
+
+    // Record FRAMES frames of a software device through a recorder with the given queue settings
+    rs2_record_statistics record( unsigned long long max_queued_bytes, rs2_record_queue_policy policy,
+                                  int serialization_threads )
+    {
+        depth_device d;
+        rs2::recorder recorder( FILE_NAME, d.dev, false, max_queued_bytes, policy, serialization_threads );
+        auto sensor = recorder.query_sensors()[0];
+        sensor.open( d.depth );
+        sensor.start( []( rs2::frame ) {} );
+        for( int i = 0; i < FRAMES; ++i )
+            d.push( i );
+
+        // Wait for the queue to drain
+        rs2_record_statistics statistics = recorder.get_statistics();
+        for( int i = 0; i < 100 && statistics.written_frames + statistics.dropped_frames < FRAMES; ++i )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            statistics = recorder.get_statistics();
+        }
+
+        sensor.stop();
+        sensor.close();
+        return statistics;
+    }
+
+    struct played_frame
+    {
+        unsigned long long number;
+        uint16_t pixel;
+    };
+
+    std::vector< played_frame > play()
+    {
+        rs2::context ctx;
+        auto playback = ctx.load_device( FILE_NAME ).as< rs2::playback >();
+        playback.set_real_time( false );
+
+        std::mutex mutex;
+        std::vector< played_frame > played;
+        auto sensor = playback.query_sensors()[0];
+        sensor.open( sensor.get_stream_profiles() );
+        sensor.start( [&]( rs2::frame f ) {
+            std::lock_guard< std::mutex > lock( mutex );
+            played.push_back( { f.get_frame_number(), static_cast< const uint16_t * >( f.get_data() )[0] } );
+        } );
+        for( int i = 0; i < 100 && playback.current_status() != RS2_PLAYBACK_STATUS_STOPPED; ++i )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+        CHECK( playback.current_status() == RS2_PLAYBACK_STATUS_STOPPED );
+        sensor.stop();
+        sensor.close();
+
+        std::lock_guard< std::mutex > lock( mutex );
+        return played;
+    }
+}
+
+// Current test description:
+//       * Record through a blocking queue serialized on several threads: every frame is written, none dropped,
+//         and playback returns them all in the order they were recorded
+TEST_CASE( "record queue keeps frame order", "[record queue]" )
+{
+    auto statistics = record( 0, RS2_RECORD_QUEUE_POLICY_BLOCK, 4 );
+    CHECK( statistics.written_frames == FRAMES );
+    CHECK( statistics.dropped_frames == 0 );
+    CHECK( statistics.queued_bytes == 0 );
+    CHECK( statistics.average_write_latency >= 0.f );
+    CHECK( statistics.max_write_latency >= statistics.average_write_latency );
+
+    auto played = play();
+    REQUIRE( played.size() == FRAMES );
+    for( int i = 0; i < FRAMES; ++i )
+    {
+        CAPTURE( i );
+        CHECK( played[i].number == i );
+        CHECK( played[i].pixel == i );
+    }
+    std::remove( FILE_NAME );
+}
+
+// Current test description:
+//       * Record through a queue with room for a single frame that drops what does not fit: every frame is either
+//         written or counted as dropped, and playback returns exactly the written frames, in order
+TEST_CASE( "record queue counts dropped frames", "[record queue]" )
+{
+    auto statistics = record( W * H * 2, RS2_RECORD_QUEUE_POLICY_DROP_NEWEST, 0 );
+    CHECK( statistics.written_frames + statistics.dropped_frames == FRAMES );
+    CHECK( statistics.written_frames > 0 );
+    CHECK( statistics.queued_bytes == 0 );
+
+    auto played = play();
+    REQUIRE( played.size() == statistics.written_frames );
+    for( size_t i = 0; i < played.size(); ++i )
+    {
+        CAPTURE( i );
+        CHECK( played[i].pixel == played[i].number );
+        if( i > 0 )
+            CHECK( played[i].number > played[i - 1].number );
+    }
+    std::remove( FILE_NAME );
+}
@@ -92,6 +92,9 @@ def generate_cmake( builddir, testdir, testname, filelist ):
     makefile = builddir + '/' + testdir + '/CMakeLists.txt'
     debug( '   creating:', makefile )
     handle = open( makefile, 'w' );
+    # The *-avx.cpp sources get the same AVX2 code generation as in the library (see src/proc/CMakeLists.txt),
+    # or their kernels would be left out of the test
+    avx_files = '\n        '.join( f for f in filelist if f.endswith( '-avx.cpp' ))
     filelist = '\n    '.join( filelist )
     handle.write( '''
 # This file is automatically generated!!
@@ -109,6 +112,18 @@ target_link_libraries( ''' + testname + ''' ${DEPENDENCIES})
 
 set_target_properties( ''' + testname + ''' PROPERTIES FOLDER "Unit-Tests/''' + os.path.dirname( testdir ) + '''" )
 
+''' )
+    if avx_files:
+        handle.write( '''if( LRS_TRY_USE_AVX )
+    if( MSVC )
+        set( AVX_FLAGS /arch:AVX2 )
+    else()
+        set( AVX_FLAGS -mavx2 )
+    endif()
+    set_source_files_properties(
+        ''' + avx_files + '''
+        PROPERTIES COMPILE_FLAGS ${AVX_FLAGS} )
+endif()
 ''' )
     handle.close()
 
@@ -10,6 +10,8 @@
 #include <chrono>
 #include <ctime>
 #include <algorithm>
+#include <numeric>
+#include <random>
 
 #include "unit-tests-common.h"
 #include "../include/librealsense2/rs_advanced_mode.hpp"
@@ -4402,6 +4404,137 @@ TEST_CASE("Syncer clean_inactive_streams by frame number with software-device de
     }
 }
 
+TEST_CASE("Syncer matches streams of many software devices by timestamp", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const int W = 64;
+        const int H = 48;
+        const int BPP = 2;
+        const int DEVICES = 4;
+        const int ROUNDS = 20;
+        const double GAP = 1000. / 30;
+
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+        std::vector<std::shared_ptr<software_device>> devs;
+        std::vector<rs2::software_sensor> sensors;
+        std::vector<rs2::stream_profile> streams;
+        for (auto d = 0; d < DEVICES; d++)
+        {
+            devs.push_back(std::make_shared<software_device>());
+            sensors.push_back(devs.back()->add_sensor("software_sensor"));
+            auto&& s = sensors.back();
+            s.add_video_stream({ RS2_STREAM_DEPTH, 0, 3 * d, W, H, 30, BPP, RS2_FORMAT_Z16, intrinsics });
+            s.add_video_stream({ RS2_STREAM_INFRARED, 1, 3 * d + 1, W, H, 30, BPP, RS2_FORMAT_Y8, intrinsics });
+            s.add_video_stream({ RS2_STREAM_COLOR, 0, 3 * d + 2, W, H, 30, BPP, RS2_FORMAT_RGB8, intrinsics });
+            for (auto&& p : s.get_stream_profiles())
+                streams.push_back(p);
+        }
+
+        syncer sync(ROUNDS * DEVICES * 3);
+        for (auto&& s : sensors)
+        {
+            s.open(s.get_stream_profiles());
+            s.start(sync);
+        }
+
+        // The frames of a round arrive in a different order each time
+        std::vector<uint8_t> pixels(W * H * BPP, 0);
+        std::vector<size_t> order(streams.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::mt19937 gen(5);
+        for (auto round = 0; round < ROUNDS; round++)
+        {
+            std::shuffle(order.begin(), order.end(), gen);
+            for (auto i : order)
+                sensors[i / 3].on_video_frame({ pixels.data(), [](void*) {}, 0, 0, round * GAP, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, round, streams[i] });
+        }
+
+        size_t frames = 0;
+        int complete = 0;
+        frameset fs;
+        while (sync.poll_for_frames(&fs))
+        {
+            frames += fs.size();
+            if (fs.size() == streams.size())
+                ++complete;
+            for (auto&& f : fs)
+            {
+                CAPTURE(f.get_profile().unique_id());
+                REQUIRE(f.get_frame_number() == fs.get_frame_number());
+            }
+        }
+        REQUIRE(frames == streams.size() * ROUNDS);
+        // Once every stream has been seen, each round is matched as a whole
+        REQUIRE(complete >= ROUNDS - 2);
+
+        for (auto&& s : sensors)
+        {
+            s.stop();
+            s.close();
+        }
+    }
+}
+
+TEST_CASE("Syncer drops the oldest frames of a stream waiting for another one", "[live][software-device]") {
+    rs2::context ctx;
+    if (make_context(SECTION_FROM_TEST_NAME, &ctx))
+    {
+        const int W = 64;
+        const int H = 48;
+        const int BPP = 2;
+        const int WAITING = 50;
+        const int MAX_QUEUED = 10;  // QUEUE_MAX_SIZE
+        const double GAP = 1000. / 30;
+
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE ,{ 0,0,0,0,0 } };
+        std::vector<std::shared_ptr<software_device>> devs;
+        std::vector<rs2::software_sensor> sensors;
+        std::vector<rs2::stream_profile> streams;
+        for (auto d = 0; d < 2; d++)
+        {
+            devs.push_back(std::make_shared<software_device>());
+            sensors.push_back(devs.back()->add_sensor("software_sensor"));
+            streams.push_back(sensors.back().add_video_stream({ RS2_STREAM_DEPTH, 0, d, W, H, 30, BPP, RS2_FORMAT_Z16, intrinsics }));
+        }
+
+        syncer sync(WAITING * 2);
+        for (auto&& s : sensors)
+        {
+            s.open(s.get_stream_profiles());
+            s.start(sync);
+        }
+
+        // Both streams are seen once, then the first one keeps sending frames the second one is expected to match
+        std::vector<uint8_t> pixels(W * H * BPP, 0);
+        for (auto i = 0; i < 2; i++)
+            sensors[i].on_video_frame({ pixels.data(), [](void*) {}, 0, 0, 0., RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 0, streams[i] });
+        for (auto n = 1; n <= WAITING; n++)
+            sensors[0].on_video_frame({ pixels.data(), [](void*) {}, 0, 0, GAP, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, streams[0] });
+        sensors[1].on_video_frame({ pixels.data(), [](void*) {}, 0, 0, GAP, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, 1, streams[1] });
+
+        // Only the newest frames of the first stream were kept while waiting, in order
+        std::vector<unsigned long long> first_stream;
+        frameset fs;
+        while (sync.poll_for_frames(&fs))
+            for (auto&& f : fs)
+                if (f.get_profile().unique_id() == streams[0].unique_id())
+                    first_stream.push_back(f.get_frame_number());
+        REQUIRE(first_stream.size() >= 2);
+        REQUIRE(first_stream.size() <= 1 + MAX_QUEUED);
+        REQUIRE(first_stream.front() == 0);
+        REQUIRE(first_stream.back() == WAITING);
+        for (size_t i = 1; i < first_stream.size(); i++)
+            REQUIRE(first_stream[i] > first_stream[i - 1]);
+
+        for (auto&& s : sensors)
+        {
+            s.stop();
+            s.close();
+        }
+    }
+}
+
 void dev_changed(rs2_device_list* removed_devs, rs2_device_list* added_devs, void* ptr) {}
 TEST_CASE("C API Compilation", "[live]") {
     rs2_error* e;
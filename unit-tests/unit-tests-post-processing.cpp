@@ -13,6 +13,7 @@
 #include <chrono>
 #include <ctime>
 #include <algorithm>
+#include <random>
 
 
 # define SECTION_FROM_TEST_NAME space_to_underscore(Catch::getCurrentContext().getResultCapture()->getCurrentTestName()).c_str()
@@ -344,6 +345,79 @@ TEST_CASE("Post-Processing Filters metadata validation", "[software-device][post
     }
 }
 
+TEST_CASE("Depth filter chain matches the chained filters", "[software-device][post-processing-filters]")
+{
+    const int width = 640, height = 480, depth_bpp = 2;
+    rs2_intrinsics depth_intrinsics = { width, height, width / 2.f, height / 2.f, 380.f, 380.f,
+        RS2_DISTORTION_BROWN_CONRADY, { 0,0,0,0,0 } };
+
+    rs2::software_device dev;
+    auto depth_sensor = dev.add_sensor("Depth");
+    auto depth_stream_profile = depth_sensor.add_video_stream({ RS2_STREAM_DEPTH, 0, 0, width, height, 30, depth_bpp, RS2_FORMAT_Z16, depth_intrinsics });
+    depth_sensor.add_read_only_option(RS2_OPTION_DEPTH_UNITS, 0.001f);
+    depth_sensor.add_read_only_option(RS2_OPTION_STEREO_BASELINE, 50.f);
+
+    rs2::frame_queue queue(10);
+    depth_sensor.open(depth_stream_profile);
+    depth_sensor.start(queue);
+
+    // The options are set on the fused block as on a composite block: options shared by several
+    // filters (magnitude, alpha) apply to all of them
+    rs2::decimation_filter dec_filter;
+    rs2::disparity_transform depth_to_disparity(true);
+    rs2::spatial_filter spat_filter;
+    rs2::temporal_filter temp_filter;
+    rs2::disparity_transform disparity_to_depth(false);
+    rs2::depth_filter_chain fused;
+
+    dec_filter.set_option(RS2_OPTION_FILTER_MAGNITUDE, 2.f);
+    spat_filter.set_option(RS2_OPTION_FILTER_MAGNITUDE, 2.f);
+    spat_filter.set_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, 0.4f);
+    temp_filter.set_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, 0.4f);
+    fused.set_option(RS2_OPTION_FILTER_MAGNITUDE, 2.f);
+    fused.set_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, 0.4f);
+    REQUIRE(fused.get_option(RS2_OPTION_FILTER_SMOOTH_ALPHA) == 0.4f);
+
+    // A slanted plane with noise and holes, so that every filter has something to do
+    std::mt19937 gen(3);
+    std::normal_distribution<float> noise(0.f, 4.f);
+    std::vector<uint16_t> pixels(width * height);
+
+    for (int i = 0; i < 6; i++)
+    {
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                pixels[y * width + x] = (gen() % 16) ? uint16_t(800 + x + y / 2 + noise(gen)) : 0;
+
+        depth_sensor.on_video_frame({ pixels.data(), [](void*) {}, width * depth_bpp, depth_bpp,
+            (rs2_time_t)i, RS2_TIMESTAMP_DOMAIN_SYSTEM_TIME, i, depth_stream_profile });
+
+        rs2::frame depth;
+        REQUIRE(queue.try_wait_for_frame(&depth, 5000));
+
+        rs2::video_frame chained = depth.apply_filter(dec_filter).apply_filter(depth_to_disparity)
+            .apply_filter(spat_filter).apply_filter(temp_filter).apply_filter(disparity_to_depth);
+        rs2::video_frame result = depth.apply_filter(fused);
+
+        REQUIRE(chained.get_profile().format() == RS2_FORMAT_Z16);
+        REQUIRE(result.get_profile().format() == RS2_FORMAT_Z16);
+        REQUIRE(result.get_width() == chained.get_width());
+        REQUIRE(result.get_height() == chained.get_height());
+        REQUIRE(result.get_frame_number() == depth.get_frame_number());
+        auto intrinsics = result.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+        REQUIRE(intrinsics.fx == chained.get_profile().as<rs2::video_stream_profile>().get_intrinsics().fx);
+
+        auto expected = static_cast<const uint16_t*>(chained.get_data());
+        auto actual = static_cast<const uint16_t*>(result.get_data());
+        size_t mismatches = 0;
+        for (int p = 0; p < result.get_width() * result.get_height(); p++)
+            if (std::abs(int(expected[p]) - int(actual[p])) > 1)
+                ++mismatches;
+        CAPTURE(i);
+        REQUIRE(mismatches == 0);
+    }
+}
+
 bool is_subset(rs2::frameset full, rs2::frameset sub)
 {
     if (!sub.is<rs2::frameset>())
@@ -86,7 +86,15 @@ public enum Option {
     ENABLE_MAX_USABLE_RANGE(81),
     ALTERNATE_IR(82),
     NOISE_ESTIMATION(83),
-    ENABLE_IR_REFLECTIVITY(84);
+    ENABLE_IR_REFLECTIVITY(84),
+    FRAME_POOL_WATERMARK(85),
+    FRAME_POOL_HITS(86),
+    FRAME_POOL_MISSES(87),
+    ZERO_COPY_CAPTURE(88),
+    PROCESSING_THREADS(89),
+    COMPACT_POINTS(90),
+    SYNC_TOLERANCE(91),
+    SYNC_QUEUE_SIZE(92);
     private final int mValue;
 
     private Option(int value) { mValue = value; }
@@ -267,7 +267,31 @@ namespace Intel.RealSense
         NoiseEstimation = 83,
 
         /// <summary>Enables data collection for calculating IR pixel reflectivity</summary>
-        EnableIrReflectivity = 84
+        EnableIrReflectivity = 84,
+
+        /// <summary>Max number of released frame buffers kept for reuse per frame size, 0 disables recycling</summary>
+        FramePoolWatermark = 85,
+
+        /// <summary>Number of frame allocations served from recycled buffers</summary>
+        FramePoolHits = 86,
+
+        /// <summary>Number of frame allocations that required new memory</summary>
+        FramePoolMisses = 87,
+
+        /// <summary>Publish raw frames directly from the capture buffers instead of copying them</summary>
+        ZeroCopyCapture = 88,
+
+        /// <summary>Number of threads a processing block may use to process a frame</summary>
+        ProcessingThreads = 89,
+
+        /// <summary>Emit only the vertices with depth, with the index of their depth pixel</summary>
+        CompactPoints = 90,
+
+        /// <summary>Max difference in milliseconds between the timestamps of the frames matched into a set by the multi-device syncer</summary>
+        SyncTolerance = 91,
+
+        /// <summary>Max number of frames the multi-device syncer buffers per stream</summary>
+        SyncQueueSize = 92
 
     }
 }
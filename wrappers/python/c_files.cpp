@@ -31,6 +31,7 @@ void init_c_files(py::module &m) {
     BIND_ENUM(m, rs2_format, RS2_FORMAT_COUNT, "A stream's format identifies how binary data is encoded within a frame.")
     BIND_ENUM(m, rs2_timestamp_domain, RS2_TIMESTAMP_DOMAIN_COUNT, "Specifies the clock in relation to which the frame timestamp was measured.")
     BIND_ENUM(m, rs2_frame_metadata_value, RS2_FRAME_METADATA_COUNT, "Per-Frame-Metadata is the set of read-only properties that might be exposed for each individual frame.")
+    BIND_ENUM(m, rs2_frame_trace_stage, RS2_FRAME_TRACE_STAGE_COUNT, "Stages of the pipeline at which a frame is stamped with the system time, for latency analysis.")
     
     BIND_ENUM(m, rs2_option, RS2_OPTION_COUNT, "Defines general configuration controls. These can generally be mapped to camera UVC controls, and can be set / queried at any time unless stated otherwise.")
     // Force binding of deprecated (renamed) options that we still want to expose for backwards compatibility
@@ -58,6 +58,8 @@ void init_frame(py::module &m) {
              "meaning that the profile will be selected when the user requests stream configuration using wildcards.")
         .def("__nonzero__", &rs2::stream_profile::operator bool, "Checks if the profile is valid")
         .def("get_extrinsics_to", &rs2::stream_profile::get_extrinsics_to, "Get the extrinsic transformation between two profiles (representing physical sensors)", "to"_a)
+        .def("get_latency_histogram", &rs2::stream_profile::get_latency_histogram, "Retrieve the latency histogram of the frames of this stream for a stage of the pipeline", "stage"_a)
+        .def("reset_latency_histogram", &rs2::stream_profile::reset_latency_histogram, "Clear the latency histograms of this stream")
         .def("register_extrinsics_to", &rs2::stream_profile::register_extrinsics_to, "Assign extrinsic transformation parameters "
              "to a specific profile (sensor). The extrinsic information is generally available as part of the camera calibration, "
              "and librealsense is responsible for retrieving and assigning these parameters where appropriate. This specific function "
@@ -116,6 +118,7 @@ void init_frame(py::module &m) {
         .def_property_readonly("frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "The timestamp domain. Identical to calling get_frame_timestamp_domain.")
         .def("get_frame_metadata", &rs2::frame::get_frame_metadata, "Retrieve the current value of a single frame_metadata.", "frame_metadata"_a)
         .def("supports_frame_metadata", &rs2::frame::supports_frame_metadata, "Determine if the device allows a specific metadata to be queried.", "frame_metadata"_a)
+        .def("get_frame_trace", &rs2::frame::get_frame_trace, "Retrieve the system time at which the frame went through a stage of the pipeline, or 0 if it did not.", "stage"_a)
         .def("get_frame_number", &rs2::frame::get_frame_number, "Retrieve the frame number.")
         .def_property_readonly("frame_number", &rs2::frame::get_frame_number, "The frame number. Identical to calling get_frame_number.")
         .def("get_data_size", &rs2::frame::get_data_size, "Retrieve data size from frame handle.")
@@ -125,6 +125,8 @@ void init_internal(py::module &m) {
         .def("add_pose_stream", &rs2::software_sensor::add_pose_stream, "Add pose stream to software sensor",
             "pose_stream"_a, "is_default"_a = false)
         .def("on_video_frame", &rs2::software_sensor::on_video_frame, "Inject video frame into the sensor", "frame"_a)
+        .def("on_writable_video_frame", &rs2::software_sensor::on_writable_video_frame, "Inject video frame into the sensor, "
+             "letting processing blocks write over its pixels", "frame"_a)
         .def("on_motion_frame", &rs2::software_sensor::on_motion_frame, "Inject motion frame into the sensor", "frame"_a)
         .def("on_pose_frame", &rs2::software_sensor::on_pose_frame, "Inject pose frame into the sensor", "frame"_a)
         .def("set_metadata", &rs2::software_sensor::set_metadata, "Set frame metadata for the upcoming frames", "value"_a, "type"_a)
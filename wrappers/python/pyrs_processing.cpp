@@ -114,6 +114,28 @@ void init_processing(py::module &m) {
         }, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>()); // No docstring in C++
         /*.def("__call__", &rs2::syncer::operator(), "frame"_a)*/
 
+    py::class_<rs2_sync_device_metrics> sync_device_metrics(m, "sync_device_metrics", "Synchronization metrics of a device, as seen by the multi-device syncer");
+    sync_device_metrics.def(py::init<>())
+        .def_property_readonly("serial_number", [](const rs2_sync_device_metrics& self) { return std::string(self.serial_number); })
+        .def_readonly("is_reference", &rs2_sync_device_metrics::is_reference)
+        .def_readonly("on_host_clock", &rs2_sync_device_metrics::on_host_clock)
+        .def_readonly("clock_drift_ppm", &rs2_sync_device_metrics::clock_drift_ppm)
+        .def_readonly("offset_ms", &rs2_sync_device_metrics::offset_ms)
+        .def_readonly("offset_drift_ppm", &rs2_sync_device_metrics::offset_drift_ppm)
+        .def_readonly("frames_matched", &rs2_sync_device_metrics::frames_matched)
+        .def_readonly("frames_dropped", &rs2_sync_device_metrics::frames_dropped);
+
+    py::class_<rs2::multi_device_syncer, rs2::processing_block> multi_device_syncer(m, "multi_device_syncer", "Sync instance matching the frames of several devices by their timestamps on the host clock");
+    multi_device_syncer.def(py::init<int>(), "queue_size"_a = 1)
+        .def("wait_for_frames", &rs2::multi_device_syncer::wait_for_frames, "Wait until a coherent set "
+             "of frames becomes available", "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>())
+        .def("poll_for_frames", [](const rs2::multi_device_syncer &self) {
+            rs2::frameset frames;
+            self.poll_for_frames(&frames);
+            return frames;
+        }, "Check if a coherent set of frames is available")
+        .def("get_metrics", &rs2::multi_device_syncer::get_metrics, "Retrieve the synchronization metrics of the devices frames were received from");
+
     py::class_<rs2::align, rs2::filter> align(m, "align", "Performs alignment between depth image and another image.");
     align.def(py::init<rs2_stream>(), "To perform alignment of a depth image to the other, set the align_to parameter with the other stream type.\n"
               "To perform alignment of a non depth image to a depth image, set the align_to parameter to RS2_STREAM_DEPTH.\n"